@@ -11,11 +11,21 @@
 
 ____________________________________________________________________________________________*/
 #include <LLC/types/base_uint.h>
+
+#include <cstring>
 #include <limits>
 #include <stdexcept>
 
 namespace
 {
+#if defined(__SIZEOF_INT128__)
+
+    /* 128-bit products for the 64-bit limb paths, marked as an extension for pedantic builds. */
+    __extension__ typedef unsigned __int128 uint128_native_t;
+
+#endif
+
+
     uint8_t phexdigit[256] =
     {
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -26,6 +36,168 @@ namespace
         0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
         0,0xa,0xb,0xc,0xd,0xe,0xf,0,0,0,0,0,0,0,0,0
     };
+
+
+    /* Get the 64-bit limb made of the two 32-bit words at an index, which compilers fuse into one load. */
+    inline uint64_t get64(const uint32_t* pWords, const uint32_t nIndex)
+    {
+        return pWords[nIndex] | (uint64_t(pWords[nIndex + 1]) << 32);
+    }
+
+
+    /* Set the two 32-bit words at an index from a 64-bit limb. */
+    inline void set64(uint32_t* pWords, const uint32_t nIndex, const uint64_t nLimb)
+    {
+        pWords[nIndex]     = static_cast<uint32_t>(nLimb);
+        pWords[nIndex + 1] = static_cast<uint32_t>(nLimb >> 32);
+    }
+
+
+    /* Compare two numbers from the most significant limb, returning -1, 0 or 1. */
+    template<uint32_t WIDTH>
+    inline int32_t compare(const uint32_t* pA, const uint32_t* pB)
+    {
+        uint32_t i = WIDTH;
+
+        /* Widths such as 1056 bits have an odd word at the top. */
+        if(WIDTH & 1)
+        {
+            --i;
+            if(pA[i] != pB[i])
+                return pA[i] < pB[i] ? -1 : 1;
+        }
+
+        while(i > 0)
+        {
+            i -= 2;
+
+            const uint64_t nA = get64(pA, i);
+            const uint64_t nB = get64(pB, i);
+            if(nA != nB)
+                return nA < nB ? -1 : 1;
+        }
+
+        return 0;
+    }
+
+
+    /* Get the number of significant 32-bit words in a number. */
+    template<uint32_t WIDTH>
+    inline uint32_t words(const uint32_t* pWords)
+    {
+        uint32_t nWords = WIDTH;
+        while(nWords > 0 && pWords[nWords - 1] == 0)
+            --nWords;
+
+        return nWords;
+    }
+
+
+    /* Get the number of leading zero bits of a non-zero word. */
+    inline uint32_t leading_zeros(const uint32_t nWord)
+    {
+    #if defined(__GNUC__)
+        return __builtin_clz(nWord);
+    #else
+        uint32_t nZeros = 0;
+        while(!(nWord & (0x80000000u >> nZeros)))
+            ++nZeros;
+
+        return nZeros;
+    #endif
+    }
+
+
+    /* Divide a number in place by a 32-bit divisor, returning the remainder. */
+    template<uint32_t WIDTH>
+    inline uint32_t divide32(uint32_t* pWords, const uint32_t nDivisor)
+    {
+        uint64_t nRemainder = 0;
+        for(int32_t i = WIDTH - 1; i >= 0; --i)
+        {
+            const uint64_t nCurrent = (nRemainder << 32) | pWords[i];
+
+            pWords[i]  = static_cast<uint32_t>(nCurrent / nDivisor);
+            nRemainder = nCurrent % nDivisor;
+        }
+
+        return static_cast<uint32_t>(nRemainder);
+    }
+
+
+    /* Long division of one number by another of at least two words (Knuth, TAOCP vol. 2, 4.3.1, algorithm D).
+     * The quotient is written to pQuotient, which must be zeroed. */
+    template<uint32_t WIDTH>
+    void divide(const uint32_t* pNumerator, const uint32_t* pDivisor, uint32_t* pQuotient)
+    {
+        const uint32_t m = words<WIDTH>(pNumerator);
+        const uint32_t n = words<WIDTH>(pDivisor);
+        if(m < n)
+            return;
+
+        /* Normalize so the top bit of the divisor is set, which keeps each estimate at most two too large. */
+        const uint32_t s = leading_zeros(pDivisor[n - 1]);
+
+        uint32_t vn[WIDTH];
+        for(uint32_t i = n - 1; i > 0; --i)
+            vn[i] = (pDivisor[i] << s) | static_cast<uint32_t>(uint64_t(pDivisor[i - 1]) >> (32 - s));
+        vn[0] = pDivisor[0] << s;
+
+        uint32_t un[WIDTH + 1];
+        un[m] = static_cast<uint32_t>(uint64_t(pNumerator[m - 1]) >> (32 - s));
+        for(uint32_t i = m - 1; i > 0; --i)
+            un[i] = (pNumerator[i] << s) | static_cast<uint32_t>(uint64_t(pNumerator[i - 1]) >> (32 - s));
+        un[0] = pNumerator[0] << s;
+
+        const uint64_t BASE = uint64_t(1) << 32;
+        for(int32_t j = m - n; j >= 0; --j)
+        {
+            /* Estimate the quotient word from the top two words, then correct it from the third. */
+            const uint64_t nTop = (uint64_t(un[j + n]) << 32) | un[j + n - 1];
+
+            uint64_t nQuotient  = nTop / vn[n - 1];
+            uint64_t nRemainder = nTop % vn[n - 1];
+            while(nQuotient >= BASE || nQuotient * vn[n - 2] > ((nRemainder << 32) | un[j + n - 2]))
+            {
+                --nQuotient;
+                nRemainder += vn[n - 1];
+                if(nRemainder >= BASE)
+                    break;
+            }
+
+            /* Multiply and subtract. */
+            int64_t nBorrow = 0;
+            int64_t nDifference = 0;
+            for(uint32_t i = 0; i < n; ++i)
+            {
+                const uint64_t nProduct = nQuotient * vn[i];
+
+                nDifference = un[i + j] - nBorrow - static_cast<int64_t>(nProduct & 0xffffffff);
+                un[i + j]   = static_cast<uint32_t>(nDifference);
+                nBorrow     = static_cast<int64_t>(nProduct >> 32) - (nDifference >> 32);
+            }
+
+            nDifference = un[j + n] - nBorrow;
+            un[j + n]   = static_cast<uint32_t>(nDifference);
+
+            /* The estimate was one too large, so add the divisor back. */
+            pQuotient[j] = static_cast<uint32_t>(nQuotient);
+            if(nDifference < 0)
+            {
+                --pQuotient[j];
+
+                uint64_t nCarry = 0;
+                for(uint32_t i = 0; i < n; ++i)
+                {
+                    const uint64_t nSum = uint64_t(un[i + j]) + vn[i] + nCarry;
+
+                    un[i + j] = static_cast<uint32_t>(nSum);
+                    nCarry    = nSum >> 32;
+                }
+                un[j + n] += static_cast<uint32_t>(nCarry);
+            }
+        }
+    }
 }
 
 
@@ -231,18 +403,23 @@ base_uint<BITS>& base_uint<BITS>::operator&=(const base_uint<BITS>& b)
 template<uint32_t BITS>
 base_uint<BITS>& base_uint<BITS>::operator<<=(uint32_t shift)
 {
-    base_uint<BITS> a(*this);
-    for(int32_t i = 0; i < WIDTH; ++i)
-        pn[i] = 0;
-
-    int32_t k = shift / 32;
+    const uint32_t k = shift / 32;
     shift = shift % 32;
-    for(int32_t i = 0; i < WIDTH; ++i)
+
+    /* Move the words up in place from the top, which never reads a word already written. */
+    for(int32_t i = WIDTH - 1; i >= 0; --i)
     {
-        if(i+k+1 < WIDTH && shift != 0)
-            pn[i+k+1] |= (a.pn[i] >> (32-shift));
-        if(i+k < WIDTH)
-            pn[i+k] |= (a.pn[i] << shift);
+        if(uint32_t(i) < k)
+        {
+            pn[i] = 0;
+            continue;
+        }
+
+        uint32_t nWord = pn[i - k] << shift;
+        if(shift != 0 && uint32_t(i) > k)
+            nWord |= pn[i - k - 1] >> (32 - shift);
+
+        pn[i] = nWord;
     }
 
     return *this;
@@ -254,19 +431,23 @@ base_uint<BITS>& base_uint<BITS>::operator<<=(uint32_t shift)
 template<uint32_t BITS>
 base_uint<BITS>& base_uint<BITS>::operator>>=(uint32_t shift)
 {
-    base_uint<BITS> a(*this);
-
-    for(int32_t i = 0; i < WIDTH; ++i)
-        pn[i] = 0;
-
-    int32_t k = shift / 32;
+    const uint32_t k = shift / 32;
     shift = shift % 32;
-    for(int32_t i = 0; i < WIDTH; ++i)
+
+    /* Move the words down in place from the bottom, which never reads a word already written. */
+    for(uint32_t i = 0; i < WIDTH; ++i)
     {
-        if(i-k-1 >= 0 && shift != 0)
-            pn[i-k-1] |= (a.pn[i] << (32-shift));
-        if(i-k >= 0)
-            pn[i-k] |= (a.pn[i] >> shift);
+        if(k >= WIDTH - i)
+        {
+            pn[i] = 0;
+            continue;
+        }
+
+        uint32_t nWord = pn[i + k] >> shift;
+        if(shift != 0 && i + k + 1 < WIDTH)
+            nWord |= pn[i + k + 1] << (32 - shift);
+
+        pn[i] = nWord;
     }
 
     return *this;
@@ -277,14 +458,22 @@ base_uint<BITS>& base_uint<BITS>::operator>>=(uint32_t shift)
 template<uint32_t BITS>
 base_uint<BITS>& base_uint<BITS>::operator+=(const base_uint<BITS>& b)
 {
+    /* Add in 64-bit limbs, with the odd top word of widths such as 1056 bits added on its own. */
     uint64_t carry = 0;
-    for(uint8_t i = 0; i < WIDTH; ++i)
+    uint32_t i = 0;
+    for(; i + 1 < WIDTH; i += 2)
     {
-        uint64_t n = carry + pn[i] + b.pn[i];
-        pn[i] = n & 0xffffffff;
-        carry = n >> 32;
+        const uint64_t a = get64(pn, i);
+        const uint64_t n = a + get64(b.pn, i);
+        const uint64_t s = n + carry;
+
+        carry = (n < a) | (s < n);
+        set64(pn, i, s);
     }
 
+    if(WIDTH & 1)
+        pn[i] += b.pn[i] + static_cast<uint32_t>(carry);
+
     return *this;
 }
 
@@ -293,9 +482,18 @@ base_uint<BITS>& base_uint<BITS>::operator+=(const base_uint<BITS>& b)
 template<uint32_t BITS>
 base_uint<BITS>& base_uint<BITS>::operator+=(uint64_t b64)
 {
-    base_uint<BITS> b;
-    b = b64;
-    *this += b;
+    const uint64_t n = get64(pn, 0) + b64;
+    set64(pn, 0, n);
+
+    /* Ripple the carry up only as far as it goes. */
+    if(n < b64)
+    {
+        for(uint32_t i = 2; i < WIDTH; ++i)
+        {
+            if(++pn[i] != 0)
+                break;
+        }
+    }
 
     return *this;
 }
@@ -305,7 +503,21 @@ base_uint<BITS>& base_uint<BITS>::operator+=(uint64_t b64)
 template<uint32_t BITS>
 base_uint<BITS>& base_uint<BITS>::operator-=(const base_uint<BITS>& b)
 {
-    *this += -b;
+    /* Subtract in 64-bit limbs rather than adding the negation, which takes two passes. */
+    uint64_t borrow = 0;
+    uint32_t i = 0;
+    for(; i + 1 < WIDTH; i += 2)
+    {
+        const uint64_t a = get64(pn, i);
+        const uint64_t n = a - get64(b.pn, i);
+        const uint64_t s = n - borrow;
+
+        borrow = (n > a) | (s > n);
+        set64(pn, i, s);
+    }
+
+    if(WIDTH & 1)
+        pn[i] -= b.pn[i] + static_cast<uint32_t>(borrow);
 
     return *this;
 }
@@ -315,9 +527,18 @@ base_uint<BITS>& base_uint<BITS>::operator-=(const base_uint<BITS>& b)
 template<uint32_t BITS>
 base_uint<BITS>& base_uint<BITS>::operator-=(uint64_t b64)
 {
-    base_uint<BITS> b;
-    b = b64;
-    *this += -b;
+    const uint64_t a = get64(pn, 0);
+    set64(pn, 0, a - b64);
+
+    /* Ripple the borrow up only as far as it goes. */
+    if(b64 > a)
+    {
+        for(uint32_t i = 2; i < WIDTH; ++i)
+        {
+            if(pn[i]-- != 0)
+                break;
+        }
+    }
 
     return *this;
 }
@@ -330,15 +551,25 @@ base_uint<BITS>& base_uint<BITS>::operator*=(const base_uint<BITS>& b)
     base_uint<BITS> a;
     a = 0u;
 
-    for(int j = 0; j < WIDTH; j++)
+    /* Skip the zero words of either side, as difficulty and trust values rarely fill the width. */
+    const uint32_t nWords = words<WIDTH>(b.pn);
+    for(uint32_t j = 0; j < WIDTH; j++)
     {
+        if(pn[j] == 0)
+            continue;
+
         uint64_t carry = 0;
-        for(int i = 0; i + j < WIDTH; i++)
+        uint32_t i = 0;
+        for(; i < nWords && i + j < WIDTH; i++)
         {
             uint64_t n = carry + a.pn[i + j] + (uint64_t)pn[j] * b.pn[i];
             a.pn[i + j] = n & 0xffffffff;
             carry = n >> 32;
         }
+
+        /* No earlier row has reached this word yet. */
+        if(i + j < WIDTH)
+            a.pn[i + j] = static_cast<uint32_t>(carry);
     }
     *this = a;
 
@@ -350,23 +581,28 @@ base_uint<BITS>& base_uint<BITS>::operator*=(const base_uint<BITS>& b)
 template<uint32_t BITS>
 base_uint<BITS>& base_uint<BITS>::operator*=(uint64_t n)
 {
-    base_uint<BITS> a;
-    a = 0u;
-
-    base_uint<BITS> b;
-    b = n;
+#if defined(__SIZEOF_INT128__)
 
-    for(int j = 0; j < WIDTH; j++)
+    /* One pass in 64-bit limbs with a 128-bit product. */
+    uint128_native_t carry = 0;
+    uint32_t i = 0;
+    for(; i + 1 < WIDTH; i += 2)
     {
-        uint64_t carry = 0;
-        for(int i = 0; i + j < WIDTH; i++)
-        {
-            uint64_t n = carry + a.pn[i + j] + (uint64_t)pn[j] * b.pn[i];
-            a.pn[i + j] = n & 0xffffffff;
-            carry = n >> 32;
-        }
+        carry += static_cast<uint128_native_t>(get64(pn, i)) * n;
+
+        set64(pn, i, static_cast<uint64_t>(carry));
+        carry >>= 64;
     }
-    *this = a;
+
+    /* Only the low word of the top product is kept. */
+    if(WIDTH & 1)
+        pn[i] = static_cast<uint32_t>(uint64_t(pn[i]) * n + static_cast<uint64_t>(carry));
+
+#else
+
+    *this *= base_uint<BITS>(n);
+
+#endif
 
     return *this;
 }
@@ -377,35 +613,22 @@ base_uint<BITS>& base_uint<BITS>::operator*=(uint64_t n)
 template<uint32_t BITS>
 base_uint<BITS>& base_uint<BITS>::operator/=(const base_uint<BITS>& b)
 {
-    base_uint<BITS> div = b;     // make a copy, so we can shift.
-    base_uint<BITS> num = *this; // make a copy, so we can subtract.
-    *this = 0;                   // the quotient.
-
-    int num_bits = num.bits();
-    int div_bits = div.bits();
-
-    if(div_bits == 0)
+    const uint32_t nWords = words<WIDTH>(b.pn);
+    if(nWords == 0)
         throw std::domain_error("Division by zero");
 
-    if(div_bits > num_bits) // the result is certainly 0.
+    /* Single word divisors, such as target timespans, take one pass. */
+    if(nWords == 1)
+    {
+        divide32<WIDTH>(pn, b.pn[0]);
         return *this;
+    }
 
-    int shift = num_bits - div_bits;
-
-    div <<= shift; // shift so that div and num align.
-    while(shift >= 0)
-    {
-        if(num >= div)
-        {
-            num -= div;
-            pn[shift >> 5] |= (1 << (shift & 31)); // set a bit of the result.
-        }
+    const base_uint<BITS> num = *this; // make a copy, as the quotient is written in place.
+    *this = 0;
 
-        div >>= 1; // shift back.
-        --shift;
-    }
+    divide<WIDTH>(num.pn, b.pn, pn);
 
-    // num now contains the remainder of the division.
     return *this;
 }
 
@@ -414,9 +637,17 @@ base_uint<BITS>& base_uint<BITS>::operator/=(const base_uint<BITS>& b)
 template<uint32_t BITS>
 base_uint<BITS>& base_uint<BITS>::operator/=(uint64_t b)
 {
+    if(b == 0)
+        throw std::domain_error("Division by zero");
+
+    if(b <= std::numeric_limits<uint32_t>::max())
+    {
+        divide32<WIDTH>(pn, static_cast<uint32_t>(b));
+        return *this;
+    }
+
     *this /= base_uint<BITS>(b);
 
-    // num now contains the remainder of the division.
     return *this;
 }
 
@@ -476,15 +707,7 @@ const base_uint<BITS> base_uint<BITS>::operator--(int)
 template<uint32_t BITS>
 bool base_uint<BITS>::operator<(const base_uint<BITS>& n) const
 {
-    for(int8_t i = WIDTH-1; i >= 0; --i)
-    {
-        if(this->pn[i] < n.pn[i])
-            return true;
-        else if(this->pn[i] > n.pn[i])
-            return false;
-    }
-
-    return false;
+    return compare<WIDTH>(pn, n.pn) < 0;
 }
 
 
@@ -492,15 +715,7 @@ bool base_uint<BITS>::operator<(const base_uint<BITS>& n) const
 template<uint32_t BITS>
 bool base_uint<BITS>::operator<=(const base_uint<BITS>& n) const
 {
-    for(int8_t i = WIDTH-1; i >= 0; --i)
-    {
-        if(this->pn[i] < n.pn[i])
-            return true;
-        else if(this->pn[i] > n.pn[i])
-            return false;
-    }
-
-    return true;
+    return compare<WIDTH>(pn, n.pn) <= 0;
 }
 
 
@@ -508,15 +723,7 @@ bool base_uint<BITS>::operator<=(const base_uint<BITS>& n) const
 template<uint32_t BITS>
 bool base_uint<BITS>::operator>(const base_uint<BITS>& n) const
 {
-    for(int8_t i = WIDTH-1; i >= 0; --i)
-    {
-        if(this->pn[i] > n.pn[i])
-            return true;
-        else if(this->pn[i] < n.pn[i])
-            return false;
-    }
-
-    return false;
+    return compare<WIDTH>(pn, n.pn) > 0;
 }
 
 
@@ -524,15 +731,7 @@ bool base_uint<BITS>::operator>(const base_uint<BITS>& n) const
 template<uint32_t BITS>
 bool base_uint<BITS>::operator>=(const base_uint<BITS>& n) const
 {
-    for(int8_t i = WIDTH-1; i >= 0; --i)
-    {
-        if(this->pn[i] > n.pn[i])
-            return true;
-        else if(this->pn[i] < n.pn[i])
-            return false;
-    }
-
-    return true;
+    return compare<WIDTH>(pn, n.pn) >= 0;
 }
 
 
@@ -540,11 +739,7 @@ bool base_uint<BITS>::operator>=(const base_uint<BITS>& n) const
 template<uint32_t BITS>
 bool base_uint<BITS>::operator==(const base_uint<BITS>& n) const
 {
-    for(uint8_t i = 0; i < WIDTH; ++i)
-        if(this->pn[i] != n.pn[i])
-            return false;
-
-    return true;
+    return std::memcmp(pn, n.pn, sizeof(pn)) == 0;
 }
 
 
@@ -552,12 +747,10 @@ bool base_uint<BITS>::operator==(const base_uint<BITS>& n) const
 template<uint32_t BITS>
 bool base_uint<BITS>::operator==(uint64_t n) const
 {
-    if(this->pn[0] != (uint32_t)n)
-        return false;
-    if(this->pn[1] != (uint32_t)(n >> 32))
+    if(get64(pn, 0) != n)
         return false;
 
-    for(uint8_t i = 2; i < WIDTH; ++i)
+    for(uint32_t i = 2; i < WIDTH; ++i)
         if(this->pn[i] != 0)
             return false;
 
@@ -799,14 +992,7 @@ uint32_t base_uint<BITS>::bits() const
     for(int32_t pos = WIDTH - 1; pos >= 0; --pos)
     {
         if(pn[pos])
-        {
-            for(int32_t nbits = 31; nbits > 0; --nbits)
-            {
-                if(pn[pos] & 1U << nbits)
-                    return 32 * pos + nbits + 1;
-            }
-            return 32 * pos + 1;
-        }
+            return 32 * pos + 32 - leading_zeros(pn[pos]);
     }
 
     return 0;
@@ -20,6 +20,7 @@ ________________________________________________________________________________
 #include <LLC/hash/SK/KeccakHash.h>
 
 #include <LLD/cache/template_lru.h>
+#include <LLD/cache/fingerprint_cache.h>
 
 /** Namespace LLC (Lower Level Crypto) **/
 namespace LLC
@@ -27,8 +28,10 @@ namespace LLC
 
 	static uint8_t pblank[1];
 
+	/* Lock-free cache of 64-bit hashed values, keyed by input fingerprint. */
+	extern LLD::FingerprintCache<uint64_t> cache64;
+
 	/* LRU cache of hashed values  */
-	extern LLD::TemplateLRU<std::vector<uint8_t>, uint64_t> cache64;
 	extern LLD::TemplateLRU<std::vector<uint8_t>, uint256_t> cache256;
 	extern LLD::TemplateLRU<std::vector<uint8_t>, uint512_t> cache512;
 	extern LLD::TemplateLRU<std::vector<uint8_t>, uint1024_t> cache1024;
@@ -89,17 +92,18 @@ namespace LLC
 	template<typename T1>
 	inline uint64_t SK64(const T1 pbegin, const T1 pend)
 	{
-		/* Copy the data into a vector of bytes so we can cache the hashed value */
-		std::vector<uint8_t> vData(pbegin, pend);
+		/* Get the input bytes without copying them. */
+		const uint8_t* pData = (pbegin == pend ? pblank : (uint8_t*)&pbegin[0]);
+		const uint64_t nSize = (pend - pbegin) * sizeof(pbegin[0]);
 
 		/* Check the cache for this data */
 		uint64_t hashKeccak = 0;
-		if(!cache64.Get(vData, hashKeccak))
+		if(!cache64.Get(pData, nSize, hashKeccak))
 		{
 			uint64_t hashSkein = 0;
 			Skein_256_Ctxt_t ctxSkein;
 			Skein_256_Init  (&ctxSkein, 64);
-			Skein_256_Update(&ctxSkein, (pbegin == pend ? pblank : (uint8_t*)&pbegin[0]), (pend - pbegin) * sizeof(pbegin[0]));
+			Skein_256_Update(&ctxSkein, pData, nSize);
 			Skein_256_Final (&ctxSkein, (uint8_t *)&hashSkein);
 
 			Keccak_HashInstance ctxKeccak;
@@ -108,7 +112,7 @@ namespace LLC
 			Keccak_HashFinal(&ctxKeccak, (uint8_t *)&hashKeccak);
 
 			/* Cache the hashed value */
-			cache64.Put(vData, hashKeccak);
+			cache64.Put(pData, nSize, hashKeccak);
 		}
 
 		return hashKeccak;
@@ -122,26 +126,7 @@ namespace LLC
      **/
 	inline uint64_t SK64(const std::vector<uint8_t>& vch)
 	{
-		/* Check the cache for this data */
-		uint64_t hashKeccak = 0;
-		if(!cache64.Get(vch, hashKeccak))
-		{
-			uint64_t hashSkein = 0;
-			Skein_256_Ctxt_t ctxSkein;
-			Skein_256_Init(&ctxSkein, 64);
-			Skein_256_Update(&ctxSkein, (uint8_t *)&vch[0], vch.size());
-			Skein_256_Final(&ctxSkein, (uint8_t *)&hashSkein);
-
-			Keccak_HashInstance ctxKeccak;
-			Keccak_HashInitialize(&ctxKeccak, 1344, 256, 64, 0x06);
-			Keccak_HashUpdate(&ctxKeccak, (uint8_t *)&hashSkein, 64);
-			Keccak_HashFinal(&ctxKeccak, (uint8_t *)&hashKeccak);
-
-			/* Cache the hashed value */
-			cache64.Put(vch, hashKeccak);
-		}
-
-		return hashKeccak;
+		return SK64(vch.begin(), vch.end());
 	}
 
 
@@ -368,6 +353,23 @@ namespace LLC
 	}
 
 
+	/** SK512Batch
+     *
+     *  512-bit hashing of many independent equal length inputs, used for Merkle Tree levels.
+     *  Gives the same result as SK512(pbegin, pend) on each input, with the Keccak stage run
+     *  through the multi-buffer permutation four inputs at a time.
+     *
+     *  @param[in] pInput The inputs laid out contiguously, nSize bytes each.
+     *  @param[in] nSize The size in bytes of each input.
+     *  @param[in] nCount The total number of inputs.
+     *  @param[out] pOutput The array of nCount hashes to write. This may alias pInput as long as
+     *                      each output is at or before its input, as every group of four inputs
+     *                      is read before its outputs are written.
+     *
+     **/
+	void SK512Batch(const uint8_t* pInput, const uint32_t nSize, const uint32_t nCount, uint512_t* pOutput);
+
+
 	/** SK576
      *
      * 576-bit hashing template used for Private Keys.
@@ -392,6 +394,42 @@ namespace LLC
 	}
 
 
+	/** SK1024Midstate
+     *
+     *  1024-bit hashing of a fixed prefix followed by a 64-bit nonce, for nonce searches such as the
+     *  stake minter. The Skein state after the prefix is kept, so each hash only processes the blocks
+     *  holding the nonce. Gives the same result as SK1024 over the prefix and the serialized nonce,
+     *  without going through the cache.
+     *
+     **/
+	class SK1024Midstate
+	{
+		/** The Skein state after the prefix. **/
+		Skein1024_Ctxt_t ctxPrefix;
+
+	public:
+
+		/** Constructor
+         *
+         *  @param[in] vPrefix The bytes before the nonce.
+         *
+         **/
+		explicit SK1024Midstate(const std::vector<uint8_t>& vPrefix);
+
+
+		/** Hash
+         *
+         *  Hash the prefix followed by a nonce. Safe to call from many threads.
+         *
+         *  @param[in] nNonce The nonce, appended the way the serializer writes it.
+         *
+         *  @return The 1024-bit hash.
+         *
+         **/
+		uint1024_t Hash(const uint64_t nNonce) const;
+	};
+
+
 	/** SK1024
      *
      *  1024-bit hashing template used to build Block Hashes.
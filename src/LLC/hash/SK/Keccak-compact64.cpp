@@ -184,7 +184,7 @@ void KeccakF1600_StateComplementBit(void *state, uint32_t position)
 
 /* ---------------------------------------------------------------- */
 
-void KeccakF1600_StatePermute(void *argState)
+void KeccakF1600_StatePermuteCompact(void *argState)
 {
     tSmaUtilInt x, y, round;
     tKeccakLane        temp;
@@ -249,6 +249,28 @@ void KeccakF1600_StatePermute(void *argState)
 
 /* ---------------------------------------------------------------- */
 
+typedef void (*tKeccakPermute)(void *);
+
+/* The unrolled permutation needs 64-bit registers to pay off, 32-bit builds keep the compact one.
+ * This is a constant initializer so hashing from other static constructors is safe. */
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(__powerpc64__)
+static const tKeccakPermute KeccakF1600_Permute = &KeccakF1600_StatePermuteOpt64;
+#else
+static const tKeccakPermute KeccakF1600_Permute = &KeccakF1600_StatePermuteCompact;
+#endif
+
+void KeccakF1600_StatePermute(void *argState)
+{
+    KeccakF1600_Permute(argState);
+}
+
+const char *KeccakF1600_Implementation(void)
+{
+    return (KeccakF1600_Permute == &KeccakF1600_StatePermuteOpt64) ? "opt64" : "compact";
+}
+
+/* ---------------------------------------------------------------- */
+
 void KeccakF1600_StateExtractBytesInLane(const void *state, uint32_t lanePosition, uint8_t *data, uint32_t offset, uint32_t length)
 {
 #if(PLATFORM_BYTE_ORDER == IS_LITTLE_ENDIAN)
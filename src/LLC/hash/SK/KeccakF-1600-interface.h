@@ -72,6 +72,22 @@ void KeccakF1600_StateComplementBit(void *state, uint32_t position);
   */
 void KeccakF1600_StatePermute(void *state);
 
+/** Size optimized reference implementation of Keccak-f[1600].
+  * Used as the fallback when the optimized implementation is not selected.
+  * @param  state   Pointer to the state.
+  */
+void KeccakF1600_StatePermuteCompact(void *state);
+
+/** Speed optimized (lane complementing, fully unrolled) implementation of Keccak-f[1600].
+  * @param  state   Pointer to the state.
+  */
+void KeccakF1600_StatePermuteOpt64(void *state);
+
+/** Function to get the name of the permutation selected by KeccakF1600_StatePermute.
+  * @return "opt64" or "compact".
+  */
+const char *KeccakF1600_Implementation(void);
+
 /** Function to retrieve data from the state into bytes.
   * The bits to output are restricted to be consecutive and to be in the same lane.
   * The bit positions that are retrieved by this function are
@@ -0,0 +1,360 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK/KeccakTimes4.h>
+#include <LLC/hash/SK/KeccakF-1600-interface.h>
+#include <LLC/hash/SK/brg_endian.h>
+
+#include <algorithm>
+#include <cstring>
+
+/* The AVX2 path is compiled with a per-function target attribute, so the rest of the binary keeps
+ * the baseline instruction set and the path is only taken when the CPU reports AVX2 support. */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define KECCAK_TIMES4_AVX2
+#include <immintrin.h>
+#endif
+
+
+/* Round constants for iota step. */
+static const uint64_t KeccakF1600Times4RoundConstants[24] =
+{
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL, 0x8000000080008000ULL,
+    0x000000000000808bULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+    0x000000000000008aULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+    0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800aULL, 0x800000008000000aULL,
+    0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+
+/* Scalar fallback, runs the single state permutation over each instance. */
+static void KeccakF1600_StatePermuteTimes4_Scalar(uint64_t* states)
+{
+    uint64_t state[25];
+    for(uint32_t j = 0; j < 4; ++j)
+    {
+        /* De-interleave the instance. */
+        for(uint32_t i = 0; i < 25; ++i)
+            state[i] = states[i * 4 + j];
+
+        KeccakF1600_StatePermute(state);
+
+        /* Interleave it back. */
+        for(uint32_t i = 0; i < 25; ++i)
+            states[i * 4 + j] = state[i];
+    }
+}
+
+
+#if defined(KECCAK_TIMES4_AVX2)
+
+/* Vector helpers, one 256-bit register holds the same lane of all four instances. */
+#define XOR256(a, b)    _mm256_xor_si256(a, b)
+#define ANDNOT256(a, b) _mm256_andnot_si256(a, b)
+#define ROL256(a, n)    _mm256_or_si256(_mm256_slli_epi64(a, n), _mm256_srli_epi64(a, 64 - (n)))
+
+
+/* One unrolled round from state A into state E, accumulating the column parities of E. */
+#define thetaRhoPiChiIotaTimes4(i, A, E) \
+    Da = XOR256(Cu, ROL256(Ce, 1)); \
+    De = XOR256(Ca, ROL256(Ci, 1)); \
+    Di = XOR256(Ce, ROL256(Co, 1)); \
+    Do = XOR256(Ci, ROL256(Cu, 1)); \
+    Du = XOR256(Co, ROL256(Ca, 1)); \
+\
+    Bba = XOR256(A##ba, Da); \
+    Bbe = ROL256(XOR256(A##ge, De), 44); \
+    Bbi = ROL256(XOR256(A##ki, Di), 43); \
+    Bbo = ROL256(XOR256(A##mo, Do), 21); \
+    Bbu = ROL256(XOR256(A##su, Du), 14); \
+    E##ba = XOR256(XOR256(Bba, ANDNOT256(Bbe, Bbi)), _mm256_set1_epi64x(static_cast<long long>(KeccakF1600Times4RoundConstants[i]))); \
+    E##be = XOR256(Bbe, ANDNOT256(Bbi, Bbo)); \
+    E##bi = XOR256(Bbi, ANDNOT256(Bbo, Bbu)); \
+    E##bo = XOR256(Bbo, ANDNOT256(Bbu, Bba)); \
+    E##bu = XOR256(Bbu, ANDNOT256(Bba, Bbe)); \
+\
+    Bga = ROL256(XOR256(A##bo, Do), 28); \
+    Bge = ROL256(XOR256(A##gu, Du), 20); \
+    Bgi = ROL256(XOR256(A##ka, Da),  3); \
+    Bgo = ROL256(XOR256(A##me, De), 45); \
+    Bgu = ROL256(XOR256(A##si, Di), 61); \
+    E##ga = XOR256(Bga, ANDNOT256(Bge, Bgi)); \
+    E##ge = XOR256(Bge, ANDNOT256(Bgi, Bgo)); \
+    E##gi = XOR256(Bgi, ANDNOT256(Bgo, Bgu)); \
+    E##go = XOR256(Bgo, ANDNOT256(Bgu, Bga)); \
+    E##gu = XOR256(Bgu, ANDNOT256(Bga, Bge)); \
+\
+    Bka = ROL256(XOR256(A##be, De),  1); \
+    Bke = ROL256(XOR256(A##gi, Di),  6); \
+    Bki = ROL256(XOR256(A##ko, Do), 25); \
+    Bko = ROL256(XOR256(A##mu, Du),  8); \
+    Bku = ROL256(XOR256(A##sa, Da), 18); \
+    E##ka = XOR256(Bka, ANDNOT256(Bke, Bki)); \
+    E##ke = XOR256(Bke, ANDNOT256(Bki, Bko)); \
+    E##ki = XOR256(Bki, ANDNOT256(Bko, Bku)); \
+    E##ko = XOR256(Bko, ANDNOT256(Bku, Bka)); \
+    E##ku = XOR256(Bku, ANDNOT256(Bka, Bke)); \
+\
+    Bma = ROL256(XOR256(A##bu, Du), 27); \
+    Bme = ROL256(XOR256(A##ga, Da), 36); \
+    Bmi = ROL256(XOR256(A##ke, De), 10); \
+    Bmo = ROL256(XOR256(A##mi, Di), 15); \
+    Bmu = ROL256(XOR256(A##so, Do), 56); \
+    E##ma = XOR256(Bma, ANDNOT256(Bme, Bmi)); \
+    E##me = XOR256(Bme, ANDNOT256(Bmi, Bmo)); \
+    E##mi = XOR256(Bmi, ANDNOT256(Bmo, Bmu)); \
+    E##mo = XOR256(Bmo, ANDNOT256(Bmu, Bma)); \
+    E##mu = XOR256(Bmu, ANDNOT256(Bma, Bme)); \
+\
+    Bsa = ROL256(XOR256(A##bi, Di), 62); \
+    Bse = ROL256(XOR256(A##go, Do), 55); \
+    Bsi = ROL256(XOR256(A##ku, Du), 39); \
+    Bso = ROL256(XOR256(A##ma, Da), 41); \
+    Bsu = ROL256(XOR256(A##se, De),  2); \
+    E##sa = XOR256(Bsa, ANDNOT256(Bse, Bsi)); \
+    E##se = XOR256(Bse, ANDNOT256(Bsi, Bso)); \
+    E##si = XOR256(Bsi, ANDNOT256(Bso, Bsu)); \
+    E##so = XOR256(Bso, ANDNOT256(Bsu, Bsa)); \
+    E##su = XOR256(Bsu, ANDNOT256(Bsa, Bse)); \
+\
+    Ca = XOR256(XOR256(XOR256(E##ba, E##ga), XOR256(E##ka, E##ma)), E##sa); \
+    Ce = XOR256(XOR256(XOR256(E##be, E##ge), XOR256(E##ke, E##me)), E##se); \
+    Ci = XOR256(XOR256(XOR256(E##bi, E##gi), XOR256(E##ki, E##mi)), E##si); \
+    Co = XOR256(XOR256(XOR256(E##bo, E##go), XOR256(E##ko, E##mo)), E##so); \
+    Cu = XOR256(XOR256(XOR256(E##bu, E##gu), XOR256(E##ku, E##mu)), E##su);
+
+
+/* Load or store one interleaved lane. */
+#define LOAD256(i)      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&states[(i) * 4]))
+#define STORE256(i, a)  _mm256_storeu_si256(reinterpret_cast<__m256i*>(&states[(i) * 4]), a)
+
+
+/* AVX2 implementation, all 24 rounds unrolled over 256-bit registers. */
+__attribute__((target("avx2")))
+static void KeccakF1600_StatePermuteTimes4_AVX2(uint64_t* states)
+{
+    __m256i Aba, Abe, Abi, Abo, Abu, Aga, Age, Agi, Ago, Agu, Aka, Ake, Aki, Ako, Aku;
+    __m256i Ama, Ame, Ami, Amo, Amu, Asa, Ase, Asi, Aso, Asu;
+    __m256i Bba, Bbe, Bbi, Bbo, Bbu, Bga, Bge, Bgi, Bgo, Bgu, Bka, Bke, Bki, Bko, Bku;
+    __m256i Bma, Bme, Bmi, Bmo, Bmu, Bsa, Bse, Bsi, Bso, Bsu;
+    __m256i Eba, Ebe, Ebi, Ebo, Ebu, Ega, Ege, Egi, Ego, Egu, Eka, Eke, Eki, Eko, Eku;
+    __m256i Ema, Eme, Emi, Emo, Emu, Esa, Ese, Esi, Eso, Esu;
+    __m256i Ca, Ce, Ci, Co, Cu, Da, De, Di, Do, Du;
+
+    Aba = LOAD256( 0); Abe = LOAD256( 1); Abi = LOAD256( 2); Abo = LOAD256( 3); Abu = LOAD256( 4);
+    Aga = LOAD256( 5); Age = LOAD256( 6); Agi = LOAD256( 7); Ago = LOAD256( 8); Agu = LOAD256( 9);
+    Aka = LOAD256(10); Ake = LOAD256(11); Aki = LOAD256(12); Ako = LOAD256(13); Aku = LOAD256(14);
+    Ama = LOAD256(15); Ame = LOAD256(16); Ami = LOAD256(17); Amo = LOAD256(18); Amu = LOAD256(19);
+    Asa = LOAD256(20); Ase = LOAD256(21); Asi = LOAD256(22); Aso = LOAD256(23); Asu = LOAD256(24);
+
+    Ca = XOR256(XOR256(XOR256(Aba, Aga), XOR256(Aka, Ama)), Asa);
+    Ce = XOR256(XOR256(XOR256(Abe, Age), XOR256(Ake, Ame)), Ase);
+    Ci = XOR256(XOR256(XOR256(Abi, Agi), XOR256(Aki, Ami)), Asi);
+    Co = XOR256(XOR256(XOR256(Abo, Ago), XOR256(Ako, Amo)), Aso);
+    Cu = XOR256(XOR256(XOR256(Abu, Agu), XOR256(Aku, Amu)), Asu);
+
+    thetaRhoPiChiIotaTimes4( 0, A, E)
+    thetaRhoPiChiIotaTimes4( 1, E, A)
+    thetaRhoPiChiIotaTimes4( 2, A, E)
+    thetaRhoPiChiIotaTimes4( 3, E, A)
+    thetaRhoPiChiIotaTimes4( 4, A, E)
+    thetaRhoPiChiIotaTimes4( 5, E, A)
+    thetaRhoPiChiIotaTimes4( 6, A, E)
+    thetaRhoPiChiIotaTimes4( 7, E, A)
+    thetaRhoPiChiIotaTimes4( 8, A, E)
+    thetaRhoPiChiIotaTimes4( 9, E, A)
+    thetaRhoPiChiIotaTimes4(10, A, E)
+    thetaRhoPiChiIotaTimes4(11, E, A)
+    thetaRhoPiChiIotaTimes4(12, A, E)
+    thetaRhoPiChiIotaTimes4(13, E, A)
+    thetaRhoPiChiIotaTimes4(14, A, E)
+    thetaRhoPiChiIotaTimes4(15, E, A)
+    thetaRhoPiChiIotaTimes4(16, A, E)
+    thetaRhoPiChiIotaTimes4(17, E, A)
+    thetaRhoPiChiIotaTimes4(18, A, E)
+    thetaRhoPiChiIotaTimes4(19, E, A)
+    thetaRhoPiChiIotaTimes4(20, A, E)
+    thetaRhoPiChiIotaTimes4(21, E, A)
+    thetaRhoPiChiIotaTimes4(22, A, E)
+    thetaRhoPiChiIotaTimes4(23, E, A)
+
+    STORE256( 0, Aba); STORE256( 1, Abe); STORE256( 2, Abi); STORE256( 3, Abo); STORE256( 4, Abu);
+    STORE256( 5, Aga); STORE256( 6, Age); STORE256( 7, Agi); STORE256( 8, Ago); STORE256( 9, Agu);
+    STORE256(10, Aka); STORE256(11, Ake); STORE256(12, Aki); STORE256(13, Ako); STORE256(14, Aku);
+    STORE256(15, Ama); STORE256(16, Ame); STORE256(17, Ami); STORE256(18, Amo); STORE256(19, Amu);
+    STORE256(20, Asa); STORE256(21, Ase); STORE256(22, Asi); STORE256(23, Aso); STORE256(24, Asu);
+}
+
+#undef LOAD256
+#undef STORE256
+#undef XOR256
+#undef ANDNOT256
+#undef ROL256
+
+#endif
+
+
+/* Function pointer type for the multi-buffer permutation. */
+typedef void (*KeccakF1600_PermuteTimes4Function)(uint64_t*);
+
+
+/* Select the best multi-buffer permutation for the running CPU. */
+static KeccakF1600_PermuteTimes4Function KeccakF1600_SelectTimes4()
+{
+#if defined(KECCAK_TIMES4_AVX2)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2"))
+        return &KeccakF1600_StatePermuteTimes4_AVX2;
+#endif
+
+    return &KeccakF1600_StatePermuteTimes4_Scalar;
+}
+
+
+/* Get the selected multi-buffer permutation, detected once on first use. */
+static KeccakF1600_PermuteTimes4Function KeccakF1600_GetTimes4()
+{
+    static const KeccakF1600_PermuteTimes4Function fnPermute = KeccakF1600_SelectTimes4();
+    return fnPermute;
+}
+
+
+/* Load a little endian lane from a byte buffer. */
+static inline uint64_t load64(const uint8_t* p)
+{
+#if(PLATFORM_BYTE_ORDER == IS_LITTLE_ENDIAN)
+    uint64_t nLane;
+    std::memcpy(&nLane, p, 8);
+
+    return nLane;
+#else
+    uint64_t nLane = 0;
+    for(int32_t i = 7; i >= 0; --i)
+        nLane = (nLane << 8) | p[i];
+
+    return nLane;
+#endif
+}
+
+
+/* Store the first nBytes of a lane as little endian bytes. */
+static inline void store64(uint8_t* p, uint64_t nLane, const uint32_t nBytes)
+{
+#if(PLATFORM_BYTE_ORDER == IS_LITTLE_ENDIAN)
+    std::memcpy(p, &nLane, nBytes);
+#else
+    for(uint32_t i = 0; i < nBytes; ++i, nLane >>= 8)
+        p[i] = static_cast<uint8_t>(nLane);
+#endif
+}
+
+
+/* Apply Keccak-f[1600] to four interleaved states. */
+void KeccakF1600_StatePermuteTimes4(uint64_t* states)
+{
+    KeccakF1600_GetTimes4()(states);
+}
+
+
+/* Hash four equal length messages with the multi-buffer permutation. */
+int Keccak_HashTimes4(const uint32_t nRate, const uint32_t nCapacity, const uint32_t nHashBits, const uint8_t nSuffix,
+                      const uint8_t* const pData[4], const uint64_t nDataBytes, uint8_t* const pOut[4])
+{
+    /* Check our parameters. */
+    if(nRate + nCapacity != 1600 || nRate == 0 || (nRate % 64) != 0 || (nHashBits % 8) != 0 || nSuffix == 0)
+        return 1;
+
+    /* Get our permutation and sizes. */
+    const KeccakF1600_PermuteTimes4Function fnPermute = KeccakF1600_GetTimes4();
+    const uint32_t nRateBytes = nRate / 8;
+    const uint32_t nRateLanes = nRate / 64;
+
+    /* The four interleaved states. */
+    uint64_t states[100];
+    std::memset(states, 0, sizeof(states));
+
+    /* Absorb all of the full blocks. */
+    uint64_t nOffset = 0;
+    for( ; nOffset + nRateBytes <= nDataBytes; nOffset += nRateBytes)
+    {
+        for(uint32_t i = 0; i < nRateLanes; ++i)
+            for(uint32_t j = 0; j < 4; ++j)
+                states[i * 4 + j] ^= load64(pData[j] + nOffset + i * 8);
+
+        fnPermute(states);
+    }
+
+    /* Build the final padded blocks, only the rate portion is ever absorbed. */
+    const uint32_t nRemaining = static_cast<uint32_t>(nDataBytes - nOffset);
+    uint8_t vBlock[4][200];
+    for(uint32_t j = 0; j < 4; ++j)
+    {
+        std::memset(vBlock[j], 0, nRateBytes);
+        std::memcpy(vBlock[j], pData[j] + nOffset, nRemaining);
+
+        vBlock[j][nRemaining] ^= nSuffix;
+    }
+
+    /* If the suffix uses the last bit of the rate we need an extra block for the final padding bit. */
+    if((nSuffix & 0x80) != 0 && nRemaining == nRateBytes - 1)
+    {
+        for(uint32_t i = 0; i < nRateLanes; ++i)
+            for(uint32_t j = 0; j < 4; ++j)
+                states[i * 4 + j] ^= load64(vBlock[j] + i * 8);
+
+        fnPermute(states);
+
+        for(uint32_t j = 0; j < 4; ++j)
+            std::memset(vBlock[j], 0, nRateBytes);
+    }
+
+    /* Absorb the last block with the final padding bit. */
+    for(uint32_t j = 0; j < 4; ++j)
+        vBlock[j][nRateBytes - 1] ^= 0x80;
+
+    for(uint32_t i = 0; i < nRateLanes; ++i)
+        for(uint32_t j = 0; j < 4; ++j)
+            states[i * 4 + j] ^= load64(vBlock[j] + i * 8);
+
+    fnPermute(states);
+
+    /* Squeeze out the output a lane at a time. */
+    const uint32_t nHashBytes = nHashBits / 8;
+    for(uint32_t nOut = 0; nOut < nHashBytes; )
+    {
+        const uint32_t nBytes = std::min(nRateBytes, nHashBytes - nOut);
+        for(uint32_t n = 0; n < nBytes; n += 8)
+            for(uint32_t j = 0; j < 4; ++j)
+                store64(pOut[j] + nOut + n, states[(n / 8) * 4 + j], std::min(8u, nBytes - n));
+
+        /* Permute again if we need more output than the rate. */
+        nOut += nBytes;
+        if(nOut < nHashBytes)
+            fnPermute(states);
+    }
+
+    return 0;
+}
+
+
+/* Get the name of the selected multi-buffer permutation. */
+const char* KeccakF1600_Times4Implementation()
+{
+#if defined(KECCAK_TIMES4_AVX2)
+    if(KeccakF1600_GetTimes4() == &KeccakF1600_StatePermuteTimes4_AVX2)
+        return "avx2";
+#endif
+
+    return "scalar";
+}
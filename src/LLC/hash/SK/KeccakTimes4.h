@@ -0,0 +1,62 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLC_HASH_SK_KECCAKTIMES4_H
+#define NEXUS_LLC_HASH_SK_KECCAKTIMES4_H
+
+#include <cstdint>
+
+
+/** KeccakF1600_StatePermuteTimes4
+ *
+ *  Apply Keccak-f[1600] to four independent states at once.
+ *  The states are stored lane interleaved: lane i of instance j is at states[i * 4 + j].
+ *  Uses AVX2 when the CPU supports it, otherwise four sequential permutations.
+ *
+ *  @param[in] states The 100 lanes of the four interleaved states.
+ *
+ **/
+void KeccakF1600_StatePermuteTimes4(uint64_t* states);
+
+
+/** Keccak_HashTimes4
+ *
+ *  Hash four independent messages of the same length with the same Keccak[r, c] instance.
+ *  Gives identical output to Keccak_HashInitialize/Update/Final per message, but runs the
+ *  four sponges through the multi-buffer permutation.
+ *
+ *  @param[in] nRate The rate in bits, must be a multiple of 64.
+ *  @param[in] nCapacity The capacity in bits, nRate + nCapacity must be 1600.
+ *  @param[in] nHashBits The output length in bits, must be a multiple of 8.
+ *  @param[in] nSuffix The delimited suffix used for domain separation (0x06 for SHA3).
+ *  @param[in] pData The four input messages.
+ *  @param[in] nDataBytes The length of each input message in bytes.
+ *  @param[out] pOut The four output buffers, each at least nHashBits / 8 bytes.
+ *
+ *  @return 0 on success, 1 on invalid parameters.
+ *
+ **/
+int Keccak_HashTimes4(const uint32_t nRate, const uint32_t nCapacity, const uint32_t nHashBits, const uint8_t nSuffix,
+                      const uint8_t* const pData[4], const uint64_t nDataBytes, uint8_t* const pOut[4]);
+
+
+/** KeccakF1600_Times4Implementation
+ *
+ *  Get the name of the multi-buffer permutation selected for this CPU.
+ *
+ **/
+const char* KeccakF1600_Times4Implementation();
+
+
+#endif
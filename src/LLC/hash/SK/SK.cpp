@@ -12,12 +12,107 @@
 ____________________________________________________________________________________________*/
 
 #include <LLC/hash/SK.h>
+#include <LLC/hash/SK/KeccakTimes4.h>
+
+#include <Util/include/metrics.h>
 
 namespace LLC
 {
     /* Implementation of SK function caches */
-    LLD::TemplateLRU<std::vector<uint8_t>, uint64_t>   cache64   (32);
+    LLD::FingerprintCache<uint64_t>                    cache64   (4096);
     LLD::TemplateLRU<std::vector<uint8_t>, uint256_t>  cache256  (32);
     LLD::TemplateLRU<std::vector<uint8_t>, uint512_t>  cache512  (32);
     LLD::TemplateLRU<std::vector<uint8_t>, uint1024_t> cache1024 (32);
+
+
+    /* Export the 64-bit cache statistics to the metrics registry. */
+    static const bool fCacheMetrics = []()
+    {
+        metrics::AddGauge("nexus_cache_hits_total", "Fingerprint cache hits.", "cache=\"sk64\"",
+            []{ return static_cast<double>(cache64.Hits()); }, true);
+
+        metrics::AddGauge("nexus_cache_misses_total", "Fingerprint cache misses.", "cache=\"sk64\"",
+            []{ return static_cast<double>(cache64.Misses()); }, true);
+
+        return true;
+    }();
+
+
+    static_assert(sizeof(uint512_t) == 64, "uint512_t must be tightly packed for batched hashing");
+
+
+    /* 512-bit hashing of many independent equal length inputs. */
+    void SK512Batch(const uint8_t* pInput, const uint32_t nSize, const uint32_t nCount, uint512_t* pOutput)
+    {
+        /* Work through the inputs in groups of four. */
+        uint32_t nIndex = 0;
+        for( ; nIndex + 4 <= nCount; nIndex += 4)
+        {
+            /* Skein stage for each of the four inputs. */
+            uint512_t hashSkein[4];
+            for(uint32_t j = 0; j < 4; ++j)
+            {
+                Skein_512_Ctxt_t ctxSkein;
+                Skein_512_Init  (&ctxSkein, 512);
+                Skein_512_Update(&ctxSkein, pInput + uint64_t(nIndex + j) * nSize, nSize);
+                Skein_512_Final (&ctxSkein, (uint8_t *)&hashSkein[j]);
+            }
+
+            /* Keccak stage for all four at once, outputs only written once all inputs are consumed. */
+            const uint8_t* pKeccakIn[4] =
+            {
+                (uint8_t *)&hashSkein[0], (uint8_t *)&hashSkein[1], (uint8_t *)&hashSkein[2], (uint8_t *)&hashSkein[3]
+            };
+
+            uint8_t* pKeccakOut[4] =
+            {
+                (uint8_t *)&pOutput[nIndex + 0], (uint8_t *)&pOutput[nIndex + 1],
+                (uint8_t *)&pOutput[nIndex + 2], (uint8_t *)&pOutput[nIndex + 3]
+            };
+
+            Keccak_HashTimes4(576, 1024, 512, 0x06, pKeccakIn, 64, pKeccakOut);
+        }
+
+        /* Hash the remaining inputs one at a time. */
+        for( ; nIndex < nCount; ++nIndex)
+        {
+            uint512_t hashSkein;
+            Skein_512_Ctxt_t ctxSkein;
+            Skein_512_Init  (&ctxSkein, 512);
+            Skein_512_Update(&ctxSkein, pInput + uint64_t(nIndex) * nSize, nSize);
+            Skein_512_Final (&ctxSkein, (uint8_t *)&hashSkein);
+
+            Keccak_HashInstance ctxKeccak;
+            Keccak_HashInitialize_SHA3_512(&ctxKeccak);
+            Keccak_HashUpdate(&ctxKeccak, (uint8_t *)&hashSkein, 512);
+            Keccak_HashFinal(&ctxKeccak, (uint8_t *)&pOutput[nIndex]);
+        }
+    }
+
+
+    /* Hash the prefix once. */
+    SK1024Midstate::SK1024Midstate(const std::vector<uint8_t>& vPrefix)
+    {
+        Skein1024_Init(&ctxPrefix, 1024);
+        Skein1024_Update(&ctxPrefix, vPrefix.empty() ? pblank : &vPrefix[0], vPrefix.size());
+    }
+
+
+    /* Hash the prefix followed by a nonce. */
+    uint1024_t SK1024Midstate::Hash(const uint64_t nNonce) const
+    {
+        /* Continue from a copy of the prefix state. */
+        uint1024_t hashSkein;
+        Skein1024_Ctxt_t ctxSkein = ctxPrefix;
+        Skein1024_Update(&ctxSkein, (uint8_t *)&nNonce, sizeof(nNonce));
+        Skein1024_Final(&ctxSkein, (uint8_t *)&hashSkein);
+
+        uint1024_t hashKeccak;
+        Keccak_HashInstance ctxKeccak;
+        Keccak_HashInitialize(&ctxKeccak, 576, 1024, 1024, 0x05);
+        Keccak_HashUpdate(&ctxKeccak, (uint8_t *)&hashSkein, 1024);
+        Keccak_HashFinal(&ctxKeccak, (uint8_t *)&hashKeccak);
+
+        return hashKeccak;
+    }
 }
@@ -838,8 +838,8 @@ namespace std
     {
         size_t operator()(const base_uint<BITS>& val) const
         {
-            /* Base the hash function on the string representation, which is the number converted to hex */
-            return hash<std::string>()(val.ToString());
+            /* The numbers kept in hashed containers are hashes themselves, so the low bits are already uniform. */
+            return static_cast<size_t>(val.Get64());
         }
     };
 }
@@ -0,0 +1,355 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLD_CACHE_FINGERPRINT_CACHE_H
+#define NEXUS_LLD_CACHE_FINGERPRINT_CACHE_H
+
+#include <LLD/hash/xxh3.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+namespace LLD
+{
+
+    /** FingerprintCache
+     *
+     *  Fixed size, direct mapped, lock-free cache from small binary keys to values.
+     *
+     *  Slots are selected by the XXH3 fingerprint of the key, and every slot is guarded by its own
+     *  sequence counter (seqlock) so readers never block and never serialize on a shared mutex.
+     *  The full key is stored in the slot and compared on lookup, so a fingerprint collision is a
+     *  miss and never returns a wrong value. Keys larger than KEY_BYTES are not cached.
+     *
+     *  Writers that find a slot being written by another thread simply drop their entry.
+     *
+     **/
+    template<typename ValueType, uint32_t KEY_BYTES = 64>
+    class FingerprintCache
+    {
+        static_assert(sizeof(ValueType) % 8 == 0, "FingerprintCache values must be a whole number of 64-bit words");
+        static_assert(KEY_BYTES % 8 == 0, "FingerprintCache keys must be a whole number of 64-bit words");
+
+
+        /* Number of 64-bit words in keys and values. */
+        enum
+        {
+            KEY_WORDS   = KEY_BYTES / 8,
+            VALUE_WORDS = sizeof(ValueType) / 8,
+            STRIPES     = 16
+        };
+
+
+        /* Length marking an empty slot. */
+        static const uint64_t EMPTY = ~uint64_t(0);
+
+
+        /** Slot
+         *
+         *  Single cache entry, all fields are atomics so concurrent reads and writes are well defined.
+         *
+         **/
+        struct Slot
+        {
+            /* Sequence counter, odd while a writer owns the slot. */
+            std::atomic<uint64_t> nSequence;
+
+            /* Fingerprint of the key. */
+            std::atomic<uint64_t> nFingerprint;
+
+            /* Length of the key in bytes. */
+            std::atomic<uint64_t> nLength;
+
+            /* Key bytes packed into words and zero padded. */
+            std::atomic<uint64_t> vKey[KEY_WORDS];
+
+            /* Value words. */
+            std::atomic<uint64_t> vValue[VALUE_WORDS];
+        };
+
+
+        /** Stripe
+         *
+         *  Hit and miss counters, striped over cache lines so statistics don't serialize threads.
+         *
+         **/
+        struct alignas(64) Stripe
+        {
+            std::atomic<uint64_t> nHits;
+            std::atomic<uint64_t> nMisses;
+        };
+
+
+        /* Mask to select a slot from a fingerprint. */
+        const uint64_t MASK;
+
+
+        /* The slots of the cache. */
+        std::unique_ptr<Slot[]> pSlots;
+
+
+        /* The statistics stripes. */
+        Stripe vStats[STRIPES];
+
+
+    public:
+
+        /** Default Constructor. **/
+        FingerprintCache()                                         = delete;
+
+
+        /** Copy Constructor. **/
+        FingerprintCache(const FingerprintCache& cache)            = delete;
+
+
+        /** Move Constructor. **/
+        FingerprintCache(FingerprintCache&& cache)                 = delete;
+
+
+        /** Copy assignment. **/
+        FingerprintCache& operator=(const FingerprintCache& cache) = delete;
+
+
+        /** Move assignment. **/
+        FingerprintCache& operator=(FingerprintCache&& cache)      = delete;
+
+
+        /** Total Elements Constructor
+         *
+         *  @param[in] nElements The number of slots, rounded up to a power of two.
+         *
+         **/
+        FingerprintCache(const uint32_t nElements)
+        : MASK   (round_up(nElements) - 1)
+        , pSlots (new Slot[MASK + 1])
+        , vStats ( )
+        {
+            for(uint64_t n = 0; n <= MASK; ++n)
+            {
+                pSlots[n].nSequence.store(0);
+                pSlots[n].nFingerprint.store(0);
+                pSlots[n].nLength.store(EMPTY);
+
+                for(uint32_t i = 0; i < KEY_WORDS; ++i)
+                    pSlots[n].vKey[i].store(0);
+
+                for(uint32_t i = 0; i < VALUE_WORDS; ++i)
+                    pSlots[n].vValue[i].store(0);
+            }
+
+            for(uint32_t n = 0; n < STRIPES; ++n)
+            {
+                vStats[n].nHits.store(0);
+                vStats[n].nMisses.store(0);
+            }
+        }
+
+
+        /** Get
+         *
+         *  Get the value for a key.
+         *
+         *  @param[in] pData The key bytes.
+         *  @param[in] nSize The number of key bytes.
+         *  @param[out] value The value found.
+         *
+         *  @return True if the key was found, false otherwise.
+         *
+         **/
+        bool Get(const uint8_t* pData, const uint64_t nSize, ValueType& value)
+        {
+            /* Keys that are too large are never cached. */
+            if(nSize > KEY_BYTES)
+                return false;
+
+            /* Find our slot. */
+            const uint64_t nFingerprint = XXH3_64bits(pData, nSize);
+            Slot& slot = pSlots[nFingerprint & MASK];
+            Stripe& stats = vStats[nFingerprint >> 60];
+
+            /* Check the slot isn't being written. */
+            const uint64_t nSequence = slot.nSequence.load(std::memory_order_acquire);
+            if((nSequence & 1) || slot.nFingerprint.load(std::memory_order_relaxed) != nFingerprint
+            || slot.nLength.load(std::memory_order_relaxed) != nSize)
+            {
+                stats.nMisses.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            /* Compare the full key. */
+            uint64_t vKey[KEY_WORDS];
+            pack(pData, nSize, vKey);
+            for(uint32_t i = 0; i < (nSize + 7) / 8; ++i)
+            {
+                if(slot.vKey[i].load(std::memory_order_relaxed) != vKey[i])
+                {
+                    stats.nMisses.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+            }
+
+            /* Copy the value out. */
+            uint64_t vValue[VALUE_WORDS];
+            for(uint32_t i = 0; i < VALUE_WORDS; ++i)
+                vValue[i] = slot.vValue[i].load(std::memory_order_relaxed);
+
+            /* Check no writer touched the slot while we were reading. */
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(slot.nSequence.load(std::memory_order_relaxed) != nSequence)
+            {
+                stats.nMisses.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            std::memcpy(reinterpret_cast<uint8_t*>(&value), vValue, sizeof(ValueType));
+            stats.nHits.fetch_add(1, std::memory_order_relaxed);
+
+            return true;
+        }
+
+
+        /** Put
+         *
+         *  Add a value to the cache, replacing whatever was in its slot.
+         *
+         *  @param[in] pData The key bytes.
+         *  @param[in] nSize The number of key bytes.
+         *  @param[in] value The value to cache.
+         *
+         **/
+        void Put(const uint8_t* pData, const uint64_t nSize, const ValueType& value)
+        {
+            /* Keys that are too large are never cached. */
+            if(nSize > KEY_BYTES)
+                return;
+
+            /* Find our slot. */
+            const uint64_t nFingerprint = XXH3_64bits(pData, nSize);
+            Slot& slot = pSlots[nFingerprint & MASK];
+
+            /* Take ownership of the slot, skip the write if another writer has it. */
+            uint64_t nSequence = slot.nSequence.load(std::memory_order_relaxed);
+            if((nSequence & 1) || !slot.nSequence.compare_exchange_strong(nSequence, nSequence + 1, std::memory_order_relaxed))
+                return;
+
+            std::atomic_thread_fence(std::memory_order_release);
+
+            /* Write the key and value. */
+            uint64_t vKey[KEY_WORDS];
+            pack(pData, nSize, vKey);
+
+            uint64_t vValue[VALUE_WORDS];
+            std::memcpy(vValue, reinterpret_cast<const uint8_t*>(&value), sizeof(ValueType));
+
+            slot.nFingerprint.store(nFingerprint, std::memory_order_relaxed);
+            slot.nLength.store(nSize, std::memory_order_relaxed);
+            for(uint32_t i = 0; i < KEY_WORDS; ++i)
+                slot.vKey[i].store(vKey[i], std::memory_order_relaxed);
+
+            for(uint32_t i = 0; i < VALUE_WORDS; ++i)
+                slot.vValue[i].store(vValue[i], std::memory_order_relaxed);
+
+            /* Release the slot. */
+            slot.nSequence.store(nSequence + 2, std::memory_order_release);
+        }
+
+
+        /** Hits
+         *
+         *  @return The total number of cache hits.
+         *
+         **/
+        uint64_t Hits() const
+        {
+            uint64_t nTotal = 0;
+            for(uint32_t n = 0; n < STRIPES; ++n)
+                nTotal += vStats[n].nHits.load(std::memory_order_relaxed);
+
+            return nTotal;
+        }
+
+
+        /** Misses
+         *
+         *  @return The total number of cache misses.
+         *
+         **/
+        uint64_t Misses() const
+        {
+            uint64_t nTotal = 0;
+            for(uint32_t n = 0; n < STRIPES; ++n)
+                nTotal += vStats[n].nMisses.load(std::memory_order_relaxed);
+
+            return nTotal;
+        }
+
+
+        /** HitRate
+         *
+         *  @return The fraction of lookups that were hits, 0 if there were none.
+         *
+         **/
+        double HitRate() const
+        {
+            const uint64_t nHits  = Hits();
+            const uint64_t nTotal = nHits + Misses();
+
+            return nTotal == 0 ? 0.0 : static_cast<double>(nHits) / nTotal;
+        }
+
+
+        /** Slots
+         *
+         *  @return The number of slots in the cache.
+         *
+         **/
+        uint64_t Slots() const
+        {
+            return MASK + 1;
+        }
+
+
+    private:
+
+        /** round_up
+         *
+         *  Round up to the next power of two.
+         *
+         **/
+        static uint64_t round_up(const uint32_t nElements)
+        {
+            uint64_t nSize = 1;
+            while(nSize < nElements)
+                nSize <<= 1;
+
+            return nSize;
+        }
+
+
+        /** pack
+         *
+         *  Pack key bytes into zero padded words.
+         *
+         **/
+        static void pack(const uint8_t* pData, const uint64_t nSize, uint64_t* vKey)
+        {
+            std::memset(vKey, 0, KEY_BYTES);
+            if(nSize > 0)
+                std::memcpy(reinterpret_cast<uint8_t*>(vKey), pData, nSize);
+        }
+    };
+}
+
+#endif
@@ -17,6 +17,7 @@ ________________________________________________________________________________
 #include <LLD/include/version.h>
 
 #include <Util/templates/datastream.h>
+#include <Util/templates/viewstream.h>
 #include <Util/include/filesystem.h>
 #include <Util/include/debug.h>
 #include <Util/include/hex.h>
@@ -167,7 +168,7 @@ namespace LLD
 
                 /* Read the State and Size of Sector Header. */
                 SectorKey cKey;
-                DataStream ssKey(vData, SER_LLD, DATABASE_VERSION);
+                ViewStream ssKey(vData, SER_LLD, DATABASE_VERSION);
                 ssKey >> cKey;
 
 
@@ -364,7 +365,7 @@ namespace LLD
 
 
             /* De-serialize the Header. */
-            DataStream ssHeader(vData, SER_LLD, DATABASE_VERSION);
+            ViewStream ssHeader(vData, SER_LLD, DATABASE_VERSION);
             ssHeader >> cKey;
 
 
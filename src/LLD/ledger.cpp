@@ -30,8 +30,9 @@ namespace LLD
 {
 
     /** The Database Constructor. To determine file location and the Bytes per Record. **/
-    LedgerDB::LedgerDB(const uint8_t nFlagsIn, const uint32_t nBucketsIn, const uint32_t nCacheIn)
-    : SectorDatabase(std::string("_LEDGER")
+    LedgerDB::LedgerDB(const uint8_t nFlagsIn, const uint32_t nBucketsIn, const uint32_t nCacheIn,
+                       const std::string& strNameIn)
+    : SectorDatabase(strNameIn
     , nFlagsIn
     , nBucketsIn
     , nCacheIn)
@@ -522,7 +523,7 @@ namespace LLD
 
 
     /* Write a new event to the ledger database of current txid. */
-    bool LedgerDB::WriteEvent(const uint256_t& hashAddress, const uint512_t& hashTx)
+    bool LedgerDB::WriteEvent(const uint256_t& hashAddress, const uint512_t& hashTx, const TAO::Ledger::Transaction& tx)
     {
         /* Get the current sequence number. */
         uint32_t nSequence = 0;
@@ -533,7 +534,20 @@ namespace LLD
         if(!WriteSequence(hashAddress, nSequence + 1))
             return false;
 
-        return Index(std::make_pair(hashAddress, nSequence), hashTx);
+        if(!Index(std::make_pair(hashAddress, nSequence), hashTx))
+            return false;
+
+        /* Fill the sequence's slot in its chunk, which is written over in place as it never changes size. */
+        const uint32_t nChunk = nSequence / TAO::Ledger::EVENT_CHUNK_SIZE;
+
+        TAO::Ledger::EventChunk chunk;
+        ReadEventChunk(hashAddress, nChunk, chunk);
+
+        std::vector<TAO::Ledger::Event> vEvents;
+        TAO::Ledger::Event::Parse(tx, hashTx, hashAddress, nSequence, vEvents);
+        chunk.Set(nSequence, vEvents);
+
+        return Write(std::make_tuple(std::string("events"), hashAddress, nChunk), chunk);
     }
 
 
@@ -549,7 +563,22 @@ namespace LLD
         if(!WriteSequence(hashAddress, nSequence - 1))
             return false;
 
-        return Erase(std::make_pair(hashAddress, nSequence - 1));
+        if(!Erase(std::make_pair(hashAddress, nSequence - 1)))
+            return false;
+
+        /* Events written before chunks were kept are in none. */
+        const uint32_t nChunk = (nSequence - 1) / TAO::Ledger::EVENT_CHUNK_SIZE;
+
+        TAO::Ledger::EventChunk chunk;
+        if(!ReadEventChunk(hashAddress, nChunk, chunk))
+            return true;
+
+        /* Remove the chunk once it has nothing left. */
+        chunk.Clear(nSequence - 1);
+        if(chunk.Empty())
+            return Erase(std::make_tuple(std::string("events"), hashAddress, nChunk));
+
+        return Write(std::make_tuple(std::string("events"), hashAddress, nChunk), chunk);
     }
 
 
@@ -561,6 +590,13 @@ namespace LLD
     }
 
 
+    /* Reads a chunk of compact events for an address. */
+    bool LedgerDB::ReadEventChunk(const uint256_t& hashAddress, const uint32_t nChunk, TAO::Ledger::EventChunk &chunk)
+    {
+        return Read(std::make_tuple(std::string("events"), hashAddress, nChunk), chunk);
+    }
+
+
     /* Writes the last txid of sigchain to disk indexed by genesis. */
     bool LedgerDB::WriteLast(const uint256_t& hashGenesis, const uint512_t& hashLast)
     {
@@ -19,8 +19,9 @@ namespace LLD
 {
 
     /** The Database Constructor. To determine file location and the Bytes per Record. **/
-    LegacyDB::LegacyDB(const uint8_t nFlagsIn, const uint32_t nBucketsIn, const uint32_t nCacheIn)
-    : SectorDatabase(std::string("_LEGACY")
+    LegacyDB::LegacyDB(const uint8_t nFlagsIn, const uint32_t nBucketsIn, const uint32_t nCacheIn,
+                       const std::string& strNameIn)
+    : SectorDatabase(strNameIn
     , nFlagsIn
     , nBucketsIn
     , nCacheIn)
@@ -26,6 +26,7 @@ namespace LLD
     , nCacheIn)
 
     , MEMORY_MUTEX()
+    , MINER_MUTEX()
     , pMemory(nullptr)
     , pMiner(nullptr)
     , pCommit(new RegisterTransaction())
@@ -58,6 +59,9 @@ namespace LLD
         /* Memory mode for pre-database commits. */
         if(nFlags == TAO::Ledger::FLAGS::MEMPOOL)
         {
+            /* Copy the state before locking, the replaced state is freed after unlocking. */
+            std::shared_ptr<const TAO::Register::State> pState = std::make_shared<const TAO::Register::State>(state);
+
             LOCK(MEMORY_MUTEX);
 
             /* Check for memory mode. */
@@ -65,24 +69,30 @@ namespace LLD
             {
                 /* Check erase queue. */
                 pMemory->setErase.erase(hashRegister);
-                pMemory->mapStates[hashRegister] = state;
+                pMemory->mapStates[hashRegister].swap(pState);
 
+                lk.unlock();
                 return true;
             }
 
             /* Otherwise commit like normal. */
-            pCommit->mapStates[hashRegister] = state;
+            pCommit->mapStates[hashRegister].swap(pState);
 
+            lk.unlock();
             return true;
         }
         else if(nFlags == TAO::Ledger::FLAGS::MINER)
         {
-            LOCK(MEMORY_MUTEX);
+            /* Copy the state before locking, the replaced state is freed after unlocking. */
+            std::shared_ptr<const TAO::Register::State> pState = std::make_shared<const TAO::Register::State>(state);
+
+            LOCK(MINER_MUTEX);
 
             /* Check for memory mode. */
             if(pMiner)
-                pMiner->mapStates[hashRegister] = state;
+                pMiner->mapStates[hashRegister].swap(pState);
 
+            lk.unlock();
             return true;
         }
         else if(nFlags == TAO::Ledger::FLAGS::BLOCK || nFlags == TAO::Ledger::FLAGS::ERASE)
@@ -90,11 +100,11 @@ namespace LLD
             LOCK(MEMORY_MUTEX);
 
             /* Remove the memory state if writing the disk state. */
-            if(pCommit->mapStates.count(hashRegister))
+            auto it = pCommit->mapStates.find(hashRegister);
+            if(it != pCommit->mapStates.end())
             {
                 /* Check for most recent memory state, and remove if writing it. */
-                const TAO::Register::State& stateCheck = pCommit->mapStates[hashRegister];
-                if(stateCheck == state || nFlags == TAO::Ledger::FLAGS::ERASE)
+                if(*it->second == state || nFlags == TAO::Ledger::FLAGS::ERASE)
                 {
                     /* Erase if transaction. */
                     if(pMemory)
@@ -168,41 +178,13 @@ namespace LLD
     /* Read a state register from the register database. */
     bool RegisterDB::ReadState(const uint256_t& hashRegister, TAO::Register::State& state, const uint8_t nFlags)
     {
-        /* Memory mode for pre-database commits. */
-        if(nFlags == TAO::Ledger::FLAGS::MEMPOOL)
+        /* Check the memory states, copying the state out after the lock is released. */
+        std::shared_ptr<const TAO::Register::State> pState;
+        if(find_state(hashRegister, pState, nFlags))
         {
-            LOCK(MEMORY_MUTEX);
-
-            /* Check for a memory transaction first */
-            if(pMemory && pMemory->mapStates.count(hashRegister))
-            {
-                /* Get the state from temporary transaction. */
-                state = pMemory->mapStates[hashRegister];
-
-                return true;
-            }
+            state = *pState;
 
-            /* Check for state in memory map. */
-            if(pCommit->mapStates.count(hashRegister))
-            {
-                /* Get the state from commited memory. */
-                state = pCommit->mapStates[hashRegister];
-
-                return true;
-            }
-        }
-        else if(nFlags == TAO::Ledger::FLAGS::MINER)
-        {
-            LOCK(MEMORY_MUTEX);
-
-            /* Check for a memory transaction first */
-            if(pMiner && pMiner->mapStates.count(hashRegister))
-            {
-                /* Get the state from temporary transaction. */
-                state = pMiner->mapStates[hashRegister];
-
-                return true;
-            }
+            return true;
         }
 
         return Read(std::make_pair(std::string("state"), hashRegister), state);
@@ -298,41 +280,13 @@ namespace LLD
         uint256_t hashRegister =
             TAO::Register::Address(std::string("trust"), hashGenesis, TAO::Register::Address::TRUST);
 
-        /* Memory mode for pre-database commits. */
-        if(nFlags == TAO::Ledger::FLAGS::MEMPOOL)
-        {
-            LOCK(MEMORY_MUTEX);
-
-            /* Check for a memory transaction first */
-            if(pMemory && pMemory->mapStates.count(hashRegister))
-            {
-                /* Get the state from temporary transaction. */
-                state = pMemory->mapStates[hashRegister];
-
-                return true;
-            }
-
-            /* Check for state in memory map. */
-            if(pCommit->mapStates.count(hashRegister))
-            {
-                /* Get the state from commited memory. */
-                state = pCommit->mapStates[hashRegister];
-
-                return true;
-            }
-        }
-        else if(nFlags == TAO::Ledger::FLAGS::MINER)
+        /* Check the memory states, copying the state out after the lock is released. */
+        std::shared_ptr<const TAO::Register::State> pState;
+        if(find_state(hashRegister, pState, nFlags))
         {
-            LOCK(MEMORY_MUTEX);
-
-            /* Check for a memory transaction first */
-            if(pMiner && pMiner->mapStates.count(hashRegister))
-            {
-                /* Get the state from temporary transaction. */
-                state = pMiner->mapStates[hashRegister];
+            state = *pState;
 
-                return true;
-            }
+            return true;
         }
 
         return Read(std::make_pair(std::string("genesis"), hashGenesis), state);
@@ -353,27 +307,10 @@ namespace LLD
     /* Determines if a state exists in the register database. */
     bool RegisterDB::HasState(const uint256_t& hashRegister, const uint8_t nFlags)
     {
-        /* Memory mode for pre-database commits. */
-        if(nFlags == TAO::Ledger::FLAGS::MEMPOOL)
-        {
-            LOCK(MEMORY_MUTEX);
-
-            /* Check internal memory state. */
-            if(pMemory && pMemory->mapStates.count(hashRegister))
-                return true;
-
-            /* Check for state in memory map. */
-            if(pCommit->mapStates.count(hashRegister))
-                return true;
-        }
-        else if(nFlags == TAO::Ledger::FLAGS::MINER)
-        {
-            LOCK(MEMORY_MUTEX);
-
-            /* Check internal memory state. */
-            if(pMiner && pMiner->mapStates.count(hashRegister))
-                return true;
-        }
+        /* Check the memory states. */
+        std::shared_ptr<const TAO::Register::State> pState;
+        if(find_state(hashRegister, pState, nFlags))
+            return true;
 
         return Exists(std::make_pair(std::string("state"), hashRegister));
     }
@@ -381,72 +318,115 @@ namespace LLD
     /* Begin a memory transaction following ACID properties. */
     void RegisterDB::MemoryBegin(const uint8_t nFlags)
     {
-        LOCK(MEMORY_MUTEX);
+        /* The replaced transaction is freed after unlocking. */
+        RegisterTransaction* pOld = nullptr;
 
         /* Check for miner. */
         if(nFlags == TAO::Ledger::FLAGS::MINER)
         {
-            /* Set the pre-commit memory mode. */
-            if(pMiner)
-                delete pMiner;
+            LOCK(MINER_MUTEX);
 
+            /* Set the pre-commit memory mode. */
+            pOld   = pMiner;
             pMiner = new RegisterTransaction();
-
-            return;
         }
+        else
+        {
+            LOCK(MEMORY_MUTEX);
 
-        /* Set the pre-commit memory mode. */
-        if(pMemory)
-            delete pMemory;
+            /* Set the pre-commit memory mode. */
+            pOld    = pMemory;
+            pMemory = new RegisterTransaction();
+        }
 
-        pMemory = new RegisterTransaction();
+        if(pOld)
+            delete pOld;
     }
 
 
     /* Abort a memory transaction following ACID properties. */
     void RegisterDB::MemoryRelease(const uint8_t nFlags)
     {
-        LOCK(MEMORY_MUTEX);
+        /* The released transaction is freed after unlocking. */
+        RegisterTransaction* pOld = nullptr;
 
         /* Check for miner. */
         if(nFlags == TAO::Ledger::FLAGS::MINER)
         {
-            /* Set the pre-commit memory mode. */
-            if(pMiner)
-                delete pMiner;
+            LOCK(MINER_MUTEX);
 
+            /* Set the pre-commit memory mode. */
+            pOld   = pMiner;
             pMiner = nullptr;
-
-            return;
         }
+        else
+        {
+            LOCK(MEMORY_MUTEX);
 
-        /* Set the pre-commit memory mode. */
-        if(pMemory)
-            delete pMemory;
+            /* Set the pre-commit memory mode. */
+            pOld    = pMemory;
+            pMemory = nullptr;
+        }
 
-        pMemory = nullptr;
+        if(pOld)
+            delete pOld;
     }
 
 
     /* Commit a memory transaction following ACID properties. */
     void RegisterDB::MemoryCommit()
     {
-        LOCK(MEMORY_MUTEX);
+        /* The commited transaction is freed after unlocking. */
+        RegisterTransaction* pOld = nullptr;
 
-        /* Abort the current memory mode. */
-        if(pMemory)
         {
-            /* Loop through all new states and apply to commit data. */
-            for(const auto& state : pMemory->mapStates)
-                pCommit->mapStates[state.first] = state.second;
+            LOCK(MEMORY_MUTEX);
 
-            /* Loop through values to erase. */
-            for(const auto& erase : pMemory->setErase)
-                pCommit->mapStates.erase(erase);
+            /* Abort the current memory mode. */
+            if(pMemory)
+            {
+                /* Loop through all new states and move them to commit data, the states themselves are shared. */
+                for(auto& state : pMemory->mapStates)
+                    pCommit->mapStates[state.first].swap(state.second);
 
-            /* Free the memory. */
-            delete pMemory;
-            pMemory = nullptr;
+                /* Loop through values to erase. */
+                for(const auto& erase : pMemory->setErase)
+                    pCommit->mapStates.erase(erase);
+
+                pOld    = pMemory;
+                pMemory = nullptr;
+            }
         }
+
+        if(pOld)
+            delete pOld;
+    }
+
+
+    /* Find a state in the memory transactions for the given flags. */
+    bool RegisterDB::find_state(const uint256_t& hashRegister,
+                                std::shared_ptr<const TAO::Register::State> &pState, const uint8_t nFlags)
+    {
+        /* Memory mode for pre-database commits. */
+        if(nFlags == TAO::Ledger::FLAGS::MEMPOOL)
+        {
+            LOCK(MEMORY_MUTEX);
+
+            /* Check for a memory transaction first */
+            if(pMemory && pMemory->Find(hashRegister, pState))
+                return true;
+
+            /* Check for state in memory map. */
+            return pCommit->Find(hashRegister, pState);
+        }
+        else if(nFlags == TAO::Ledger::FLAGS::MINER)
+        {
+            LOCK(MINER_MUTEX);
+
+            /* Check for a memory transaction first */
+            return (pMiner && pMiner->Find(hashRegister, pState));
+        }
+
+        return false;
     }
 }
@@ -29,6 +29,16 @@ ________________________________________________________________________________
 namespace LLD
 {
 
+    /* Get the directory of a database, using names that are absolute paths as they are. */
+    static std::string location(const std::string& strName)
+    {
+        if(!strName.empty() && (strName[0] == '/' || strName[0] == '\\' || (strName.size() > 1 && strName[1] == ':')))
+            return strName;
+
+        return config::GetDataDir() + strName;
+    }
+
+
     /* The Database Constructor. To determine file location and the Bytes per Record. */
     template<class KeychainType, class CacheType>
     SectorDatabase<KeychainType, CacheType>::SectorDatabase(const std::string& strNameIn,
@@ -39,11 +49,11 @@ namespace LLD
     , SECTOR_MUTEX()
     , BUFFER_MUTEX()
     , TRANSACTION_MUTEX()
-    , strBaseLocation(config::GetDataDir() + strNameIn + "/datachain/")
+    , strBaseLocation(location(strNameIn) + "/datachain/")
     , strName(strNameIn)
     , runtime()
     , pTransaction(nullptr)
-    , pSectorKeys(new KeychainType((config::GetDataDir() + strName + "/keychain/"), nFlagsIn, nBucketsIn))
+    , pSectorKeys(new KeychainType((location(strNameIn) + "/keychain/"), nFlagsIn, nBucketsIn))
     , cachePool(new CacheType(nCacheIn))
     , fileCache(new TemplateLRU<uint32_t, std::fstream*>(8))
     , nCurrentFile(0)
@@ -58,6 +68,14 @@ namespace LLD
     , fDestruct(false)
     , fInitialized(false)
     , nFlags(nFlagsIn)
+    , metricGet(metrics::GetHistogram("nexus_lld_get_seconds", "LLD record read latency.", "db=\"" + strNameIn + "\""))
+    , metricPut(metrics::GetHistogram("nexus_lld_put_seconds", "LLD record write latency, including waits on a full disk buffer.", "db=\"" + strNameIn + "\""))
+    , metricFlush(metrics::GetHistogram("nexus_lld_flush_seconds", "LLD disk buffer flush latency.", "db=\"" + strNameIn + "\""))
+    , metricCacheHits(metrics::GetCounter("nexus_lld_cache_hits_total", "LLD record cache hits.", "db=\"" + strNameIn + "\""))
+    , metricCacheMisses(metrics::GetCounter("nexus_lld_cache_misses_total", "LLD record cache misses.", "db=\"" + strNameIn + "\""))
+    , metricRecordsFlushed(metrics::GetCounter("nexus_lld_records_flushed_total", "LLD records written to disk.", "db=\"" + strNameIn + "\""))
+    , metricBytesRead(metrics::GetCounter("nexus_lld_read_bytes_total", "LLD bytes read from disk.", "db=\"" + strNameIn + "\""))
+    , metricBytesWritten(metrics::GetCounter("nexus_lld_written_bytes_total", "LLD bytes written to disk.", "db=\"" + strNameIn + "\""))
     {
         /* Set readonly flag if write or append are not specified. */
         if(!(nFlags & FLAGS::FORCE) && !(nFlags & FLAGS::WRITE) && !(nFlags & FLAGS::APPEND))
@@ -153,12 +171,19 @@ namespace LLD
     template<class KeychainType, class CacheType>
     bool SectorDatabase<KeychainType, CacheType>::Get(const std::vector<uint8_t>& vKey, std::vector<uint8_t>& vData)
     {
+        metrics::Timer timer(metricGet);
+
         /* Iterate if meters are enabled. */
         nBytesRead += static_cast<uint32_t>(vKey.size() + vData.size());
 
         /* Check the cache pool for key first. */
         if(cachePool->Get(vKey, vData))
+        {
+            metricCacheHits.Add();
             return true;
+        }
+
+        metricCacheMisses.Add();
 
         /* Get the key from the keychain. */
         SectorKey cKey;
@@ -196,6 +221,7 @@ namespace LLD
                 if(!pstream->read((char*) &vData[0], vData.size()))
                     return debug::error(FUNCTION, "only ", pstream->gcount(), "/", vData.size(), " bytes read");
 
+                metricBytesRead.Add(vData.size());
             }
 
             /* Add to cache */
@@ -225,7 +251,12 @@ namespace LLD
 
             /* Check the cache pool for key first. */
             if(cachePool->Get(cKey.vKey, vData))
+            {
+                metricCacheHits.Add();
                 return true;
+            }
+
+            metricCacheMisses.Add();
 
             /* Find the file stream for LRU cache. */
             std::fstream *pstream;
@@ -256,6 +287,8 @@ namespace LLD
             if(!pstream->read((char*) &vData[0], vData.size()))
                 return debug::error(FUNCTION, "only ", pstream->gcount(), "/", vData.size(), " bytes read");
 
+            metricBytesRead.Add(vData.size());
+
             /* Verboe output. */
             if(config::nVerbose >= 5)
                 debug::log(5, FUNCTION, "Current File: ", cKey.nSectorFile,
@@ -320,6 +353,9 @@ namespace LLD
             ++nRecordsFlushed;
             nBytesWrote += static_cast<uint32_t>(vData.size());
 
+            metricRecordsFlushed.Add();
+            metricBytesWritten.Add(vData.size());
+
             /* Verbose output. */
             if(config::nVerbose >= 5)
                 debug::log(5, FUNCTION, "Current File: ", key.nSectorFile,
@@ -399,6 +435,9 @@ namespace LLD
             ++nRecordsFlushed;
             nBytesWrote += static_cast<uint32_t>(nSize);
 
+            metricRecordsFlushed.Add();
+            metricBytesWritten.Add(nSize);
+
             /* Assign the Key to Keychain. */
             if(!pSectorKeys->Put(key))
                 return debug::error(FUNCTION, "failed to write key to keychain");
@@ -420,6 +459,8 @@ namespace LLD
     template<class KeychainType, class CacheType>
     bool SectorDatabase<KeychainType, CacheType>::Put(const std::vector<uint8_t>& vKey, const std::vector<uint8_t>& vData)
     {
+        metrics::Timer timer(metricPut);
+
         /* Handle force write mode. */
         if(nFlags & FLAGS::FORCE)
             return Force(vKey, vData);
@@ -560,6 +601,9 @@ namespace LLD
                 stream.close();
             }
 
+            /* Time the flush for the metrics registry. */
+            metrics::Timer timer(metricFlush);
+
             /* Iterate through buffer to queue disk writes. */
             for(const auto& vObj : vIndexes)
             {
@@ -655,7 +699,7 @@ namespace LLD
         pTransaction->ssJournal << std::string("commit");
 
         /* Create an append only stream. */
-        std::ofstream stream = std::ofstream(debug::safe_printstr(config::GetDataDir(), strName, "/journal.dat"), std::ios::app | std::ios::binary);
+        std::ofstream stream = std::ofstream(debug::safe_printstr(location(strName), "/journal.dat"), std::ios::app | std::ios::binary);
         if(!stream.is_open())
             return debug::error(FUNCTION, "failed to open journal file");
 
@@ -682,7 +726,7 @@ namespace LLD
         pTransaction = nullptr;
 
         /* Delete the transaction journal file. */
-        std::ofstream stream(debug::safe_printstr(config::GetDataDir(), strName, "/journal.dat"), std::ios::trunc);
+        std::ofstream stream(debug::safe_printstr(location(strName), "/journal.dat"), std::ios::trunc);
         stream.close();
     }
 
@@ -750,7 +794,7 @@ namespace LLD
     bool SectorDatabase<KeychainType, CacheType>::TxnRecovery()
     {
         /* Create an append only stream. */
-        std::ifstream stream(debug::safe_printstr(config::GetDataDir(), strName, "/journal.dat"), std::ios::in | std::ios::out | std::ios::binary);
+        std::ifstream stream(debug::safe_printstr(location(strName), "/journal.dat"), std::ios::in | std::ios::out | std::ios::binary);
         if(!stream.is_open())
             return false;
 
@@ -17,6 +17,7 @@ ________________________________________________________________________________
 #include <LLD/hash/xxh3.h>
 
 #include <Util/templates/datastream.h>
+#include <Util/templates/viewstream.h>
 #include <Util/include/filesystem.h>
 #include <Util/include/debug.h>
 #include <Util/include/hex.h>
@@ -306,7 +307,7 @@ namespace LLD
             if(std::equal(vBucket.begin() + 13, vBucket.begin() + 13 + vKeyCompressed.size(), vKeyCompressed.begin()))
             {
                 /* Deserialie key and return if found. */
-                DataStream ssKey(vBucket, SER_LLD, DATABASE_VERSION);
+                ViewStream ssKey(vBucket, SER_LLD, DATABASE_VERSION);
                 ssKey >> cKey;
 
                 /* Check if the key is ready. */
@@ -392,7 +393,7 @@ namespace LLD
             if(std::equal(vBucket.begin() + 13, vBucket.begin() + 13 + vKeyCompressed.size(), vKeyCompressed.begin()))
             {
                 /* Deserialize key and return if found. */
-                DataStream ssKey(vBucket, SER_LLD, DATABASE_VERSION);
+                ViewStream ssKey(vBucket, SER_LLD, DATABASE_VERSION);
                 SectorKey cKey;
                 ssKey >> cKey;
 
@@ -680,7 +681,7 @@ namespace LLD
             if(std::equal(vBucket.begin() + 13, vBucket.begin() + 13 + vKeyCompressed.size(), vKeyCompressed.begin()))
             {
                 /* Deserialize key and return if found. */
-                DataStream ssKey(vBucket, SER_LLD, DATABASE_VERSION);
+                ViewStream ssKey(vBucket, SER_LLD, DATABASE_VERSION);
                 SectorKey cKey;
                 ssKey >> cKey;
 
@@ -766,7 +767,7 @@ namespace LLD
             if(std::equal(vBucket.begin() + 13, vBucket.begin() + 13 + vKeyCompressed.size(), vKeyCompressed.begin()))
             {
                 /* Deserialize key and return if found. */
-                DataStream ssKey(vBucket, SER_LLD, DATABASE_VERSION);
+                ViewStream ssKey(vBucket, SER_LLD, DATABASE_VERSION);
                 SectorKey cKey;
                 ssKey >> cKey;
 
@@ -24,8 +24,10 @@ ________________________________________________________________________________
 #include <LLD/cache/template_lru.h>
 
 #include <Util/templates/datastream.h>
+#include <Util/templates/viewstream.h>
 #include <Util/include/runtime.h>
 #include <Util/include/debug.h>
+#include <Util/include/metrics.h>
 
 #include <string>
 #include <cstdint>
@@ -158,6 +160,31 @@ namespace LLD
         uint8_t nFlags;
 
 
+        /* Read and write latencies for the metrics registry. */
+        metrics::Histogram& metricGet;
+        metrics::Histogram& metricPut;
+        metrics::Histogram& metricFlush;
+
+
+        /* Cache and disk counters for the metrics registry. */
+        metrics::Counter& metricCacheHits;
+        metrics::Counter& metricCacheMisses;
+        metrics::Counter& metricRecordsFlushed;
+        metrics::Counter& metricBytesRead;
+        metrics::Counter& metricBytesWritten;
+
+
+        /* Get the calling thread's stream for serializing keys, emptied for a new key. The stream keeps its
+         * capacity, so keys serialize without allocating once a thread has used the database. */
+        static DataStream& key_stream()
+        {
+            static thread_local DataStream ssKey(SER_LLD, DATABASE_VERSION);
+            ssKey.SetNull();
+
+            return ssKey;
+        }
+
+
     public:
 
 
@@ -191,7 +218,7 @@ namespace LLD
         bool Exists(const Key& key)
         {
             /* Serialize Key into Bytes. */
-            DataStream ssKey(SER_LLD, DATABASE_VERSION);
+            DataStream& ssKey = key_stream();
             ssKey << key;
 
             /* Get reference of key. */
@@ -247,7 +274,7 @@ namespace LLD
                 return debug::error("Erase called on database in read-only mode");
 
             /* Serialize Key into Bytes. */
-            DataStream ssKey(SER_LLD, DATABASE_VERSION);
+            DataStream& ssKey = key_stream();
             ssKey << key;
 
             /* Remove the item from the cache pool. */
@@ -309,7 +336,7 @@ namespace LLD
             std::vector<Type>& vValues, int32_t nLimit = 1000, bool fExclude = true)
         {
             /* Serialize Key into Bytes. */
-            DataStream ssKey(SER_LLD, DATABASE_VERSION);
+            DataStream& ssKey = key_stream();
             ssKey << key;
 
             /* Get the key. */
@@ -454,7 +481,7 @@ namespace LLD
         bool Read(const Key& key, Type& value)
         {
             /* Serialize Key into Bytes. */
-            DataStream ssKey(SER_LLD, DATABASE_VERSION);
+            DataStream& ssKey = key_stream();
             ssKey << key;
 
             /* Get the Data from Sector Database. */
@@ -477,13 +504,11 @@ namespace LLD
                         vKey = pTransaction->mapIndex[vKey];
 
                     /* Check if the new data is set in a transaction to ensure that the database knows what is in volatile memory. */
-                    if(pTransaction->mapTransactions.count(vKey))
+                    auto it = pTransaction->mapTransactions.find(vKey);
+                    if(it != pTransaction->mapTransactions.end())
                     {
-                        /* Get the data from the transction object. */
-                        vData = pTransaction->mapTransactions[vKey];
-
-                        /* Deserialize Value. */
-                        DataStream ssValue(vData, SER_LLD, DATABASE_VERSION);
+                        /* Deserialize Value in place, the transaction is locked. */
+                        const ViewStream ssValue(it->second, SER_LLD, DATABASE_VERSION);
 
                         /* Deserialize the String. */
                         std::string strType;
@@ -501,8 +526,8 @@ namespace LLD
             if(!Get(vKey, vData))
                 return false;
 
-            /* Deserialize Value. */
-            DataStream ssValue(vData, SER_LLD, DATABASE_VERSION);
+            /* Deserialize Value without copying it. */
+            const ViewStream ssValue(vData, SER_LLD, DATABASE_VERSION);
 
             /* Deserialize the String. */
             std::string strType;
@@ -529,7 +554,7 @@ namespace LLD
         bool Index(const Key& key, const Type& index)
         {
             /* Serialize Key into Bytes. */
-            DataStream ssKey(SER_LLD, DATABASE_VERSION);
+            DataStream& ssKey = key_stream();
             ssKey << key;
 
             /* Serialize the index into bytes. */
@@ -589,7 +614,7 @@ namespace LLD
                 return debug::error(FUNCTION, "Write called on database in read-only mode");
 
             /* Serialize Key into Bytes. */
-            DataStream ssKey(SER_LLD, DATABASE_VERSION);
+            DataStream& ssKey = key_stream();
             ssKey << key;
 
             /* Get reference of key. */
@@ -637,7 +662,7 @@ namespace LLD
                 return debug::error(FUNCTION, "Write called on database in read-only mode");
 
             /* Serialize the Key. */
-            DataStream ssKey(SER_LLD, DATABASE_VERSION);
+            DataStream& ssKey = key_stream();
             ssKey << key;
 
             /* Serialize the Value */
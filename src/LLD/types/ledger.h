@@ -26,8 +26,10 @@ ________________________________________________________________________________
 #include <TAO/Register/types/state.h>
 
 #include <TAO/Ledger/include/enum.h>
+#include <TAO/Ledger/types/event.h>
 
 #include <Util/include/memory.h>
+#include <Util/templates/flatmap.h>
 
 #include <tuple>
 
@@ -55,13 +57,27 @@ namespace LLD
     {
     public:
 
+        /** ClaimHasher
+         *
+         *  Hash functor for claims, mixing the contract into the transaction id.
+         *
+         **/
+        struct ClaimHasher
+        {
+            size_t operator()(const std::pair<uint512_t, uint32_t>& pair) const
+            {
+                return static_cast<size_t>(pair.first.Get64() ^ (uint64_t(pair.second) * 0x9e3779b97f4a7c15));
+            }
+        };
+
+
         /** Collection of proofs to be written to database. **/
         std::set<std::tuple<uint256_t, uint512_t, uint32_t>> setProofs;
         std::set<std::tuple<uint256_t, uint512_t, uint32_t>> setEraseProofs;
 
 
         /** Collection of claims to be written to database. **/
-        std::map<std::pair<uint512_t, uint32_t>, uint64_t> mapClaims;
+        FlatMap<std::pair<uint512_t, uint32_t>, uint64_t, ClaimHasher> mapClaims;
         std::set<std::pair<uint512_t, uint32_t>>           setEraseClaims;
 
     };
@@ -94,9 +110,12 @@ namespace LLD
     public:
 
 
-        /** The Database Constructor. To determine file location and the Bytes per Record. **/
+        /** The Database Constructor. To determine file location and the Bytes per Record.
+         *  The name is the directory in the data directory, or an absolute path to open another node's database.
+         **/
         LedgerDB(const uint8_t nFlagsIn = FLAGS::CREATE | FLAGS::WRITE,
-            const uint32_t nBucketsIn = 77773, const uint32_t nCacheIn = 1024 * 1024);
+            const uint32_t nBucketsIn = 77773, const uint32_t nCacheIn = 1024 * 1024,
+            const std::string& strNameIn = "_LEDGER");
 
 
         /** Default Destructor **/
@@ -433,14 +452,16 @@ namespace LLD
         /** WriteEvent
          *
          *  Write a new event to the ledger database of current txid.
+         *  The contracts that raised the event are kept in the address's event chunk for the sequence too.
          *
          *  @param[in] hashAddress The event address to write.
          *  @param[in] hashTx The transaction event is triggering.
+         *  @param[in] tx The transaction event is triggering, to get the event's contracts from.
          *
          *  @return True if the write was successful.
          *
          **/
-        bool WriteEvent(const uint256_t& hashAddress, const uint512_t& hashTx);
+        bool WriteEvent(const uint256_t& hashAddress, const uint512_t& hashTx, const TAO::Ledger::Transaction& tx);
 
 
         /** EraseEvent
@@ -470,6 +491,21 @@ namespace LLD
         bool ReadEvent(const uint256_t& hashAddress, const uint32_t nSequence, TAO::Ledger::Transaction &tx);
 
 
+        /** ReadEventChunk
+         *
+         *  Reads a chunk of compact events for an address, covering EVENT_CHUNK_SIZE sequence numbers.
+         *  Events written before chunks were kept are not in any chunk and must be read with ReadEvent.
+         *
+         *  @param[in] hashAddress The event address to read.
+         *  @param[in] nChunk The chunk number, which is the sequence number divided by EVENT_CHUNK_SIZE.
+         *  @param[out] chunk The chunk of events.
+         *
+         *  @return True if the chunk exists.
+         *
+         **/
+        bool ReadEventChunk(const uint256_t& hashAddress, const uint32_t nChunk, TAO::Ledger::EventChunk &chunk);
+
+
         /** WriteLast
          *
          *  Writes the last txid of sigchain to disk indexed by genesis.
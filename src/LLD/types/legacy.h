@@ -38,9 +38,12 @@ namespace LLD
     public:
 
 
-        /** The Database Constructor. To determine file location and the Bytes per Record. **/
+        /** The Database Constructor. To determine file location and the Bytes per Record.
+         *  The name is the directory in the data directory, or an absolute path to open another node's database.
+         **/
         LegacyDB(const uint8_t nFlagsIn = FLAGS::CREATE | FLAGS::WRITE,
-            const uint32_t nBucketsIn = 77773, const uint32_t nCacheIn = 1024 * 1024);
+            const uint32_t nBucketsIn = 77773, const uint32_t nCacheIn = 1024 * 1024,
+            const std::string& strNameIn = "_LEGACY");
 
 
         /** Default Destructor **/
@@ -25,6 +25,10 @@ ________________________________________________________________________________
 
 #include <TAO/Ledger/include/enum.h>
 
+#include <Util/templates/flatmap.h>
+
+#include <memory>
+
 namespace LLD
 {
 
@@ -32,18 +36,43 @@ namespace LLD
      *
      *  Helper class for managing memory states in register database.
      *
+     *  States are immutable once written and shared by pointer, so a write replaces the pointer and readers
+     *  only hold the lock long enough to take a reference, copying the state after the lock is released.
+     *
      **/
     class RegisterTransaction
     {
     public:
 
         /** Map of states that are stored in memory mode until commited. **/
-        std::map<uint256_t, TAO::Register::State> mapStates;
+        FlatMap<uint256_t, std::shared_ptr<const TAO::Register::State>> mapStates;
 
 
         /** Set of indexes to remove during commit. **/
         std::set<uint256_t> setErase;
 
+
+        /** Find
+         *
+         *  Get a reference to a state in this transaction.
+         *
+         *  @param[in] hashRegister The register address.
+         *  @param[out] pState The shared state found.
+         *
+         *  @return True if the state is in this transaction.
+         *
+         **/
+        bool Find(const uint256_t& hashRegister, std::shared_ptr<const TAO::Register::State> &pState) const
+        {
+            auto it = mapStates.find(hashRegister);
+            if(it == mapStates.end())
+                return false;
+
+            pState = it->second;
+
+            return true;
+        }
+
     };
 
 
@@ -59,6 +88,10 @@ namespace LLD
         std::mutex MEMORY_MUTEX;
 
 
+        /** Miner mutex to lock when accessing the miner states, so template building doesn't block the mempool. **/
+        std::mutex MINER_MUTEX;
+
+
         /** Register transaction to track current open transaction. **/
         RegisterTransaction* pMemory;
 
@@ -71,6 +104,21 @@ namespace LLD
         RegisterTransaction* pCommit;
 
 
+        /** find_state
+         *
+         *  Find a state in the memory transactions that apply to the given flags.
+         *
+         *  @param[in] hashRegister The register address.
+         *  @param[out] pState The shared state found.
+         *  @param[in] nFlags The flags from ledger.
+         *
+         *  @return True if a memory state was found.
+         *
+         **/
+        bool find_state(const uint256_t& hashRegister,
+                        std::shared_ptr<const TAO::Register::State> &pState, const uint8_t nFlags);
+
+
     public:
 
 
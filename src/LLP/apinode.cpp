@@ -18,10 +18,13 @@ ________________________________________________________________________________
 #include <TAO/API/types/exception.h>
 #include <TAO/API/include/global.h>
 
+#include <Util/include/arena.h>
 #include <Util/include/string.h>
 #include <Util/include/urlencode.h>
 #include <Util/include/config.h>
 #include <Util/include/base64.h>
+#include <Util/include/metrics.h>
+#include <Util/include/trace.h>
 
 namespace LLP
 {
@@ -90,12 +93,30 @@ namespace LLP
             return false;
         }
 
+        /* Export the metrics registry in the Prometheus text format. */
+        if(INCOMING.strType == "GET" && INCOMING.strRequest == "/metrics")
+        {
+            HTTPPacket RESPONSE(200);
+            RESPONSE.mapHeaders["Content-Type"] = "text/plain; version=0.0.4";
+            RESPONSE.strContent = metrics::Prometheus();
+
+            this->WritePacket(RESPONSE);
+
+            return true;
+        }
+
         /* Parse the packet request. */
         std::string::size_type npos = INCOMING.strRequest.find('/', 1);
 
         /* Extract the API requested. */
         std::string strAPI = INCOMING.strRequest.substr(1, npos - 1);
 
+        /* Trace the request by API only, as the rest of the URL can hold parameters. */
+        trace::Span span("API", strAPI);
+
+        /* Temporaries of the request are allocated from an arena released when it is answered. */
+        ArenaScope arena;
+
         /* Extract the method to invoke. */
         std::string METHOD = INCOMING.strRequest.substr(npos + 1);
 
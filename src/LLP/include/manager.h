@@ -16,6 +16,7 @@ ________________________________________________________________________________
 #define NEXUS_LLP_INCLUDE_MANAGER_H
 
 #include <LLP/include/trust_address.h>
+#include <Util/templates/flatmap.h>
 #include <map>
 #include <vector>
 #include <cstdint>
@@ -180,7 +181,7 @@ namespace LLP
          *  @param[in] addr The address to find.
          *
          **/
-        const LLP::TrustAddress& Get(const BaseAddress &addr);
+        LLP::TrustAddress Get(const BaseAddress &addr);
 
 
         /** GetState
@@ -366,7 +367,7 @@ namespace LLP
     private:
 
         /* The map of trust addresses to track. */
-        std::map<uint64_t, TrustAddress> mapTrustAddress;
+        FlatMap<uint64_t, TrustAddress> mapTrustAddress;
 
         /* The map of banned addresses to ignore. */
         std::map<uint64_t, uint32_t> mapBanned;
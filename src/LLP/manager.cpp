@@ -207,7 +207,7 @@ namespace LLP
     }
 
     /* Gets a TrustAddress from the BaseAddress */
-    const LLP::TrustAddress& AddressManager::Get(const BaseAddress &addr)
+    LLP::TrustAddress AddressManager::Get(const BaseAddress &addr)
     {
         uint64_t hash = addr.GetHash();
         LOCK(MUTEX);
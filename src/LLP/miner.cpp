@@ -795,7 +795,8 @@ namespace LLP
        SecureString PIN = TAO::API::users->GetActivePin();
 
        /* Attempt to get the sigchain. */
-       memory::encrypted_ptr<TAO::Ledger::SignatureChain>& pSigChain = TAO::API::users->GetAccount(0);
+       const std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> pSession = TAO::API::users->GetAccount(0);
+       memory::encrypted_ptr<TAO::Ledger::SignatureChain>& pSigChain = *pSession;
        if(!pSigChain)
        {
            debug::error(FUNCTION, "Couldn't get the unlocked sigchain");
@@ -870,7 +871,8 @@ namespace LLP
           SecureString PIN = TAO::API::users->GetActivePin();
 
           /* Attempt to get the sigchain. */
-          memory::encrypted_ptr<TAO::Ledger::SignatureChain>& pSigChain = TAO::API::users->GetAccount(0);
+          const std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> pSession = TAO::API::users->GetAccount(0);
+          memory::encrypted_ptr<TAO::Ledger::SignatureChain>& pSigChain = *pSession;
           if(!pSigChain)
               return debug::error(FUNCTION, "Couldn't get the unlocked sigchain");
 
@@ -976,7 +978,8 @@ namespace LLP
             //   return false;
 
            /* Attempt to get the sigchain. */
-           memory::encrypted_ptr<TAO::Ledger::SignatureChain>& pSigChain = TAO::API::users->GetAccount(0);
+           const std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> pSession = TAO::API::users->GetAccount(0);
+           memory::encrypted_ptr<TAO::Ledger::SignatureChain>& pSigChain = *pSession;
            if(!pSigChain)
                return debug::error(FUNCTION, "Couldn't get the unlocked sigchain");
 
@@ -277,11 +277,11 @@ namespace LLP
             /* Check for content. */
             if(strContent.size() > 0)
             {
-                strReply += debug::safe_printstr
-                (
-                    "Content-Length: ", strContent.size(), "\r\n",
-                    "Content-Type: application/json\r\n"
-                );
+                strReply += debug::safe_printstr("Content-Length: ", strContent.size(), "\r\n");
+
+                /* Content is JSON unless a content type header was set. */
+                if(!mapHeaders.count("Content-Type"))
+                    strReply += "Content-Type: application/json\r\n";
             }
 
             /* Add custom header fields. */
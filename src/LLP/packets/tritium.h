@@ -24,6 +24,7 @@ ________________________________________________________________________________
 #include <LLP/include/version.h>
 
 #include <Util/templates/datastream.h>
+#include <Util/templates/viewstream.h>
 #include <Util/include/debug.h>
 
 namespace LLP
@@ -200,7 +201,7 @@ namespace LLP
          **/
         void SetLength(const std::vector<uint8_t>& vBytes)
         {
-            DataStream ssLength(vBytes, SER_NETWORK, MIN_PROTO_VERSION);
+            const ViewStream ssLength(vBytes, SER_NETWORK, MIN_PROTO_VERSION);
             ssLength >> LENGTH;
         }
 
@@ -38,7 +38,9 @@ ________________________________________________________________________________
 #include <Util/include/runtime.h>
 #include <Util/include/args.h>
 #include <Util/include/debug.h>
+#include <Util/include/metrics.h>
 #include <Util/include/version.h>
+#include <Util/templates/viewstream.h>
 
 
 #include <climits>
@@ -382,11 +384,31 @@ namespace LLP
     }
 
 
+    /* Packets received by message type for the metrics registry. */
+    static metrics::CounterIndex metricReceived("nexus_llp_packets_total", "Tritium packets by message type.",
+        "direction=\"in\"", "message");
+
+
+    /* Packets sent by message type for the metrics registry. */
+    static metrics::CounterIndex metricSent("nexus_llp_packets_total", "Tritium packets by message type.",
+        "direction=\"out\"", "message");
+
+
+    /* Count a message sent for the metrics registry. */
+    void TritiumNode::CountSent(const uint16_t nMsg)
+    {
+        metricSent.Get(nMsg).Add();
+    }
+
+
     /** Main message handler once a packet is recieved. **/
     bool TritiumNode::ProcessPacket()
     {
+        /* Count the packet for the metrics registry. */
+        metricReceived.Get(INCOMING.MESSAGE).Add();
+
         /* Deserialize the packeet from incoming packet payload. */
-        DataStream ssPacket(INCOMING.DATA, SER_NETWORK, PROTOCOL_VERSION);
+        const ViewStream ssPacket(INCOMING.DATA, SER_NETWORK, PROTOCOL_VERSION);
         switch(INCOMING.MESSAGE)
         {
             /* Handle for the version command. */
@@ -901,7 +923,7 @@ namespace LLP
 
                 /* Let node know it unsubscribed successfully. */
                 if(INCOMING.MESSAGE == ACTION::UNSUBSCRIBE)
-                    WritePacket(NewMessage(RESPONSE::UNSUBSCRIBED, ssPacket));
+                    WritePacket(NewMessage(RESPONSE::UNSUBSCRIBED, DataStream(INCOMING.DATA, SER_NETWORK, PROTOCOL_VERSION)));
 
                 break;
             }
@@ -2184,7 +2206,7 @@ namespace LLP
                 std::vector<uint8_t> BYTES(8, 0);
                 if(Read(BYTES, 8) == 8)
                 {
-                    DataStream ssHeader(BYTES, SER_NETWORK, MIN_PROTO_VERSION);
+                    const ViewStream ssHeader(BYTES, SER_NETWORK, MIN_PROTO_VERSION);
                     ssHeader >> INCOMING;
 
                     Event(EVENT_HEADER);
@@ -2438,7 +2460,7 @@ namespace LLP
             std::vector<uint8_t> vchSig;
 
             /* Generate the public key and signature for the message data */
-            TAO::API::users->GetAccount(0)->Sign("network", ssMessage.Bytes(), TAO::API::users->GetAuthKey()->DATA, vchPubKey, vchSig);
+            (*TAO::API::users->GetAccount(0))->Sign("network", ssMessage.Bytes(), TAO::API::users->GetAuthKey()->DATA, vchPubKey, vchSig);
 
             /* Add the public key to the message */
             ssMessage << vchPubKey;
@@ -2470,7 +2492,13 @@ namespace LLP
     {
         /* Only filter relays when message is notify. */
         if(nMsg != ACTION::NOTIFY)
+        {
+            /* Relays are sent when there is data to send. */
+            if(ssData.size() > 0)
+                CountSent(nMsg);
+
             return ssData;
+        }
 
         /* Build a response data stream. */
         DataStream ssRelay(SER_NETWORK, MIN_PROTO_VERSION);
@@ -2643,11 +2671,20 @@ namespace LLP
                 default:
                 {
                     debug::error(FUNCTION, "Malformed binary stream");
+
+                    /* Relays are sent when there is data to send. */
+                    if(ssRelay.size() > 0)
+                        CountSent(nMsg);
+
                     return ssRelay;
                 }
             }
         }
 
+        /* Relays are sent when there is data to send. */
+        if(ssRelay.size() > 0)
+            CountSent(nMsg);
+
         return ssRelay;
     }
 
@@ -17,6 +17,7 @@ ________________________________________________________________________________
 #include <LLP/templates/connection.h>
 #include <TAO/Ledger/types/block.h>
 #include <Legacy/types/coinbase.h>
+#include <Util/templates/flatmap.h>
 #include <atomic>
 
 namespace Legacy
@@ -93,7 +94,7 @@ namespace LLP
 
 
         /** The map to hold the list of blocks that are being mined. */
-        std::map<uint512_t, TAO::Ledger::Block *> mapBlocks;
+        FlatMap<uint512_t, TAO::Ledger::Block *> mapBlocks;
 
 
         /** The current best block. **/
@@ -432,10 +432,22 @@ namespace LLP
             TritiumPacket RESPONSE(nMsg);
             RESPONSE.SetData(ssData);
 
+            CountSent(nMsg);
+
             return RESPONSE;
         }
 
 
+        /** CountSent
+         *
+         *  Count a message sent for the metrics registry.
+         *
+         *  @param[in] nMsg The message type.
+         *
+         **/
+        static void CountSent(const uint16_t nMsg);
+
+
         /** PushMessage
          *
          *  Adds a tritium packet to the queue to write to the socket.
@@ -447,6 +459,8 @@ namespace LLP
         {
             TritiumPacket RESPONSE(nMsg);
             WritePacket(RESPONSE);
+
+            CountSent(nMsg);
         }
 
 
@@ -14,8 +14,11 @@ ________________________________________________________________________________
 #include <LLC/types/bignum.h>
 #include <LLC/hash/SK.h>
 
+#include <LLD/cache/fingerprint_cache.h>
+
 #include <Util/include/base58.h>
 #include <Util/include/debug.h>
+#include <Util/include/metrics.h>
 
 #include <Legacy/include/constants.h>
 #include <Legacy/include/evaluate.h>
@@ -23,6 +26,7 @@ ________________________________________________________________________________
 #include <Legacy/include/enum.h>
 
 #include <Legacy/types/script.h>
+#include <Legacy/types/transaction.h>
 
 #include <openssl/bn.h>
 
@@ -94,8 +98,33 @@ namespace Legacy
     }
 
 
+    /* Script verification results of inputs that verified, by transaction, input and output script. */
+    static LLD::FingerprintCache<uint64_t, 80> cacheScripts(16384);
+
+
+    /* Export the script cache statistics to the metrics registry. */
+    static const bool fCacheMetrics = []()
+    {
+        metrics::AddGauge("nexus_cache_hits_total", "Fingerprint cache hits.", "cache=\"scripts\"",
+            []{ return static_cast<double>(cacheScripts.Hits()); }, true);
+
+        metrics::AddGauge("nexus_cache_misses_total", "Fingerprint cache misses.", "cache=\"scripts\"",
+            []{ return static_cast<double>(cacheScripts.Misses()); }, true);
+
+        return true;
+    }();
+
+
     /* Evaluate a script to true or false based on operation codes. */
     bool EvalScript(std::vector<std::vector<uint8_t> >& stack, const Script& script, const Transaction& txTo, uint32_t nIn, int32_t nHashType)
+    {
+        const SignatureContext context(txTo);
+        return EvalScript(stack, script, context, nIn, nHashType);
+    }
+
+
+    /* Evaluate a script to true or false based on operation codes, reusing the signature hashes of the transaction. */
+    bool EvalScript(std::vector<std::vector<uint8_t> >& stack, const Script& script, const SignatureContext& context, uint32_t nIn, int32_t nHashType)
     {
         LLC::CAutoBN_CTX pctx;
         Script::const_iterator pc = script.begin();
@@ -766,7 +795,7 @@ namespace Legacy
                         // Drop the signature, since there's no way for a signature to sign itself
                         scriptCode.FindAndDelete(Script(vchSig));
 
-                        bool fSuccess = CheckSig(vchSig, vchPubKey, scriptCode, txTo, nIn, nHashType);
+                        bool fSuccess = CheckSig(vchSig, vchPubKey, scriptCode, context, nIn, nHashType);
                         popstack(stack);
                         popstack(stack);
                         stack.push_back(fSuccess ? vchTrue : vchFalse);
@@ -825,7 +854,7 @@ namespace Legacy
                             std::vector<uint8_t>& vchPubKey = stacktop(-ikey);
 
                             // Check signature
-                            if(CheckSig(vchSig, vchPubKey, scriptCode, txTo, nIn, nHashType))
+                            if(CheckSig(vchSig, vchPubKey, scriptCode, context, nIn, nHashType))
                             {
                                 isig++;
                                 nSigsCount--;
@@ -1216,13 +1245,21 @@ namespace Legacy
 
     /* Verify a script is a valid */
     bool VerifyScript(const Script& scriptSig, const Script& scriptPubKey, const Transaction& txTo, uint32_t nIn, int32_t nHashType)
+    {
+        const SignatureContext context(txTo);
+        return VerifyScript(scriptSig, scriptPubKey, context, nIn, nHashType);
+    }
+
+
+    /* Verify a script is a valid, reusing the signature hashes of the transaction. */
+    bool VerifyScript(const Script& scriptSig, const Script& scriptPubKey, const SignatureContext& context, uint32_t nIn, int32_t nHashType)
     {
         std::vector< std::vector<uint8_t> > stack, stackCopy;
-        if(!EvalScript(stack, scriptSig, txTo, nIn, nHashType))
+        if(!EvalScript(stack, scriptSig, context, nIn, nHashType))
             return false;
 
         stackCopy = stack;
-        if(!EvalScript(stack, scriptPubKey, txTo, nIn, nHashType))
+        if(!EvalScript(stack, scriptPubKey, context, nIn, nHashType))
             return false;
 
         if(stack.empty())
@@ -1241,7 +1278,7 @@ namespace Legacy
             Script pubKey2(pubKeySerialized.begin(), pubKeySerialized.end());
             popstack(stackCopy);
 
-            if(!EvalScript(stackCopy, pubKey2, txTo, nIn, nHashType))
+            if(!EvalScript(stackCopy, pubKey2, context, nIn, nHashType))
                 return false;
 
             if(stackCopy.empty())
@@ -1254,6 +1291,35 @@ namespace Legacy
     }
 
 
+    /* Verify the script of an input against the output it spends. */
+    bool VerifyInput(const SignatureContext& context, uint32_t nIn, const Script& scriptPubKey)
+    {
+        if(nIn >= context.txTo.vin.size())
+            return false;
+
+        /* Build the cache key from the transaction, input and a fingerprint of the output script. */
+        uint8_t vKey[80] = { 0 };
+        std::copy(context.GetHash().begin(), context.GetHash().begin() + 64, vKey);
+        std::copy((uint8_t*)&nIn, (uint8_t*)&nIn + 4, vKey + 64);
+
+        const uint64_t nScript = XXH3_64bits(scriptPubKey.data(), scriptPubKey.size());
+        std::copy((uint8_t*)&nScript, (uint8_t*)&nScript + 8, vKey + 72);
+
+        /* Check for an input that already verified. */
+        uint64_t nValid = 0;
+        if(cacheScripts.Get(vKey, sizeof(vKey), nValid) && nValid == 1)
+            return true;
+
+        /* Only valid results are cached, failures are always checked again. */
+        if(!VerifyScript(context.txTo.vin[nIn].scriptSig, scriptPubKey, context, nIn, 0))
+            return false;
+
+        cacheScripts.Put(vKey, sizeof(vKey), 1);
+
+        return true;
+    }
+
+
     /* Extract a Sig chain register address from a public key script. */
     bool ExtractRegister(const Script& scriptPubKey, uint256_t& hashRegister)
     {
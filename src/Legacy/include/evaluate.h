@@ -28,6 +28,9 @@ ________________________________________________________________________________
 
 namespace Legacy
 {
+    /* Forward declarations. */
+    class SignatureContext;
+
 
     /** Eval Script
      *
@@ -45,6 +48,22 @@ namespace Legacy
     bool EvalScript(std::vector< std::vector<uint8_t> >& stack, const Script& script, const Transaction& txTo, uint32_t nIn, int32_t nHashType);
 
 
+    /** Eval Script
+     *
+     *  Evaluate a script to true or false based on operation codes, reusing the signature hashes of the transaction.
+     *
+     *  @param[in] stack The stack byte code to execute.
+     *  @param[in] script The script object to run.
+     *  @param[in] context The signature hashes of the transaction this is executing for.
+     *  @param[in] nIn The input in.
+     *  @param[in] nHashType The hash type enumeration.
+     *
+     *  @return true if the script evaluates to true.
+     *
+     **/
+    bool EvalScript(std::vector< std::vector<uint8_t> >& stack, const Script& script, const SignatureContext& context, uint32_t nIn, int32_t nHashType);
+
+
     /** Solver
      *
      *  Extract data from a script object.
@@ -172,6 +191,38 @@ namespace Legacy
     bool VerifyScript(const Script& scriptSig, const Script& scriptPubKey, const Transaction& txTo, uint32_t nIn, int32_t nHashType);
 
 
+    /** Verify Script
+     *
+     *  Verify a script is a valid one, reusing the signature hashes of the transaction.
+     *
+     *  @param[in] scriptSig The script to verify
+     *  @param[in] scriptPubKey The script to verify against.
+     *  @param[in] context The signature hashes of the destination transaction.
+     *  @param[in] nIn The output to verify signature for.
+     *  @param[in] nHashType The hash type for signature.
+     *
+     *  @return true if the script was verified valid.
+     *
+     **/
+    bool VerifyScript(const Script& scriptSig, const Script& scriptPubKey, const SignatureContext& context, uint32_t nIn, int32_t nHashType);
+
+
+    /** Verify Input
+     *
+     *  Verify the script of an input against the output it spends. Inputs that verified before are found
+     *  in a cache keyed by the transaction hash, the input and the output script, so transactions checked
+     *  when accepted to the memory pool aren't verified again when their block is connected.
+     *
+     *  @param[in] context The signature hashes of the transaction spending.
+     *  @param[in] nIn The input to verify.
+     *  @param[in] scriptPubKey The script of the output being spent.
+     *
+     *  @return true if the script was verified valid.
+     *
+     **/
+    bool VerifyInput(const SignatureContext& context, uint32_t nIn, const Script& scriptPubKey);
+
+
     /** ExtractRegister
      *
      *  Extract a Sig chain register address from a public key script.
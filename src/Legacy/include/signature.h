@@ -16,7 +16,11 @@ ________________________________________________________________________________
 #define NEXUS_LEGACY_INCLUDE_SIGNATURE_H
 
 #include <LLC/types/bignum.h>
+#include <LLC/hash/SK/skein.h>
+
 #include <Legacy/wallet/basickeystore.h>
+#include <Legacy/types/script.h>
+
 #include <Util/include/base58.h>
 
 #include <string>
@@ -25,6 +29,93 @@ ________________________________________________________________________________
 
 namespace Legacy
 {
+    /* Forward declarations. */
+    class Transaction;
+
+
+    /** SignatureContext
+     *
+     *  Signature hashes for every input of one transaction.
+     *
+     *  Every input's signature hash covers the whole transaction with the other inputs' scripts blanked, so
+     *  hashing each input from scratch is quadratic in the number of inputs. The context serializes the
+     *  blanked inputs and the outputs once, and keeps the Skein state after each prefix of blanked inputs,
+     *  so a SIGHASH_ALL input only hashes its own input and the inputs after it. Other hash types fall back
+     *  to the full serialization.
+     *
+     *  The midstates are built on first use, so a context must not be shared between threads.
+     *
+     **/
+    class SignatureContext
+    {
+        /** The serialized blanked inputs. **/
+        mutable std::vector<uint8_t> vInputs;
+
+
+        /** The offset of each blanked input in vInputs, with the total size at the end. **/
+        mutable std::vector<uint32_t> vOffsets;
+
+
+        /** The serialized outputs and lock time. **/
+        mutable std::vector<uint8_t> vOutputs;
+
+
+        /** The Skein state before each input. **/
+        mutable std::vector<Skein_256_Ctxt_t> vMidstates;
+
+
+        /** The hash of the transaction, worked out on first use. **/
+        mutable uint512_t hashTx;
+
+
+        /** initialize
+         *
+         *  Serialize the blanked inputs and outputs and build the midstates.
+         *
+         **/
+        void initialize() const;
+
+
+    public:
+
+        /** The transaction being signed. **/
+        const Transaction& txTo;
+
+
+        /** Constructor. **/
+        SignatureContext(const Transaction& txToIn);
+
+
+        /** Copy Constructor. **/
+        SignatureContext(const SignatureContext& context)            = delete;
+
+
+        /** Copy assignment. **/
+        SignatureContext& operator=(const SignatureContext& context) = delete;
+
+
+        /** SignatureHash
+         *
+         *  Returns a hash that is used to sign an input or verify the signature is a valid signature of this hash.
+         *
+         *  @param[in] scriptCode The input script object.
+         *  @param[in] nIn The input that is being signed.
+         *  @param[in] nHashType The hash type that is used to generate this signature hash.
+         *
+         *  @return The hash for use in signing.
+         *
+         **/
+        uint256_t SignatureHash(const Script& scriptCode, uint32_t nIn, int32_t nHashType) const;
+
+
+        /** GetHash
+         *
+         *  Get the hash of the transaction being signed.
+         *
+         **/
+        const uint512_t& GetHash() const;
+    };
+
 
     /** Sign 1
      *
@@ -70,7 +161,7 @@ namespace Legacy
      *  @return The hash for use in signing.
      *
      **/
-    uint256_t SignatureHash(Script scriptCode, const Transaction& txTo, uint32_t nIn, int32_t nHashType);
+    uint256_t SignatureHash(const Script& scriptCode, const Transaction& txTo, uint32_t nIn, int32_t nHashType);
 
 
     /** Check Sig
@@ -80,14 +171,15 @@ namespace Legacy
      *  @param[in] vchSig The byte vector of signature data.
      *  @param[in] vchPubKey The byte vector of the public key.
      *  @param[in] scriptCode The input script object to check from.
-     *  @param[in] txTo The transaction being sent to.
+     *  @param[in] context The signature hashes of the transaction being sent to.
      *  @param[in] nIn The input being spent.
      *  @param[in] nHashType The hash type used for signature.
      *
      *  @return true if the signature is valid.
      *
      **/
-    bool CheckSig(std::vector<uint8_t> vchSig, std::vector<uint8_t> vchPubKey, Script scriptCode, const Transaction& txTo, uint32_t nIn, int32_t nHashType);
+    bool CheckSig(const std::vector<uint8_t>& vchSig, const std::vector<uint8_t>& vchPubKey, const Script& scriptCode,
+                  const SignatureContext& context, uint32_t nIn, int32_t nHashType);
 
 
     /** Sign Signature
@@ -120,6 +212,20 @@ namespace Legacy
      **/
     bool VerifySignature(const Transaction& txFrom, const Transaction& txTo, uint32_t nIn, int32_t nHashType);
 
+
+    /** Verify Signature
+     *
+     *  Verify a signature was valid, using the signature hashes of the spending transaction and the script cache.
+     *
+     *  @param[in] txFrom The transaction from which is being spent.
+     *  @param[in] context The signature hashes of the transaction spending.
+     *  @param[in] nIn The input to verify signature for.
+     *
+     *  @return true if signature was verified successfully.
+     *
+     **/
+    bool VerifySignature(const Transaction& txFrom, const SignatureContext& context, uint32_t nIn);
+
 }
 
 #endif
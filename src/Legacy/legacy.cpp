@@ -38,6 +38,8 @@ ________________________________________________________________________________
 
 #include <Util/include/args.h>
 #include <Util/include/hex.h>
+#include <Util/include/metrics.h>
+#include <Util/include/trace.h>
 #include <Util/include/runtime.h>
 #include <Util/include/softfloat.h>
 
@@ -258,6 +260,11 @@ namespace Legacy
     /* Checks if a block is valid if not connected to chain. */
     bool LegacyBlock::Check() const
     {
+        static metrics::Histogram& metricCheck = metrics::GetHistogram("nexus_block_check_seconds",
+            "Block check latency.", "type=\"legacy\"");
+        metrics::Timer timer(metricCheck);
+        trace::Span span("LegacyBlock::Check");
+
         /* Read ledger DB for duplicate block. */
         if(LLD::Ledger->HasBlock(GetHash()))
             return false;//debug::error(FUNCTION, "already have block ", GetHash().SubString(), " height ", nHeight);
@@ -433,6 +440,11 @@ namespace Legacy
     /* Accept a block into the chain. */
     bool LegacyBlock::Accept() const
     {
+        static metrics::Histogram& metricAccept = metrics::GetHistogram("nexus_block_accept_seconds",
+            "Block accept latency.", "type=\"legacy\"");
+        metrics::Timer timer(metricAccept);
+        trace::Span span("LegacyBlock::Accept");
+
         /* Print the block on verbose 2. */
         if(config::nVerbose >= 2)
             print();
@@ -24,6 +24,7 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/chainstate.h>
 
 #include <Util/include/args.h>
+#include <Util/include/metrics.h>
 #include <Util/include/runtime.h>
 
 #include <cmath>
@@ -43,6 +44,7 @@ namespace TAO
             uint512_t nTxHash = tx.GetHash();
 
             RLOCK(MUTEX);
+            LOCK2(INDEX_MUTEX);
 
             /* Check the mempool. */
             if(mapLegacy.count(nTxHash))
@@ -50,6 +52,7 @@ namespace TAO
 
             /* Add to the map. */
             mapLegacy[nTxHash] = tx;
+            ++nSequence;
 
             return true;
         }
@@ -57,6 +60,10 @@ namespace TAO
 
         bool Mempool::Accept(const Legacy::Transaction& tx, LLP::TritiumNode* pnode)
         {
+            static metrics::Histogram& metricAccept = metrics::GetHistogram("nexus_mempool_accept_seconds",
+                "Mempool transaction accept latency.", "type=\"legacy\"");
+            metrics::Timer timer(metricAccept);
+
             /* Get the transaction hash. */
             uint512_t hashTx = tx.GetHash();
 
@@ -95,6 +102,8 @@ namespace TAO
                 {
                     /* Add to conflicts map. */
                     debug::error(FUNCTION, "LEGACY CONFLICT: INPUTS CLAIMED ", vin.prevout.hash.SubString(), ", ", vin.prevout.n);
+
+                    LOCK2(INDEX_MUTEX);
                     mapLegacyConflicts[hashTx] = tx;
 
                     return false;
@@ -223,13 +232,18 @@ namespace TAO
             if(!tx.Connect(inputs, state, TAO::Ledger::FLAGS::MEMPOOL))
                 return debug::error(FUNCTION, "tx ", hashTx.SubString(), " failed to connect inputs");
 
-            /* Set the inputs to be claimed. */
-            uint32_t s = tx.vin.size();
-            for(uint32_t i = 0; i < s; ++i)
-                mapInputs[tx.vin[i].prevout] = hashTx;
+            {
+                LOCK2(INDEX_MUTEX);
 
-            /* Add to the legacy map. */
-            mapLegacy[hashTx] = tx;
+                /* Set the inputs to be claimed. */
+                uint32_t s = tx.vin.size();
+                for(uint32_t i = 0; i < s; ++i)
+                    mapInputs[tx.vin[i].prevout] = hashTx;
+
+                /* Add to the legacy map. */
+                mapLegacy[hashTx] = tx;
+                ++nSequence;
+            }
 
             /* Relay tx if creating ourselves. */
             if(!pnode && LLP::TRITIUM_SERVER)
@@ -254,13 +268,15 @@ namespace TAO
         /* Checks if a given output is spent in memory. */
         bool Mempool::IsSpent(const uint512_t& hash, const uint32_t n)
         {
+            LOCK(INDEX_MUTEX);
+
             return mapInputs.count(Legacy::OutPoint(hash, n));
         }
 
         /* Gets a legacy transaction from mempool */
         bool Mempool::Get(const uint512_t& hashTx, Legacy::Transaction &tx, bool &fConflicted) const
         {
-            RLOCK(MUTEX);
+            LOCK(INDEX_MUTEX);
 
             /* Check in conflict memory. */
             if(mapLegacyConflicts.count(hashTx))
@@ -289,7 +305,7 @@ namespace TAO
         /* Gets a legacy transaction from mempool */
         bool Mempool::Get(const uint512_t& hashTx, Legacy::Transaction &tx) const
         {
-            RLOCK(MUTEX);
+            LOCK(INDEX_MUTEX);
 
             /* Check the memory map. */
             if(!mapLegacy.count(hashTx))
@@ -305,7 +321,7 @@ namespace TAO
         /* Gets the size of the memory pool. */
         uint32_t Mempool::SizeLegacy()
         {
-            RLOCK(MUTEX);
+            LOCK(INDEX_MUTEX);
 
             return mapLegacy.size();
         }
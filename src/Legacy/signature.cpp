@@ -71,7 +71,7 @@ namespace Legacy
 
 
     /* Returns a hash that is used to sign inputs or verify the signature is a valid signature of this hash. */
-    uint256_t SignatureHash(Script scriptCode, const Transaction& txTo, uint32_t nIn, int32_t nHashType)
+    uint256_t SignatureHash(const Script& scriptCode, const Transaction& txTo, uint32_t nIn, int32_t nHashType)
     {
         if(nIn >= txTo.vin.size())
         {
@@ -84,16 +84,16 @@ namespace Legacy
         /* Precompute the input count. */
         uint32_t nTxInSize = static_cast<uint32_t>(txTmp.vin.size());
 
-        // In case concatenating two scripts ends up with two codeseparators,
-        // or an extra one at the end, this prevents all those possible incompatibilities.
-        scriptCode.FindAndDelete(Script(OP_CODESEPARATOR));
-
         // Blank out other inputs' signatures
         for(uint32_t i = 0; i < nTxInSize; ++i)
             txTmp.vin[i].scriptSig = Script();
 
         txTmp.vin[nIn].scriptSig = scriptCode;
 
+        // In case concatenating two scripts ends up with two codeseparators,
+        // or an extra one at the end, this prevents all those possible incompatibilities.
+        txTmp.vin[nIn].scriptSig.FindAndDelete(Script(OP_CODESEPARATOR));
+
         // Blank out some of the outputs
         if((nHashType & 0x1f) == SIGHASH_NONE)
         {
@@ -140,8 +140,124 @@ namespace Legacy
     }
 
 
+    /* Constructor. */
+    SignatureContext::SignatureContext(const Transaction& txToIn)
+    : vInputs    ( )
+    , vOffsets   ( )
+    , vOutputs   ( )
+    , vMidstates ( )
+    , hashTx     (0)
+    , txTo       (txToIn)
+    {
+    }
+
+
+    /* Serialize the blanked inputs and outputs and build the midstates. */
+    void SignatureContext::initialize() const
+    {
+        /* The transaction header and input count. */
+        DataStream ssPrefix(SER_GETHASH, 0);
+        ssPrefix << txTo.nVersion << txTo.nTime;
+        WriteCompactSize(ssPrefix, txTo.vin.size());
+
+        /* The inputs with their scripts blanked. */
+        DataStream ssInputs(SER_GETHASH, 0);
+        vOffsets.reserve(txTo.vin.size() + 1);
+        for(const auto& txin : txTo.vin)
+        {
+            vOffsets.push_back(static_cast<uint32_t>(ssInputs.size()));
+            ssInputs << txin.prevout << Script() << txin.nSequence;
+        }
+        vOffsets.push_back(static_cast<uint32_t>(ssInputs.size()));
+        vInputs.assign(ssInputs.begin(), ssInputs.end());
+
+        /* The outputs and lock time. */
+        DataStream ssOutputs(SER_GETHASH, 0);
+        ssOutputs << txTo.vout << txTo.nLockTime;
+        vOutputs.assign(ssOutputs.begin(), ssOutputs.end());
+
+        /* Hash the prefix and keep the state before each input. */
+        Skein_256_Ctxt_t ctxSkein;
+        Skein_256_Init  (&ctxSkein, 256);
+        Skein_256_Update(&ctxSkein, (uint8_t *)&ssPrefix.begin()[0], ssPrefix.size());
+
+        vMidstates.reserve(txTo.vin.size());
+        for(uint32_t n = 0; n < txTo.vin.size(); ++n)
+        {
+            vMidstates.push_back(ctxSkein);
+            Skein_256_Update(&ctxSkein, &vInputs[vOffsets[n]], vOffsets[n + 1] - vOffsets[n]);
+        }
+    }
+
+
+    /* Returns a hash that is used to sign an input or verify the signature is a valid signature of this hash. */
+    uint256_t SignatureContext::SignatureHash(const Script& scriptCode, uint32_t nIn, int32_t nHashType) const
+    {
+        /* Only SIGHASH_ALL keeps every other input and output as they are. */
+        if((nHashType & SIGHASH_ANYONECANPAY) || (nHashType & 0x1f) == SIGHASH_NONE || (nHashType & 0x1f) == SIGHASH_SINGLE)
+            return Legacy::SignatureHash(scriptCode, txTo, nIn, nHashType);
+
+        if(nIn >= txTo.vin.size())
+        {
+            debug::error("SignatureHash() : nIn=", nIn, " out of range");
+            return 1;
+        }
+
+        /* Build the midstates on first use. */
+        if(vMidstates.empty())
+            initialize();
+
+        /* Serialize our input with the script code, only copying the script to remove code separators. */
+        const TxIn& txin = txTo.vin[nIn];
+        DataStream ssInput(SER_GETHASH, 0);
+        ssInput << txin.prevout;
+        if(scriptCode.Find(OP_CODESEPARATOR) > 0)
+        {
+            Script scriptTmp(scriptCode);
+            scriptTmp.FindAndDelete(Script(OP_CODESEPARATOR));
+            ssInput << scriptTmp;
+        }
+        else
+            ssInput << scriptCode;
+
+        ssInput << txin.nSequence;
+
+        /* Finish the hash from the state before our input. */
+        Skein_256_Ctxt_t ctxSkein = vMidstates[nIn];
+        Skein_256_Update(&ctxSkein, (uint8_t *)&ssInput.begin()[0], ssInput.size());
+        Skein_256_Update(&ctxSkein, vInputs.data() + vOffsets[nIn + 1], vInputs.size() - vOffsets[nIn + 1]);
+        Skein_256_Update(&ctxSkein, vOutputs.data(), vOutputs.size());
+
+        DataStream ssHashType(SER_GETHASH, 0);
+        ssHashType << nHashType;
+        Skein_256_Update(&ctxSkein, (uint8_t *)&ssHashType.begin()[0], ssHashType.size());
+
+        uint256_t hashSkein = 0;
+        Skein_256_Final(&ctxSkein, (uint8_t *)&hashSkein);
+
+        uint256_t hashKeccak;
+        Keccak_HashInstance ctxKeccak;
+        Keccak_HashInitialize_SHA3_256(&ctxKeccak);
+        Keccak_HashUpdate(&ctxKeccak, (uint8_t *)&hashSkein, 256);
+        Keccak_HashFinal(&ctxKeccak, (uint8_t *)&hashKeccak);
+
+        return hashKeccak;
+    }
+
+
+    /* Get the hash of the transaction being signed. */
+    const uint512_t& SignatureContext::GetHash() const
+    {
+        if(hashTx == 0)
+            hashTx = txTo.GetHash();
+
+        return hashTx;
+    }
+
+
     /* Checks that the signature supplied is a valid one. */
-    bool CheckSig(std::vector<uint8_t> vchSig, std::vector<uint8_t> vchPubKey, Script scriptCode, const Transaction& txTo, uint32_t nIn, int32_t nHashType)
+    bool CheckSig(const std::vector<uint8_t>& vchSig, const std::vector<uint8_t>& vchPubKey, const Script& scriptCode,
+                  const SignatureContext& context, uint32_t nIn, int32_t nHashType)
     {
         // Hash type is one byte tacked on to the end of the signature
         if(vchSig.empty())
@@ -151,13 +267,12 @@ namespace Legacy
         else if(nHashType != vchSig.back())
             return false;
 
-        vchSig.pop_back();
-        uint256_t sighash = SignatureHash(scriptCode, txTo, nIn, nHashType);
+        uint256_t sighash = context.SignatureHash(scriptCode, nIn, nHashType);
 
         LLC::ECKey key;
         if(!key.SetPubKey(vchPubKey))
             return false;
-        if(!key.Verify(sighash, vchSig, 256))
+        if(!key.Verify(sighash, std::vector<uint8_t>(vchSig.begin(), vchSig.end() - 1), 256))
             return false;
 
         return true;
@@ -232,4 +347,23 @@ namespace Legacy
         return true;
     }
 
+
+    /* Verify a signature was valid, using the signature hashes of the spending transaction and the script cache. */
+    bool VerifySignature(const Transaction& txFrom, const SignatureContext& context, uint32_t nIn)
+    {
+        assert(nIn < context.txTo.vin.size());
+        const TxIn& txin = context.txTo.vin[nIn];
+        if(txin.prevout.n >= txFrom.vout.size())
+            return false;
+
+        const TxOut& txout = txFrom.vout[txin.prevout.n];
+        if(txin.prevout.hash != txFrom.GetHash())
+            return false;
+
+        if(!VerifyInput(context, nIn, txout.scriptPubKey))
+            return false;
+
+        return true;
+    }
+
 }
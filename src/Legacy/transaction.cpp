@@ -1038,6 +1038,9 @@ namespace Legacy
         /* Read all of the inputs. */
         uint64_t nValueIn = 0;
 
+        /* Signature hashes shared by all of the inputs. */
+        const SignatureContext context(*this);
+
         /* Get the number of inputs to the transaction. */
         uint32_t nSize = static_cast<uint32_t>(vin.size());
         for(uint32_t i = (uint32_t)fIsCoinStake; i < nSize; ++i)
@@ -1105,7 +1108,7 @@ namespace Legacy
                         return debug::error(FUNCTION, "prev tx ", prevout.hash.SubString(), " is already spent");
 
                     /* Check the ECDSA signatures. (...When not syncronizing) */
-                    if(!TAO::Ledger::ChainState::Synchronizing() && !VerifySignature(txPrev, *this, i, 0))
+                    if(!TAO::Ledger::ChainState::Synchronizing() && !VerifySignature(txPrev, context, i))
                         return debug::error(FUNCTION, "signature is invalid");
 
                     /* Commit to disk if flagged. */
@@ -1165,7 +1168,7 @@ namespace Legacy
                             return debug::error(FUNCTION, "prevout.hash mismatch");
 
                         /* Verify the scripts. */
-                        if(!VerifyScript(vin[i].scriptSig, txout.scriptPubKey, *this, i, 0))
+                        if(!VerifyInput(context, i, txout.scriptPubKey))
                             return debug::error(FUNCTION, "invalid script");
                     }
 
@@ -43,10 +43,14 @@ ________________________________________________________________________________
 #include <Util/include/runtime.h>
 #include <Util/include/signals.h>
 #include <Util/include/string.h>
+#include <Util/include/parallel.h>
+#include <Util/templates/bloomfilter.h>
 
 #include <openssl/rand.h>   // For RAND_bytes
 
 #include <algorithm>
+#include <future>
+#include <limits>
 #include <thread>
 #include <utility>
 
@@ -84,6 +88,9 @@ namespace Legacy
     , vchDefaultKey     ( )
     , vchTrustKey       ( )
     , nWalletUnlockTime (0)
+    , setUnspent        ( )
+    , nRevision         (1)
+    , balances          ( )
     , cs_wallet         ( )
     , mapWallet         ( )
     {
@@ -713,41 +720,21 @@ namespace Legacy
     /* Retrieves the total wallet balance for all confirmed, mature transactions. */
     int64_t Wallet::GetBalance()
     {
-        int64_t nTotalBalance = 0;
-        {
-            /* Lock wallet only to take a snapshot of current transaction map for calculating balance
-             * After unlock, mapWallet can change but it won't affect balance calculation
-             */
-            RLOCK(cs_wallet);
-
-            for (const auto& item : mapWallet)
-            {
-                const WalletTx& wtx = item.second;
-
-                /* Skip any transaction that isn't final, isn't completely confirmed, or has a future timestamp */
-                if (!wtx.IsFinal() || !wtx.IsConfirmed() || wtx.nTime > runtime::unifiedtimestamp())
-                    continue;
-
-                nTotalBalance += wtx.GetAvailableCredit();
-            }
-        }
-
-
+        RLOCK(cs_wallet);
 
-        return nTotalBalance;
+        return get_balances().nBalance;
     }
 
 
-
     /* Get the balance for an account associated with a wallet. */
     bool Wallet::BalanceByAccount(std::string strAccount, int64_t& nBalance, const int32_t nMinDepth)
     {
         {
             RLOCK(cs_wallet);
             nBalance = 0;
-            for(auto it = mapWallet.begin(); it != mapWallet.end(); ++it)
+            for(const auto& hash : setUnspent)
             {
-                const WalletTx* pcoin = &(*it).second;
+                const WalletTx* pcoin = &mapWallet.at(hash);
                 if(!pcoin->IsFinal())
                     continue;
 
@@ -800,70 +787,27 @@ namespace Legacy
     /* Retrieves the current wallet balance for unconfirmed transactions. */
     int64_t Wallet::GetUnconfirmedBalance()
     {
-        int64_t nUnconfirmedBalance = 0;
-        {
-            /* Lock wallet only to take a snapshot of current transaction map for calculating balance
-             * After unlock, mapWallet can change but it won't affect balance calculation
-             */
-            RLOCK(cs_wallet);
-
-            for (const auto& item : mapWallet)
-            {
-                const WalletTx& wtx = item.second;
-
-                if (wtx.IsFinal() && wtx.IsConfirmed())
-                    continue;
-
-                nUnconfirmedBalance += wtx.GetAvailableCredit();
-            }
-        }
-
-
+        RLOCK(cs_wallet);
 
-        return nUnconfirmedBalance;
+        return get_balances().nUnconfirmed;
     }
 
 
     /* Retrieves the current immature stake balance. */
     int64_t Wallet::GetStake()
     {
-        int64_t nTotalStake = 0;
-
-        {
-            RLOCK(cs_wallet);
-
-            for(const auto& item : mapWallet)
-            {
-                const WalletTx& wtx = item.second;
-
-                /* Amount currently being staked is that amount in a coinstake tx that is not yet mature but has been added to chain */
-                if (wtx.IsCoinStake() && wtx.GetBlocksToMaturity() > 0 && wtx.GetDepthInMainChain() > 0)
-                    nTotalStake += GetCredit(wtx);
-            }
-        }
+        RLOCK(cs_wallet);
 
-        return nTotalStake;
+        return get_balances().nStake;
     }
 
 
     /* Retrieves the current immature minted (mined) balance. */
     int64_t Wallet::GetNewMint()
     {
-        int64_t nTotalMint = 0;
-
-        {
-            RLOCK(cs_wallet);
-
-            for(const auto& item : mapWallet)
-            {
-                const WalletTx& wtx = item.second;
-
-                if (wtx.IsCoinBase() && wtx.GetBlocksToMaturity() > 0 && wtx.GetDepthInMainChain() > 1)
-                    nTotalMint += GetCredit(wtx);
-            }
-        }
+        RLOCK(cs_wallet);
 
-        return nTotalMint;
+        return get_balances().nMint;
     }
 
 
@@ -875,9 +819,9 @@ namespace Legacy
 
             vCoins.clear();
 
-            for(const auto& item : mapWallet)
+            for(const auto& hash : setUnspent)
             {
-                const WalletTx& wtx = item.second;
+                const WalletTx& wtx = mapWallet.at(hash);
 
                 /* Filter transactions not final */
                 if (!wtx.IsFinal())
@@ -918,6 +862,9 @@ namespace Legacy
 
             for(auto& item : mapWallet)
                 item.second.MarkDirty();
+
+            /* Keys may have changed which outputs are ours. */
+            rebuild_unspent();
         }
     }
 
@@ -998,6 +945,12 @@ namespace Legacy
             fUpdated |= wtx.UpdateSpent(wtxIn.vfSpent);
         }
 
+        /* Index the outputs of the new or merged transaction. */
+        {
+            RLOCK(cs_wallet);
+            update_unspent(hash, wtx);
+        }
+
         /* debug print */
         debug::log(0, FUNCTION, hash.SubString(10), " ", (fInsertedNew ? "new" : ""), (fUpdated ? "update" : ""));
 
@@ -1151,6 +1104,9 @@ namespace Legacy
 
             if(mapWallet.erase(hash))
             {
+                setUnspent.erase(hash);
+                ++nRevision;
+
                 WalletDB walletdb(strWalletFile);
                 walletdb.EraseTx(hash);
             }
@@ -1186,6 +1142,8 @@ namespace Legacy
                     {
                         txPrev.MarkUnspent(txin.prevout.n);
                         txPrev.WriteToDisk(tx.GetHash());
+
+                        update_unspent(txin.prevout.hash, txPrev);
                     }
                 }
             }
@@ -1193,6 +1151,61 @@ namespace Legacy
     }
 
 
+    /* The number of transactions read from the database at a time during a rescan. */
+    const uint32_t RESCAN_BATCH = 10000;
+
+
+    /* Check if any data pushed by a script may be a key or script hash of the wallet. */
+    static bool filter_script(const BloomFilter& filter, const Script& script)
+    {
+        std::vector<uint8_t> vData;
+        opcodetype opcode;
+
+        std::vector<uint8_t>::const_iterator pc = script.begin();
+        while(pc < script.end())
+        {
+            /* Malformed scripts are left for the full check. */
+            if(!script.GetOp(pc, opcode, vData))
+                return true;
+
+            if(!vData.empty() && filter.Contains(vData))
+                return true;
+        }
+
+        return false;
+    }
+
+
+    /* Read transactions in batches in chain order, reading the next batch while the current one is processed. */
+    template<typename TxType, typename ReadFunction, typename ProcessFunction>
+    static void rescan_batches(const uint512_t& hashBegin, const ReadFunction& fnRead, const ProcessFunction& fnProcess)
+    {
+        /* The starting hash is only included in the first batch. */
+        std::vector<TxType> vtx;
+        if(!fnRead(hashBegin, vtx, true))
+            return;
+
+        while(!config::fShutdown.load() && !vtx.empty())
+        {
+            /* Start reading the next batch. */
+            const bool fLast = (vtx.size() != RESCAN_BATCH);
+            const uint512_t hashLast = vtx.back().GetHash();
+
+            std::vector<TxType> vNext;
+            std::future<bool> fNext;
+            if(!fLast)
+                fNext = std::async(std::launch::async, [&]() { return fnRead(hashLast, vNext, false); });
+
+            fnProcess(vtx);
+
+            if(fLast || !fNext.get())
+                break;
+
+            vtx.swap(vNext);
+        }
+    }
+
+
     /* Scan the block chain for transactions from or to keys in this wallet.
      * Add/update the current wallet transactions for any found.
      */
@@ -1212,7 +1225,6 @@ namespace Legacy
 
         uint512_t hashLast = 0;
         TAO::Ledger::BlockState stateStart = stateBegin;
-        bool fFirst = true;
 
         /* Check for genesis. */
         if(stateStart.nHeight == 0)
@@ -1223,6 +1235,73 @@ namespace Legacy
                 return debug::error(FUNCTION, "next block is null");
         }
 
+        /* Build a filter of the wallet's public keys, key hashes and script hashes.
+         * Any output of ours pushes one of these, so outputs with none of them are skipped without a key lookup.
+         */
+        std::set<NexusAddress> setAddresses;
+        GetKeys(setAddresses);
+
+        std::vector<uint256_t> vScripts;
+        {
+            LOCK(cs_basicKeyStore);
+            for(const auto& script : mapScripts)
+                vScripts.push_back(script.first);
+        }
+
+        BloomFilter filter((setAddresses.size() * 2) + vScripts.size());
+        for(const auto& address : setAddresses)
+        {
+            const uint256_t hashAddress = address.GetHash256();
+            filter.Insert(hashAddress.begin(), 32);
+
+            std::vector<uint8_t> vchPubKey;
+            if(GetPubKey(address, vchPubKey))
+                filter.Insert(vchPubKey);
+        }
+
+        for(const auto& hashScript : vScripts)
+            filter.Insert(hashScript.begin(), 32);
+
+        /* The number of threads to check transactions with. */
+        const uint32_t nThreads = ParallelThreads(config::GetArg("-rescanthreads", 0));
+
+        /* Add the matched transactions of a batch to the wallet in chain order. */
+        auto fnApply = [&](const uint512_t& hash)
+        {
+            /* Update spent flags. */
+            RLOCK(cs_wallet);
+            WalletTx& wtx = mapWallet[hash];
+            for(uint32_t n = 0; n < wtx.vout.size(); ++n)
+            {
+                /* Update spent pointers. */
+                if(LLD::Legacy->IsSpent(hash, n))
+                {
+                    wtx.MarkSpent(n);
+                    wtx.WriteToDisk(hash);
+                }
+            }
+
+            update_unspent(hash, wtx);
+
+            ++nTransactionCount;
+        };
+
+        /* Meter for output. */
+        auto fnMeter = [&]()
+        {
+            /* Update the scanned count for meters. */
+            ++nScannedCount;
+
+            if(nScannedCount % 100000 == 0)
+            {
+                /* Get the time it took to rescan. */
+                uint32_t nElapsedSeconds = timer.Elapsed();
+                debug::log(0, FUNCTION, "Processed ", nTransactionCount,
+                    " tx of ", nScannedCount, " in ", nElapsedSeconds, " seconds (",
+                    std::fixed, (double)(nScannedCount / (nElapsedSeconds > 0 ? nElapsedSeconds : 1 )), " tx/s)");
+            }
+        };
+
         /* Begin by scanning all Legacy transactions from the starting block. */
 
         /* Starting point for scan is the first Legacy transaction within the starting block. */
@@ -1249,70 +1328,59 @@ namespace Legacy
         {
             debug::log(0, FUNCTION, "Scanning Legacy from tx ", hashLast.SubString());
 
-            /* Loop until complete. */
-            while(!config::fShutdown.load())
-            {
-                /* Read the next batch of inventory.
-                 * The starting hash is only included in results on first iteration when fFirst is true.
-                 */
-                std::vector<Transaction> vtx;
-                if(!LLD::Legacy->BatchRead(std::make_pair(std::string("tx"), hashLast), "tx", vtx, 1000, !fFirst))
-                    break;
-
-                /* Loop through found transactions. */
-                TAO::Ledger::BlockState state;
-                for(const auto& tx : vtx)
+            rescan_batches<Transaction>(hashLast,
+                [](const uint512_t& hash, std::vector<Transaction>& vtx, const bool fFirst)
+                {
+                    return LLD::Legacy->BatchRead(std::make_pair(std::string("tx"), hash), "tx", vtx, RESCAN_BATCH, !fFirst);
+                },
+                [&](const std::vector<Transaction>& vtx)
                 {
-                    /* Add to the wallet */
-                    if(AddToWalletIfInvolvingMe(tx, state, fUpdate, true, true))
+                    /* Check the outputs of the batch over the worker threads. */
+                    std::vector<uint8_t> vMine(vtx.size(), 0);
+                    ParallelFor(vtx.size(), nThreads, [&](const uint32_t nIndex)
                     {
-                        /* Get txid. */
-                        uint512_t hash = tx.GetHash();
-
-                        /* Update spent flags. */
-                        WalletTx& wtx = mapWallet[hash];
-                        for(uint32_t n = 0; n < wtx.vout.size(); ++n)
+                        for(const auto& txout : vtx[nIndex].vout)
                         {
-                            /* Update spent pointers. */
-                            if(LLD::Legacy->IsSpent(hash, n))
+                            if(filter_script(filter, txout.scriptPubKey) && IsMine(txout))
                             {
-                                wtx.MarkSpent(n);
-                                wtx.WriteToDisk(hash);
+                                vMine[nIndex] = 1;
+                                break;
                             }
                         }
+                    });
 
-                        ++nTransactionCount;
-                    }
-
-                    /* Update the scanned count for meters. */
-                    ++nScannedCount;
-
-                    /* Meter for output. */
-                    if(nScannedCount % 100000 == 0)
+                    /* Add to the wallet in chain order, as inputs may spend outputs added earlier in the batch. */
+                    TAO::Ledger::BlockState state;
+                    for(uint32_t nIndex = 0; nIndex < vtx.size(); ++nIndex)
                     {
-                        /* Get the time it took to rescan. */
-                        uint32_t nElapsedSeconds = timer.Elapsed();
-                        debug::log(0, FUNCTION, "Processed ", nTransactionCount,
-                            " tx of ", nScannedCount, " in ", nElapsedSeconds, " seconds (",
-                            std::fixed, (double)(nScannedCount / (nElapsedSeconds > 0 ? nElapsedSeconds : 1 )), " tx/s)");
-                    }
-                }
+                        const Transaction& tx = vtx[nIndex];
 
-                /* Set hash Last. */
-                hashLast = vtx.back().GetHash();
+                        /* Transactions that pay us nothing only matter if they spend from the wallet. */
+                        bool fCheck = (vMine[nIndex] == 1);
+                        if(!fCheck)
+                        {
+                            RLOCK(cs_wallet);
+                            for(const auto& txin : tx.vin)
+                            {
+                                if(mapWallet.count(txin.prevout.hash))
+                                {
+                                    fCheck = true;
+                                    break;
+                                }
+                            }
+                        }
 
-                /* Check for end. */
-                if(vtx.size() != 1000)
-                    break;
+                        /* Add to the wallet */
+                        if(fCheck && AddToWalletIfInvolvingMe(tx, state, fUpdate, true, true))
+                            fnApply(tx.GetHash());
 
-                /* Set first flag. */
-                fFirst = false;
-            }
+                        fnMeter();
+                    }
+                });
         }
 
         /* After completing Legacy scan, also scan Tritium tx. These may contains send-to-legacy contracts to add into wallet */
         hashLast = 0;
-        fFirst = true;
 
         if(stateStart.nVersion < 7)
         {
@@ -1340,62 +1408,46 @@ namespace Legacy
         if(hashLast != 0)
         {
             debug::log(0, FUNCTION, "Scanning Tritium from tx ", hashLast.SubString());
-            while(!config::fShutdown.load())
-            {
-                /* Read the next batch of inventory. */
-                std::vector<TAO::Ledger::Transaction> vtx;
-                if(!LLD::Ledger->BatchRead(hashLast, "tx", vtx, 1000, !fFirst))
-                    break;
 
-                /* Loop through found transactions. */
-                TAO::Ledger::BlockState state;
-                for(const auto& tx : vtx)
+            rescan_batches<TAO::Ledger::Transaction>(hashLast,
+                [](const uint512_t& hash, std::vector<TAO::Ledger::Transaction>& vtx, const bool fFirst)
                 {
-                    /* Add to the wallet */
-                    if(AddToWalletIfInvolvingMe(tx, state, fUpdate, true, true))
+                    return LLD::Ledger->BatchRead(hash, "tx", vtx, RESCAN_BATCH, !fFirst);
+                },
+                [&](const std::vector<TAO::Ledger::Transaction>& vtx)
+                {
+                    /* Check the legacy outputs of the batch over the worker threads. */
+                    std::vector<uint8_t> vMine(vtx.size(), 0);
+                    ParallelFor(vtx.size(), nThreads, [&](const uint32_t nIndex)
                     {
-                        /* Get txid. */
-                        uint512_t hash = tx.GetHash();
-
-                        /* Update spent flags. */
-                        WalletTx& wtx = mapWallet[hash];
-                        for(uint32_t n = 0; n < wtx.vout.size(); ++n)
+                        const TAO::Ledger::Transaction& tx = vtx[nIndex];
+                        for(uint32_t nContract = 0; nContract < tx.Size(); ++nContract)
                         {
-                            /* Update spent pointers. */
-                            if(LLD::Legacy->IsSpent(hash, n))
+                            TxOut txout;
+                            if(!tx[nContract].Legacy(txout))
+                                continue;
+
+                            if(filter_script(filter, txout.scriptPubKey) && IsMine(txout))
                             {
-                                wtx.MarkSpent(n);
-                                wtx.WriteToDisk(hash);
+                                vMine[nIndex] = 1;
+                                break;
                             }
                         }
+                    });
 
-                        ++nTransactionCount;
-                    }
-
-                    /* Update the scanned count for meters. */
-                    ++nScannedCount;
-
-                    /* Meter for output. */
-                    if(nScannedCount % 100000 == 0)
+                    /* Add to the wallet in chain order. */
+                    TAO::Ledger::BlockState state;
+                    for(uint32_t nIndex = 0; nIndex < vtx.size(); ++nIndex)
                     {
-                        /* Get the time it took to rescan. */
-                        uint32_t nElapsedSeconds = timer.Elapsed();
-                        debug::log(0, FUNCTION, "Processed ", nTransactionCount,
-                            " tx of ", nScannedCount, " in ", nElapsedSeconds, " seconds (",
-                            std::fixed, (double)(nScannedCount / (nElapsedSeconds > 0 ? nElapsedSeconds : 1 )), " tx/s)");
-                    }
-                }
+                        const TAO::Ledger::Transaction& tx = vtx[nIndex];
 
-                /* Set hash Last. */
-                hashLast = vtx.back().GetHash();
+                        /* Add to the wallet */
+                        if(vMine[nIndex] == 1 && AddToWalletIfInvolvingMe(tx, state, fUpdate, true, true))
+                            fnApply(tx.GetHash());
 
-                /* Check for end. */
-                if(vtx.size() != 1000)
-                    break;
-
-                /* Set first flag. */
-                fFirst = false;
-            }
+                        fnMeter();
+                    }
+                });
         }
 
         /* Get the time it took to rescan. */
@@ -1506,6 +1558,8 @@ namespace Legacy
 
                         wtx.MarkSpent(txin.prevout.n);
                         wtx.WriteToDisk(txin.prevout.hash);
+
+                        update_unspent(txin.prevout.hash, wtx);
                     }
                 }
             }
@@ -1588,7 +1642,10 @@ namespace Legacy
 
             /* Update mapWallet with repaired transactions */
             for (const auto& map : mapRepaired)
+            {
                 mapWallet[map.first] = map.second;
+                update_unspent(map.first, map.second);
+            }
         }
     }
 
@@ -2107,6 +2164,8 @@ namespace Legacy
                 txPrev.BindWallet(this);
                 txPrev.MarkSpent(txin.prevout.n);
                 txPrev.WriteToDisk(wtxNew.GetHash()); //Stores to wallet database
+
+                update_unspent(txin.prevout.hash, txPrev);
             }
         }
 
@@ -2134,10 +2193,8 @@ namespace Legacy
         /* Keep a local list of wallet pointers. */
         std::vector<uint512_t> vCoins;
 
-        /* Build a set of wallet transactions from all transaction in the wallet map */
-        vCoins.reserve(mapWallet.size());
-        for (const auto& item : mapWallet)
-            vCoins.push_back(item.first);
+        /* Build a set of wallet transactions from the transactions with unspent outputs */
+        vCoins.assign(setUnspent.begin(), setUnspent.end());
 
         /* Randomly order the transactions as potential inputs */
         std::random_shuffle(vCoins.begin(), vCoins.end(), LLC::GetRandInt);
@@ -2208,6 +2265,84 @@ namespace Legacy
     }
 
 
+    /* Add or remove a wallet transaction from the unspent index. */
+    void Wallet::update_unspent(const uint512_t& hash, const WalletTx& wtx)
+    {
+        /* Any change to a transaction expires the cached balances. */
+        ++nRevision;
+
+        for(uint32_t n = 0; n < wtx.vout.size(); ++n)
+        {
+            if(!wtx.IsSpent(n) && IsMine(wtx.vout[n]))
+            {
+                setUnspent.insert(hash);
+                return;
+            }
+        }
+
+        setUnspent.erase(hash);
+    }
+
+
+    /* Rebuild the unspent index from all of the wallet transactions. */
+    void Wallet::rebuild_unspent()
+    {
+        setUnspent.clear();
+        for(const auto& item : mapWallet)
+            update_unspent(item.first, item.second);
+
+        ++nRevision;
+    }
+
+
+    /* Get the wallet balances, working them out over the unspent index if the wallet or chain changed. */
+    const WalletBalances& Wallet::get_balances()
+    {
+        /* Check the cached balances are for this wallet and chain, and no future transactions have matured. */
+        const uint1024_t hashBest = TAO::Ledger::ChainState::hashBestChain.load();
+        const uint64_t nNow = runtime::unifiedtimestamp();
+        if(balances.nRevision == nRevision && balances.hashBest == hashBest && nNow < balances.nExpires)
+            return balances;
+
+        balances.nBalance     = 0;
+        balances.nUnconfirmed = 0;
+        balances.nStake       = 0;
+        balances.nMint        = 0;
+        balances.nRevision    = nRevision;
+        balances.hashBest     = hashBest;
+        balances.nExpires     = std::numeric_limits<uint64_t>::max();
+
+        /* Transactions without unspent outputs of ours have no available credit and no immature balance. */
+        for(const auto& hash : setUnspent)
+        {
+            const WalletTx& wtx = mapWallet.at(hash);
+
+            /* Transactions that aren't final can become final at any time, so don't cache. */
+            const bool fFinal = wtx.IsFinal();
+            if(!fFinal)
+                balances.nExpires = 0;
+
+            /* Confirmed, mature balance skipping future timestamps. */
+            const bool fConfirmed = fFinal && wtx.IsConfirmed();
+            if(fConfirmed && wtx.nTime > nNow)
+                balances.nExpires = std::min(balances.nExpires, uint64_t(wtx.nTime));
+            else if(fConfirmed)
+                balances.nBalance += wtx.GetAvailableCredit();
+            else
+                balances.nUnconfirmed += wtx.GetAvailableCredit();
+
+            /* Amount currently being staked is that amount in a coinstake tx that is not yet mature but has been added to chain */
+            if(wtx.IsCoinStake() && wtx.GetBlocksToMaturity() > 0 && wtx.GetDepthInMainChain() > 0)
+                balances.nStake += GetCredit(wtx);
+
+            if(wtx.IsCoinBase() && wtx.GetBlocksToMaturity() > 0 && wtx.GetDepthInMainChain() > 1)
+                balances.nMint += GetCredit(wtx);
+        }
+
+        return balances;
+    }
+
+
     /*
      *  Private load operations are accessible from WalletDB via friend declaration.
      *  Everyone else uses corresponding set/add operation.
@@ -2291,10 +2426,8 @@ namespace Legacy
         if(config::GetBoolArg("-printselectcoin", false))
             debug::log(0, FUNCTION, "Selecting coins for account ", strAccount);
 
-        /* Build a set of wallet transactions from all transaction in the wallet map */
-        vCoins.reserve(mapWallet.size());
-        for(const auto& item : mapWallet)
-            vCoins.push_back(item.first);
+        /* Build a set of wallet transactions from the transactions with unspent outputs */
+        vCoins.assign(setUnspent.begin(), setUnspent.end());
 
         /* Randomly order the transactions as potential inputs */
         std::random_shuffle(vCoins.begin(), vCoins.end(), LLC::GetRandInt);
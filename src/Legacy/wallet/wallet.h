@@ -91,6 +91,42 @@ namespace Legacy
     extern uint32_t WALLET_ACCOUNTING_TIMELOCK;
 
 
+    /** WalletBalances
+     *
+     *  Wallet balances worked out in a single pass, along with the wallet revision and chain they are valid for.
+     *
+     **/
+    struct WalletBalances
+    {
+        /** Confirmed, mature balance. **/
+        int64_t nBalance;
+
+
+        /** Balance of unconfirmed transactions. **/
+        int64_t nUnconfirmed;
+
+
+        /** Immature stake balance. **/
+        int64_t nStake;
+
+
+        /** Immature minted balance. **/
+        int64_t nMint;
+
+
+        /** The wallet revision the balances were worked out for. **/
+        uint64_t nRevision;
+
+
+        /** The best chain the balances were worked out for. **/
+        uint1024_t hashBest;
+
+
+        /** Timestamp the balances expire at, when transactions with future timestamps become spendable. **/
+        uint64_t nExpires;
+    };
+
+
     /** @class Wallet
      *
      *  A Wallet is an extension of a keystore, which also maintains a set of transactions and balances,
@@ -241,6 +277,20 @@ namespace Legacy
         uint64_t nWalletUnlockTime;
 
 
+        /** Hashes of the wallet transactions with unspent outputs belonging to this wallet.
+         *  Balances and coin selection only need these, rather than every transaction in the wallet history.
+         **/
+        std::set<uint512_t> setUnspent;
+
+
+        /** Counter incremented on every change to the wallet transactions, to expire cached balances. **/
+        uint64_t nRevision;
+
+
+        /** The last balances worked out. **/
+        WalletBalances balances;
+
+
 
     public:
         /** Mutex for thread concurrency across wallet operations **/
@@ -1076,6 +1126,39 @@ namespace Legacy
 
 
     private:
+
+        /** update_unspent
+         *
+         *  Add or remove a wallet transaction from the unspent index after its outputs or spent flags changed.
+         *  cs_wallet must be locked.
+         *
+         *  @param[in] hash The hash of the wallet transaction.
+         *  @param[in] wtx The wallet transaction.
+         *
+         **/
+        void update_unspent(const uint512_t& hash, const WalletTx& wtx);
+
+
+        /** rebuild_unspent
+         *
+         *  Rebuild the unspent index from all of the wallet transactions, used after loading or key changes.
+         *  cs_wallet must be locked.
+         *
+         **/
+        void rebuild_unspent();
+
+
+        /** get_balances
+         *
+         *  Get the wallet balances, working them out over the unspent index if the wallet or chain changed.
+         *  cs_wallet must be locked.
+         *
+         *  @return The current balances.
+         *
+         **/
+        const WalletBalances& get_balances();
+
+
     /*----------------------------------------------------------------------------------------*/
     /*  Load Wallet operations - require WalletDB declared friend                            */
     /*----------------------------------------------------------------------------------------*/
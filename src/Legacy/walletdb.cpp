@@ -711,6 +711,12 @@ namespace Legacy
             else
                 nRet = DB_LOAD_OK; // Will return this on successful completion
 
+            /* Index the unspent outputs of the loaded transactions. A rescan only indexes what it finds on chain, so do this for both results. */
+            {
+                RLOCK(wallet.cs_wallet);
+                wallet.rebuild_unspent();
+            }
+
             /* Update file version to latest version */
             if(nFileVersion < LLD::DATABASE_VERSION)
                 db.WriteVersion(LLD::DATABASE_VERSION);
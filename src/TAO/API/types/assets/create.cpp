@@ -53,7 +53,8 @@ namespace TAO
             uint256_t nSession = users->GetSession(params);
 
             /* Get the account. */
-            memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = users->GetAccount(nSession);
+            const std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> pUser = users->GetAccount(nSession);
+            memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = *pUser;
             if(!user)
                 throw APIException(-10, "Invalid session ID");
 
@@ -222,10 +222,10 @@ namespace TAO
                 }
 
                 /* Add mutable flag */
-                field["mutable"] = object.mapData[strName].second;
+                field["mutable"] = object.Mutable(strName);
 
                 /* If mutable, add the max size */
-                if(object.mapData[strName].second && nMaxSize > 0)
+                if(object.Mutable(strName) && nMaxSize > 0)
                     field["maxlength"] = nMaxSize;
 
                 /* Add the field to the response array */
@@ -18,6 +18,8 @@ ________________________________________________________________________________
 #include <TAO/API/types/function.h>
 #include <TAO/API/types/exception.h>
 #include <Util/include/debug.h>
+#include <Util/include/metrics.h>
+#include <Util/include/trace.h>
 
 /* Global TAO namespace. */
 namespace TAO
@@ -99,7 +101,14 @@ namespace TAO
                     strMethodToCall = RewriteURL(strMethod, jsonParamsUpdated);
 
                 if(mapFunctions.find(strMethodToCall) != mapFunctions.end())
+                {
+                    /* Time the method for the metrics registry, labelled only with known methods. */
+                    metrics::Timer timer(metrics::GetHistogram("nexus_api_method_seconds", "API method latency.",
+                        debug::safe_printstr("api=\"", GetName(), "\",method=\"", strMethodToCall, "\"")));
+                    trace::Span span("Method", strMethodToCall);
+
                     return mapFunctions[strMethodToCall].Execute(SanitizeParams(strMethodToCall, jsonParamsUpdated), fHelp);
+                }
                 else
                     throw APIException(-2, debug::safe_printstr("Method not found: ", strMethodToCall));
             }
@@ -56,7 +56,8 @@ namespace TAO
                 uint256_t nSession = users->GetSession(params, true);
 
                 /* Get the account. */
-                memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = users->GetAccount(nSession);
+                const std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> pUser = users->GetAccount(nSession);
+                memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = *pUser;
 
                 /* The register address that the name points to */
                 TAO::Register::Address hashRegister;
@@ -199,7 +199,8 @@ namespace TAO
             uint256_t nSession = users->GetSession(params, false);
 
             /* Get the account. */
-            memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = users->GetAccount(nSession);
+            const std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> pUser = users->GetAccount(nSession);
+            memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = *pUser;
             if(!user.IsNull())
             {
                 /* Set the namespace name to be the user's genesis ID */
@@ -0,0 +1,210 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_TAO_API_TYPES_SESSIONS_H
+#define NEXUS_TAO_API_TYPES_SESSIONS_H
+
+#include <LLC/types/uint1024.h>
+
+#include <TAO/Ledger/types/sigchain.h>
+
+#include <Util/include/memory.h>
+#include <Util/include/mutex.h>
+
+#include <array>
+#include <map>
+#include <memory>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* API Layer namespace. */
+    namespace API
+    {
+
+        /** Sessions
+         *
+         *  The logged in signature chains by session ID.
+         *
+         *  Sessions are split over shards with their own locks so that logins, logouts and lookups for different
+         *  sessions don't contend on one mutex. Each session's genesis is indexed in its own shard too, so checking
+         *  whether a user is already logged in doesn't have to decrypt every signature chain in memory.
+         *
+         *  Get hands out shared ownership of a session's signature chain. Removing a session takes it out of the map at
+         *  once, but the signature chain is only freed when the last caller still using it lets go.
+         *
+         **/
+        class Sessions
+        {
+            /** The number of shards, a power of two. **/
+            static const uint32_t SHARDS = 64;
+
+
+            /** Session
+             *
+             *  A logged in signature chain and its genesis.
+             *
+             **/
+            struct Session
+            {
+                /** The signature chain, shared with the callers using it. **/
+                std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> pUser;
+
+
+                /** The genesis of the signature chain, kept outside the encrypted memory as it is public. **/
+                uint256_t hashGenesis;
+            };
+
+
+            /** Shard
+             *
+             *  The sessions and genesis index for a range of keys.
+             *
+             **/
+            struct Shard
+            {
+                /** The mutex for this shard. **/
+                mutable std::mutex MUTEX;
+
+
+                /** The sessions whose ID falls in this shard. **/
+                std::map<uint256_t, Session> mapSessions;
+
+
+                /** The session IDs by genesis, for the genesis hashes that fall in this shard. **/
+                std::map<uint256_t, uint256_t> mapGenesis;
+            };
+
+
+            /** The shards. **/
+            mutable std::array<Shard, SHARDS> vShards;
+
+
+        public:
+
+            /** Default Constructor. **/
+            Sessions();
+
+
+            /** Destructor. **/
+            ~Sessions();
+
+
+            /** Has
+             *
+             *  Check if a session exists.
+             *
+             *  @param[in] nSession The session ID.
+             *
+             **/
+            bool Has(const uint256_t& nSession) const;
+
+
+            /** Get
+             *
+             *  Get the signature chain of a session. Keep the returned pointer for as long as the signature chain is used,
+             *  as a logout in the meantime only frees it once every holder is done.
+             *
+             *  @param[in] nSession The session ID.
+             *
+             *  @return The signature chain, which is null inside if the session doesn't exist.
+             *
+             **/
+            std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> Get(const uint256_t& nSession) const;
+
+
+            /** Genesis
+             *
+             *  Get the genesis of a session without decrypting its signature chain.
+             *
+             *  @param[in] nSession The session ID.
+             *  @param[out] hashGenesis The genesis of the session's signature chain.
+             *
+             *  @return true if the session exists.
+             *
+             **/
+            bool Genesis(const uint256_t& nSession, uint256_t &hashGenesis) const;
+
+
+            /** Find
+             *
+             *  Find the session a genesis is logged in with.
+             *
+             *  @param[in] hashGenesis The genesis to find.
+             *  @param[out] nSession The session ID.
+             *
+             *  @return true if the genesis is logged in.
+             *
+             **/
+            bool Find(const uint256_t& hashGenesis, uint256_t &nSession) const;
+
+
+            /** Add
+             *
+             *  Add a session, unless its genesis is already logged in or the session ID is taken.
+             *
+             *  @param[in] nSession The session ID.
+             *  @param[in] hashGenesis The genesis of the signature chain.
+             *  @param[in] user The signature chain, owned by the session once added, so the caller must not free it.
+             *
+             *  @return true if the session was added.
+             *
+             **/
+            bool Add(const uint256_t& nSession, const uint256_t& hashGenesis,
+                     memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user);
+
+
+            /** Remove
+             *
+             *  Remove a session. Its signature chain is freed once no caller holds it.
+             *
+             *  @param[in] nSession The session ID.
+             *
+             *  @return true if the session existed.
+             *
+             **/
+            bool Remove(const uint256_t& nSession);
+
+
+            /** Clear
+             *
+             *  Remove every session. Their signature chains are freed once no caller holds them.
+             *
+             **/
+            void Clear();
+
+
+            /** Size
+             *
+             *  @return The number of sessions.
+             *
+             **/
+            uint64_t Size() const;
+
+
+        private:
+
+            /** shard
+             *
+             *  Get the shard for a session ID or genesis.
+             *
+             **/
+            Shard& shard(const uint256_t& hashKey) const;
+
+        };
+    }
+}
+
+#endif
@@ -139,6 +139,20 @@ namespace TAO
             json::json Metrics(const json::json& params, bool fHelp);
 
 
+            /** Trace
+             *
+             *  Returns the trace spans recorded in a recent window in the Chrome trace event format,
+             *  optionally starting or stopping tracing first.
+             *
+             *  @param[in] params The parameters from the API call.
+             *  @param[in] fHelp Trigger for help data.
+             *
+             *  @return The return object in JSON.
+             *
+             **/
+            json::json Trace(const json::json& params, bool fHelp);
+
+
 
         private:
 
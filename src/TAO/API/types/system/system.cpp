@@ -47,6 +47,7 @@ namespace TAO
         {
             mapFunctions["get/info"]         = Function(std::bind(&System::GetInfo,    this, std::placeholders::_1, std::placeholders::_2));
             mapFunctions["get/metrics"]    = Function(std::bind(&System::Metrics,    this, std::placeholders::_1, std::placeholders::_2));
+            mapFunctions["get/trace"]        = Function(std::bind(&System::Trace,    this, std::placeholders::_1, std::placeholders::_2));
             mapFunctions["stop"]             = Function(std::bind(&System::Stop,    this, std::placeholders::_1, std::placeholders::_2));
             mapFunctions["list/peers"]       = Function(std::bind(&System::ListPeers,    this, std::placeholders::_1, std::placeholders::_2));
             mapFunctions["list/lisp-eids"]   = Function(std::bind(&System::LispEIDs, this, std::placeholders::_1, std::placeholders::_2));
@@ -203,7 +204,7 @@ namespace TAO
                             && LLP::TRITIUM_SERVER->pAddressManager->Has(connection->addr))
                             {
                                 /* Get the trust address from the address manager */
-                                const LLP::TrustAddress& trustAddress = LLP::TRITIUM_SERVER->pAddressManager->Get(connection->addr);
+                                const LLP::TrustAddress trustAddress = LLP::TRITIUM_SERVER->pAddressManager->Get(connection->addr);
 
                                 /* The number of connections successfully established with this peer since this node started */
                                 obj["connects"] = trustAddress.nConnected;
@@ -0,0 +1,78 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/API/types/system.h>
+
+#include <Util/include/json.h>
+#include <Util/include/string.h>
+#include <Util/include/trace.h>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* API Layer namespace. */
+    namespace API
+    {
+
+        /* Returns the recent trace spans in the Chrome trace event format. */
+        json::json System::Trace(const json::json& params, bool fHelp)
+        {
+            /* Check for the enable parameter to start or stop tracing. */
+            if(params.find("enable") != params.end())
+            {
+                /* Accept a boolean or its string form. */
+                bool fEnable = false;
+                if(params["enable"].is_boolean())
+                    fEnable = params["enable"].get<bool>();
+                else if(params["enable"].is_string()
+                    && (params["enable"] == "1" || params["enable"] == "true"
+                     || params["enable"] == "0" || params["enable"] == "false"))
+                    fEnable = (params["enable"] == "1" || params["enable"] == "true");
+                else
+                    throw APIException(-255, "Invalid enable value, must be true or false");
+
+                trace::Enable(fEnable);
+            }
+
+            /* Get the window in seconds, default to 10. */
+            uint64_t nSeconds = 10;
+            if(params.find("seconds") != params.end())
+            {
+                /* Accept a whole number or its string form, checking the string can be converted before converting it. */
+                if(params["seconds"].is_number_integer())
+                {
+                    if(params["seconds"].get<int64_t>() < 0)
+                        throw APIException(-257, "Seconds must be between 1 and 3600");
+
+                    nSeconds = params["seconds"].get<uint64_t>();
+                }
+                else if(params["seconds"].is_string()
+                    && IsAllDigit(params["seconds"].get<std::string>()) && IsUINT64(params["seconds"].get<std::string>()))
+                    nSeconds = std::stoull(params["seconds"].get<std::string>());
+                else
+                    throw APIException(-256, "Invalid seconds, must be a whole number");
+
+                /* Check the window is one the trace buffers can cover. */
+                if(nSeconds == 0 || nSeconds > 3600)
+                    throw APIException(-257, "Seconds must be between 1 and 3600");
+            }
+
+            /* Get the spans, the extra enabled field is ignored by trace viewers. */
+            json::json jsonRet = json::json::parse(trace::Dump(nSeconds));
+            jsonRet["enabled"] = trace::fEnabled.load();
+
+            return jsonRet;
+        }
+    }
+}
@@ -14,6 +14,7 @@ ________________________________________________________________________________
 #pragma once
 
 #include <TAO/API/types/base.h>
+#include <TAO/API/types/sessions.h>
 
 #include <TAO/Operation/types/contract.h>
 
@@ -50,8 +51,8 @@ namespace TAO
 
         private:
 
-            /** The signature chain for login and logout. */
-            mutable std::map<uint256_t, memory::encrypted_ptr<TAO::Ledger::SignatureChain> > mapSessions;
+            /** The signature chains for login and logout, by session. */
+            mutable Sessions sessions;
 
 
             /** The active pin for sessionless API use **/
@@ -84,6 +85,42 @@ namespace TAO
             std::atomic<bool> fShutdown;
 
 
+            /** EventsCursor
+             *
+             *  The state of the logged in signature chain when its notifications were last scanned.
+             *
+             **/
+            struct EventsCursor
+            {
+                /** The genesis that was scanned. **/
+                uint256_t hashGenesis;
+
+
+                /** The best chain at the time. **/
+                uint1024_t hashBest;
+
+
+                /** The last transaction of the signature chain, including the mempool. **/
+                uint512_t hashLast;
+
+
+                /** The number of tritium events for the signature chain. **/
+                uint32_t nSequence;
+
+
+                /** The number of legacy events for the signature chain. **/
+                uint32_t nLegacySequence;
+
+
+                /** The time of the scan. **/
+                uint64_t nTimestamp;
+            };
+
+
+            /** The events cursor, only used by the events thread. **/
+            EventsCursor cursorEvents;
+
+
         public:
 
 
@@ -201,13 +238,14 @@ namespace TAO
             /** GetAccount
              *
              *  Returns the sigchain the account logged in.
+             *  Hold the returned pointer while using the signature chain, so a logout can't free it in the meantime.
              *
              *  @param[in] nSession The session identifier.
              *
-             *  @return the signature chain.
+             *  @return the signature chain, which is null inside if not logged in.
              *
              **/
-            memory::encrypted_ptr<TAO::Ledger::SignatureChain>& GetAccount(uint256_t nSession) const;
+            std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> GetAccount(uint256_t nSession) const;
 
 
             /** GetActivePin
@@ -649,6 +687,20 @@ namespace TAO
           private:
 
 
+            /** events_changed
+             *
+             *  Check if anything that could add notifications for a signature chain has changed since it was last
+             *  scanned, moving the cursor on if so. Expiring contracts depend on the time alone, so a scan is also
+             *  due once EVENTS_RESCAN seconds have passed.
+             *
+             *  @param[in] hashGenesis The genesis hash for the sig chain owner.
+             *
+             *  @return true if the notifications need scanning.
+             *
+             **/
+            bool events_changed(const uint256_t& hashGenesis);
+
+
             /** get_events
              *
              *  Get the outstanding debits and transfer transactions.
@@ -153,12 +153,16 @@ namespace TAO
             /* The key type to use for the crypto keys */
             uint8_t nKeyType = config::GetBoolArg("-falcon") ? TAO::Ledger::SIGNATURE::FALCON : TAO::Ledger::SIGNATURE::BRAINPOOL;
 
+            /* Derive the auth, network and sign keys together. */
+            const std::vector<uint256_t> vKeys =
+                user->KeyHashes({std::string("auth"), std::string("network"), std::string("sign")}, 0, strPin, nKeyType);
+
             /* Create the crypto object. */
             TAO::Register::Object crypto = TAO::Register::CreateCrypto(
-                                                user->KeyHash("auth", 0, strPin, nKeyType),
+                                                vKeys[0],
                                                 0, //lisp key disabled for now
-                                                user->KeyHash("network", 0, strPin, nKeyType),
-                                                user->KeyHash("sign", 0, strPin, nKeyType),
+                                                vKeys[1],
+                                                vKeys[2],
                                                 0, //verify key disabled for now
                                                 0, //cert disabled for now
                                                 0, //app1 disabled for now
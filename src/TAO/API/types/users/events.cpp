@@ -47,6 +47,7 @@ ________________________________________________________________________________
 #include <Legacy/types/trustkey.h>
 
 #include <Util/include/debug.h>
+#include <Util/include/runtime.h>
 
 #include <vector>
 
@@ -55,6 +56,10 @@ namespace TAO
 {
     namespace API
     {
+        /* The most seconds between notification scans when nothing has changed, for contracts that expire. */
+        const uint64_t EVENTS_RESCAN = 60;
+
+
         /* Automatically logs in the sig chain using the credentials configured in the config file.  Will also create the sig
         *  chain if it doesn't exist and configured with autocreate=1.
         *  When autocreate=1 this will log in the user while sig chain create is still in the mempool */
@@ -147,9 +152,10 @@ namespace TAO
                     }
 
                     /* Setup the account. */
+                    if(!sessions.Add(0, hashGenesis, user))
                     {
-                        LOCK(MUTEX);
-                        mapSessions.emplace(0, std::move(user));
+                        user.free();
+                        throw APIException(-140, "Already logged in with a different username.");
                     }
 
                     /* Extract the PIN. */
@@ -231,13 +237,18 @@ namespace TAO
                     uint256_t nSession = users->GetSession(params);
 
                     /* Get the account. */
-                    memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = users->GetAccount(nSession);
+                    const std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> pUser = users->GetAccount(nSession);
+                    memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = *pUser;
                     if(!user)
                         throw APIException(-10, "Invalid session ID");
 
                     /* Set the hash genesis for this user. */
                     uint256_t hashGenesis = user->Genesis();
 
+                    /* Don't rescan the notifications if nothing has changed since the last pass. */
+                    if(!events_changed(hashGenesis))
+                        continue;
+
                     /* Set the genesis id for the user. */
                     params["genesis"] = hashGenesis.ToString();
 
@@ -814,12 +825,48 @@ namespace TAO
                 {
                     /* Log the error and attempt to continue processing */
                     debug::error(FUNCTION, e.what());
+
+                    /* Scan again on the next pass. */
+                    cursorEvents.hashGenesis = 0;
                 }
 
             }
         }
 
 
+        /* Check if anything that could add notifications for a signature chain has changed since it was last scanned. */
+        bool Users::events_changed(const uint256_t& hashGenesis)
+        {
+            /* Get the current state of the signature chain. */
+            EventsCursor cursor;
+            cursor.hashGenesis = hashGenesis;
+            cursor.hashBest    = TAO::Ledger::ChainState::hashBestChain.load();
+            cursor.nTimestamp  = runtime::timestamp();
+
+            cursor.hashLast = 0;
+            LLD::Ledger->ReadLast(hashGenesis, cursor.hashLast, TAO::Ledger::FLAGS::MEMPOOL);
+
+            cursor.nSequence = 0;
+            LLD::Ledger->ReadSequence(hashGenesis, cursor.nSequence);
+
+            cursor.nLegacySequence = 0;
+            LLD::Legacy->ReadSequence(hashGenesis, cursor.nLegacySequence);
+
+            /* Check against the last scan. */
+            if(cursor.hashGenesis     == cursorEvents.hashGenesis
+            && cursor.hashBest        == cursorEvents.hashBest
+            && cursor.hashLast        == cursorEvents.hashLast
+            && cursor.nSequence       == cursorEvents.nSequence
+            && cursor.nLegacySequence == cursorEvents.nLegacySequence
+            && cursor.nTimestamp       < cursorEvents.nTimestamp + EVENTS_RESCAN)
+                return false;
+
+            cursorEvents = cursor;
+
+            return true;
+        }
+
+
         /*  Notifies the events processor that an event has occurred so it
          *  can check and update it's state. */
         void Users::NotifyEvent()
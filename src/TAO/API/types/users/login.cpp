@@ -145,50 +145,54 @@ namespace TAO
             }
 
             /* Check the sessions. */
+            uint256_t nSession = 0;
+            if(sessions.Find(hashGenesis, nSession))
             {
-                LOCK(MUTEX);
-
-                for(const auto& session : mapSessions)
-                {
-                    if(hashGenesis == session.second->Genesis())
-                    {
-                        user.free();
+                user.free();
 
-                        ret["genesis"] = hashGenesis.ToString();
-                        if(config::fMultiuser.load())
-                            ret["session"] = session.first.ToString();
+                ret["genesis"] = hashGenesis.ToString();
+                if(config::fMultiuser.load())
+                    ret["session"] = nSession.ToString();
 
-                        return ret;
-                    }
-                }
-            }
-
-            /* If not using multiuser then check to see whether another user is already logged in */
-            if(!config::fMultiuser.load() && mapSessions.count(0) && mapSessions[0]->Genesis() != hashGenesis)
-            {
-                user.free();
-                throw APIException(-140, "Already logged in with a different username.");
+                return ret;
             }
 
             /* For sessionless API use the active sig chain which is stored in session 0 */
-            uint256_t nSession = config::fMultiuser.load() ? LLC::GetRand256() : 0;
+            nSession = config::fMultiuser.load() ? LLC::GetRand256() : 0;
             ret["genesis"] = hashGenesis.ToString();
 
             if(config::fMultiuser.load())
                 ret["session"] = nSession.ToString();
 
-            /* Setup the account. */
+            /* Setup the account, which fails if another login got there first. */
+            if(!sessions.Add(nSession, hashGenesis, user))
             {
-                LOCK(MUTEX);
-                mapSessions.emplace(nSession, std::move(user));
+                user.free();
+
+                /* Another request logged in the same user. */
+                uint256_t nExisting = 0;
+                if(sessions.Find(hashGenesis, nExisting))
+                {
+                    if(config::fMultiuser.load())
+                        ret["session"] = nExisting.ToString();
+
+                    return ret;
+                }
+
+                /* If not using multiuser then another user is already logged in */
+                throw APIException(-140, "Already logged in with a different username.");
             }
 
             /* If not using Multiuser then generate and cache the private key for the "network" key so that we can generate AUTH
                LLP messages to authenticate to peers */
             if(!config::fMultiuser.load())
             {
-                /* Get the private key. */
-                pAuthKey = new memory::encrypted_type<uint512_t>(user->Generate("network", 0, strPin));
+                /* Get the private key from the session, as the session owns the signature chain now. */
+                const std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> pUser = sessions.Get(nSession);
+                if(pUser->IsNull())
+                    throw APIException(-11, "User not logged in");
+
+                pAuthKey = new memory::encrypted_type<uint512_t>((*pUser)->Generate("network", 0, strPin));
 
                 /* Generate an AUTH message to send to all peers */
                 DataStream ssMessage = LLP::TritiumNode::GetAuth(true);
@@ -57,19 +57,16 @@ namespace TAO
             {
                 LOCK(MUTEX);
 
-                if(!mapSessions.count(nSession))
+                if(!sessions.Has(nSession))
                     throw APIException(-141, "Already logged out");
 
                 {
                     /* Lock the signature chain in case another process attempts to create a transaction . */
                     LOCK(CREATE_MUTEX);
 
-                    memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = mapSessions[nSession];
-
-                    user.free();
-
-                    /* Erase the session. */
-                    mapSessions.erase(nSession);
+                    /* Erase the session and free the sigchain. */
+                    if(!sessions.Remove(nSession))
+                        throw APIException(-141, "Already logged out");
 
                     if(!pActivePIN.IsNull())
                         pActivePIN.free();
@@ -25,6 +25,7 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/chainstate.h>
 #include <TAO/Ledger/include/create.h>
 
+#include <TAO/Ledger/types/event.h>
 #include <TAO/Ledger/types/transaction.h>
 #include <TAO/Ledger/types/mempool.h>
 #include <TAO/Ledger/types/sigchain.h>
@@ -41,6 +42,8 @@ ________________________________________________________________________________
 
 #include <Legacy/include/evaluate.h>
 
+#include <limits>
+
 /* Global TAO namespace. */
 namespace TAO
 {
@@ -117,9 +120,6 @@ namespace TAO
         bool Users::get_events(const uint256_t& hashGenesis,
                 std::vector<std::tuple<TAO::Operation::Contract, uint32_t, uint256_t>> &vContracts)
         {
-            /* Get notifications for personal genesis indexes. */
-            TAO::Ledger::Transaction tx;
-
             /* Keep track of unique proofs. */
             std::set<std::tuple<uint256_t, uint512_t, uint32_t>> setUnique;
 
@@ -132,77 +132,64 @@ namespace TAO
             /* Get the last event */
             LLD::Ledger->ReadSequence(hashGenesis, nSequence);
 
-            /* Decrement the current sequence number to get the last event sequence number */
-            --nSequence;
+            /* The chunk of compact events the current sequence is in, read once for all its sequences. */
+            TAO::Ledger::EventChunk chunk;
+            uint32_t nChunk = std::numeric_limits<uint32_t>::max();
+            bool fChunk = false;
 
             /* Look back through all events to find those that are not yet processed. */
-            while(LLD::Ledger->ReadEvent(hashGenesis, nSequence, tx))
+            while(nSequence > 0)
             {
                 /* Check to see if we have 100 (or the user configured amount) consecutive processed events.  If we do then we
                    assume all prior events are also processed.  This saves us having to scan the entire chain of events */
                 if(nConsecutive >= config::GetArg("-eventsdepth", 100))
                     break;
 
-                /* Check that the transaction is mature */
-                if(!LLD::Ledger->ReadMature(tx.GetHash()))
-                {
-                    /* If not, decrement the sequence id and continue to the next event. */
-                    --nSequence;
-                    continue;
-                }
+                /* Decrement the sequence number to get the event to check. */
+                --nSequence;
 
-                /* Loop through transaction contracts. */
-                uint32_t nContracts = tx.Size();
-                for(uint32_t nContract = 0; nContract < nContracts; ++nContract)
+                /* Move on to the chunk of this sequence. */
+                if(nSequence / TAO::Ledger::EVENT_CHUNK_SIZE != nChunk)
                 {
-                    /* Reference to contract to check */
-                    const TAO::Operation::Contract& contract = tx[nContract];
-
-                    /* The proof to check for this contract */
-                    uint256_t hashProof = 0;
+                    nChunk = nSequence / TAO::Ledger::EVENT_CHUNK_SIZE;
+                    fChunk = LLD::Ledger->ReadEventChunk(hashGenesis, nChunk, chunk);
+                }
 
-                    /* Reset the op stream */
-                    contract.Reset();
+                /* Get the event's contracts from its chunk, or from its transaction if they aren't in one. */
+                TAO::Ledger::Transaction tx;
+                bool fTx = false;
 
-                    /* The operation */
-                    uint8_t nOP;
-                    contract >> nOP;
+                std::vector<TAO::Ledger::Event> vEvents;
+                if(!fChunk || !chunk.Get(nSequence, vEvents))
+                {
+                    if(!LLD::Ledger->ReadEvent(hashGenesis, nSequence, tx))
+                        break;
 
-                    /* Check for conditional OP */
-                    switch(nOP)
-                    {
-                        case TAO::Operation::OP::VALIDATE:
-                        {
-                            /* Seek through validate. */
-                            contract.Seek(68);
-                            contract >> nOP;
+                    fTx = true;
+                    TAO::Ledger::Event::Parse(tx, tx.GetHash(), hashGenesis, nSequence, vEvents);
+                }
 
-                            break;
-                        }
+                /* Nothing in this event could be for us. */
+                if(vEvents.empty())
+                    continue;
 
-                        case TAO::Operation::OP::CONDITION:
-                        {
-                            /* Get new operation. */
-                            contract >> nOP;
-                        }
-                    }
+                /* Check that the transaction is mature */
+                const uint512_t hashTx = vEvents[0].hashTx;
+                if(!LLD::Ledger->ReadMature(hashTx))
+                    continue;
 
-                    /* Check for that the debit is meant for us. */
-                    switch(nOP)
+                /* Loop through the contracts. */
+                for(const auto& event : vEvents)
+                {
+                    /* Check for that the contract is meant for us. */
+                    switch(event.nOP)
                     {
                         /* Check for debit events. */
                         case TAO::Operation::OP::DEBIT:
                         {
-                            /* Get the source address which is the proof for the debit */
-                            contract >> hashProof;
-
-                            /* Get the recipient account */
-                            uint256_t hashTo;
-                            contract >> hashTo;
-
                             /* Retrieve the account. */
                             TAO::Register::State state;
-                            if(!LLD::Register->ReadState(hashTo, state))
+                            if(!LLD::Register->ReadState(event.hashTarget, state))
                                 continue;
 
                             /* Check owner that we are the owner of the recipient account  */
@@ -215,28 +202,9 @@ namespace TAO
                         /* Check for transfer events. */
                         case TAO::Operation::OP::TRANSFER:
                         {
-                            /* The register address being transferred */
-                            uint256_t hashRegister;
-                            contract >> hashRegister;
-
-                            /* Get recipient genesis hash */
-                            contract >> hashProof;
-
-                            /* Read the force transfer flag */
-                            uint8_t nType = 0;
-                            contract >> nType;
-
-                            /* Ensure this wasn't a forced transfer (which requires no Claim) */
-                            if(nType == TAO::Operation::TRANSFER::FORCE)
-                                continue;
-
-                            /* Check that we are the recipient */
-                            if(hashGenesis != hashProof)
-                                continue;
-
                             /* Check that the sender has not claimed it back (voided) */
                             TAO::Register::State state;
-                            if(!LLD::Register->ReadState(hashRegister, state))
+                            if(!LLD::Register->ReadState(event.hashTarget, state))
                                 continue;
 
                             /* Make sure the register claim is in SYSTEM pending from a transfer.  */
@@ -244,7 +212,7 @@ namespace TAO
                                 continue;
 
                             /* Make sure we haven't already claimed it */
-                            if(LLD::Ledger->HasProof(hashRegister, tx.GetHash(), nContract, TAO::Ledger::FLAGS::MEMPOOL))
+                            if(LLD::Ledger->HasProof(event.hashTarget, hashTx, event.nContract, TAO::Ledger::FLAGS::MEMPOOL))
                             {
                                 nConsecutive++;
                                 continue;
@@ -252,51 +220,39 @@ namespace TAO
 
                             break;
                         }
-
-                        /* Check for coinbase events. */
-                        case TAO::Operation::OP::COINBASE:
-                        {
-                            /* Unpack the miners genesis from the contract */
-                            contract >> hashProof;
-
-                            /* Check that we mined it */
-                            if(hashGenesis != hashProof)
-                                continue;
-
-                            break;
-                        }
-
-                        /* Default continue. */
-                        default:
-                            continue;
                     }
 
                     /* Check to see if we have already credited this debit. */
-                    uint512_t hashTx = tx.GetHash();
-                    if(LLD::Ledger->HasProof(hashProof, hashTx, nContract, TAO::Ledger::FLAGS::MEMPOOL))
+                    if(LLD::Ledger->HasProof(event.hashProof, hashTx, event.nContract, TAO::Ledger::FLAGS::MEMPOOL))
                     {
                         nConsecutive++;
                         continue;
                     }
 
                     /* Check that this is a unique proof. */
-                    if(setUnique.count(std::make_tuple(hashProof, hashTx, nContract)))
+                    if(setUnique.count(std::make_tuple(event.hashProof, hashTx, event.nContract)))
                     {
                         //TODO: remove this debug print, this is to ensure consistency with the internal events
-                        debug::error(FUNCTION, "non unique event proof ", hashTx.SubString(), ", ", hashProof.SubString(), ", ", nContract);
+                        debug::error(FUNCTION, "non unique event proof ", hashTx.SubString(), ", ", event.hashProof.SubString(), ", ", event.nContract);
                         continue;
                     }
 
+                    /* Only outstanding contracts need their transaction read. */
+                    if(!fTx)
+                    {
+                        if(!LLD::Ledger->ReadTx(hashTx, tx))
+                            break;
+
+                        fTx = true;
+                    }
+
                     /* Add the coinbase transaction and skip rest of contracts. */
-                    vContracts.push_back(std::make_tuple(contract, nContract, 0));
-                    setUnique.insert(std::make_tuple(hashProof, hashTx, nContract));
+                    vContracts.push_back(std::make_tuple(tx[event.nContract], event.nContract, 0));
+                    setUnique.insert(std::make_tuple(event.hashProof, hashTx, event.nContract));
 
                     /* Reset the consecutive counter since this has not been processed */
                     nConsecutive = 0;
                 }
-
-                /* Iterate the sequence id backwards. */
-                --nSequence;
             }
 
             return true;
@@ -849,8 +805,8 @@ namespace TAO
                 hashGenesis = TAO::Ledger::SignatureChain::Genesis(params["username"].get<std::string>().c_str());
 
             /* Get genesis by session. */
-            else if(!config::fMultiuser.load() && mapSessions.count(0))
-                hashGenesis = mapSessions[0]->Genesis();
+            else if(!config::fMultiuser.load() && sessions.Has(0))
+                sessions.Genesis(0, hashGenesis);
 
             /* Handle for no genesis. */
             else
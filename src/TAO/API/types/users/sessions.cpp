@@ -0,0 +1,207 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/API/types/sessions.h>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* API Layer namespace. */
+    namespace API
+    {
+
+        /* Free a session's signature chain when the last holder lets go of it. */
+        static void free_session(memory::encrypted_ptr<TAO::Ledger::SignatureChain>* pUser)
+        {
+            if(!pUser->IsNull())
+                pUser->free();
+
+            delete pUser;
+        }
+
+
+        /* Default Constructor. */
+        Sessions::Sessions()
+        : vShards ( )
+        {
+        }
+
+
+        /* Destructor. */
+        Sessions::~Sessions()
+        {
+            Clear();
+        }
+
+
+        /* Check if a session exists. */
+        bool Sessions::Has(const uint256_t& nSession) const
+        {
+            Shard& sessions = shard(nSession);
+            LOCK(sessions.MUTEX);
+
+            return sessions.mapSessions.count(nSession);
+        }
+
+
+        /* Get the signature chain of a session. */
+        std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> Sessions::Get(const uint256_t& nSession) const
+        {
+            {
+                Shard& sessions = shard(nSession);
+                LOCK(sessions.MUTEX);
+
+                auto it = sessions.mapSessions.find(nSession);
+                if(it != sessions.mapSessions.end())
+                    return it->second.pUser;
+            }
+
+            /* Callers check the signature chain for null, so they get an empty one of their own. */
+            return std::make_shared<memory::encrypted_ptr<TAO::Ledger::SignatureChain>>();
+        }
+
+
+        /* Get the genesis of a session without decrypting its signature chain. */
+        bool Sessions::Genesis(const uint256_t& nSession, uint256_t &hashGenesis) const
+        {
+            Shard& sessions = shard(nSession);
+            LOCK(sessions.MUTEX);
+
+            auto it = sessions.mapSessions.find(nSession);
+            if(it == sessions.mapSessions.end())
+                return false;
+
+            hashGenesis = it->second.hashGenesis;
+
+            return true;
+        }
+
+
+        /* Find the session a genesis is logged in with. */
+        bool Sessions::Find(const uint256_t& hashGenesis, uint256_t &nSession) const
+        {
+            Shard& index = shard(hashGenesis);
+            LOCK(index.MUTEX);
+
+            auto it = index.mapGenesis.find(hashGenesis);
+            if(it == index.mapGenesis.end())
+                return false;
+
+            nSession = it->second;
+
+            return true;
+        }
+
+
+        /* Add a session, unless its genesis is already logged in or the session ID is taken. */
+        bool Sessions::Add(const uint256_t& nSession, const uint256_t& hashGenesis,
+                           memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user)
+        {
+            Shard& sessions = shard(nSession);
+            Shard& index    = shard(hashGenesis);
+
+            /* Take both locks together so the session and its genesis are added at once. */
+            std::unique_lock<std::mutex> lkSessions(sessions.MUTEX, std::defer_lock);
+            std::unique_lock<std::mutex> lkIndex(index.MUTEX, std::defer_lock);
+            if(&sessions == &index)
+                lkSessions.lock();
+            else
+                std::lock(lkSessions, lkIndex);
+
+            /* Check for duplicates. */
+            if(index.mapGenesis.count(hashGenesis) || sessions.mapSessions.count(nSession))
+                return false;
+
+            /* Add the session, which frees the signature chain when it and its last holder are done with it. */
+            Session& session    = sessions.mapSessions[nSession];
+            session.pUser       = std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>>(
+                                      new memory::encrypted_ptr<TAO::Ledger::SignatureChain>(), free_session);
+            *session.pUser      = std::move(user);
+            session.hashGenesis = hashGenesis;
+
+            index.mapGenesis[hashGenesis] = nSession;
+
+            return true;
+        }
+
+
+        /* Remove a session, freeing its signature chain once no caller holds it. */
+        bool Sessions::Remove(const uint256_t& nSession)
+        {
+            /* Get the genesis first, as its shard has to be locked with the session's. */
+            uint256_t hashGenesis = 0;
+            if(!Genesis(nSession, hashGenesis))
+                return false;
+
+            Shard& sessions = shard(nSession);
+            Shard& index    = shard(hashGenesis);
+
+            std::unique_lock<std::mutex> lkSessions(sessions.MUTEX, std::defer_lock);
+            std::unique_lock<std::mutex> lkIndex(index.MUTEX, std::defer_lock);
+            if(&sessions == &index)
+                lkSessions.lock();
+            else
+                std::lock(lkSessions, lkIndex);
+
+            /* Check another thread didn't remove it in the meantime. */
+            auto it = sessions.mapSessions.find(nSession);
+            if(it == sessions.mapSessions.end())
+                return false;
+
+            /* The signature chain is freed once the calls still using it are done. */
+            sessions.mapSessions.erase(it);
+
+            /* Only erase the index if it still points at this session. */
+            auto itGenesis = index.mapGenesis.find(hashGenesis);
+            if(itGenesis != index.mapGenesis.end() && itGenesis->second == nSession)
+                index.mapGenesis.erase(itGenesis);
+
+            return true;
+        }
+
+
+        /* Remove every session, freeing their signature chains once no caller holds them. */
+        void Sessions::Clear()
+        {
+            for(auto& sessions : vShards)
+            {
+                LOCK(sessions.MUTEX);
+
+                sessions.mapSessions.clear();
+                sessions.mapGenesis.clear();
+            }
+        }
+
+
+        /* Get the number of sessions. */
+        uint64_t Sessions::Size() const
+        {
+            uint64_t nSize = 0;
+            for(const auto& sessions : vShards)
+            {
+                LOCK(sessions.MUTEX);
+                nSize += sessions.mapSessions.size();
+            }
+
+            return nSize;
+        }
+
+
+        /* Get the shard for a session ID or genesis. */
+        Sessions::Shard& Sessions::shard(const uint256_t& hashKey) const
+        {
+            return vShards[hashKey.Get64(0) & (SHARDS - 1)];
+        }
+    }
+}
@@ -41,11 +41,12 @@ namespace TAO
                 throw APIException(-145, "Unlock not supported in multiuser mode");
 
             /* Check default session (unlock only supported in single user mode). */
-            if(!mapSessions.count(0))
+            if(!sessions.Has(0))
                 throw APIException(-11, "User not logged in.");
 
             /* Get the sigchain from map of users. */
-            memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = mapSessions[0];
+            const std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> pUser = sessions.Get(0);
+            memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = *pUser;
 
             uint256_t hashGenesis = user->Genesis();
             /* populate response */
@@ -46,10 +46,10 @@ namespace TAO
                 hashGenesis.SetHex(params["genesis"].get<std::string>());
             else if(params.find("username") != params.end())
                 hashGenesis = TAO::Ledger::SignatureChain::Genesis(params["username"].get<std::string>().c_str());
-            else if(!config::fMultiuser.load() && mapSessions.count(0))
+            else if(!config::fMultiuser.load() && sessions.Has(0))
             {
                 /* If no specific genesis or username have been provided then fall back to the active sig chain */
-                hashGenesis = mapSessions[0]->Genesis();
+                sessions.Genesis(0, hashGenesis);
             }
             else
                 throw APIException(-111, "Missing genesis / username");
@@ -45,7 +45,7 @@ namespace TAO
                 throw APIException(-145, "Unlock not supported in multiuser mode");
 
             /* Check default session (unlock only supported in single user mode). */
-            if(!mapSessions.count(0))
+            if(!sessions.Has(0))
                 throw APIException(-11, "User not logged in.");
 
             /* Check for pin parameter. Parse the pin parameter. */
@@ -136,7 +136,8 @@ namespace TAO
             }
 
             /* Get the sigchain from map of users. */
-            memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = mapSessions[0];
+            const std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> pUser = sessions.Get(0);
+            memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = *pUser;
 
             /* Get the genesis ID. */
             uint256_t hashGenesis = user->Genesis();
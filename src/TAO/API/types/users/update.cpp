@@ -41,7 +41,8 @@ namespace TAO
             uint256_t nSession = GetSession(params);
 
             /* Get the account. */
-            memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = GetAccount(nSession);
+            const std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> pUser = GetAccount(nSession);
+            memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = *pUser;
             if(!user)
                 throw APIException(-10, "Invalid session ID");
 
@@ -256,7 +257,7 @@ namespace TAO
                 user.free();
 
                 /* Update the sig chain in session with the new password. */
-                mapSessions[nSession] = new TAO::Ledger::SignatureChain(userUpdated->UserName(), strNewPassword);
+                user = new TAO::Ledger::SignatureChain(userUpdated->UserName(), strNewPassword);
                 
                 /* Update the cached pin in memory with the new pin */
                 if(!pActivePIN.IsNull() && !pActivePIN->PIN().empty())
@@ -304,24 +305,20 @@ namespace TAO
             /* Declare operation stream to serialize all of the field updates*/
             TAO::Operation::Stream ssOperationStream;
 
-            /* Update the keys */
-            if(crypto.get<uint256_t>("auth") != 0)
-                ssOperationStream << std::string("auth") << uint8_t(TAO::Operation::OP::TYPES::UINT256_T) << user->KeyHash("auth", 0, strPin, tx.nKeyType);
-            
-            if(crypto.get<uint256_t>("lisp") != 0)
-                ssOperationStream << std::string("lisp") << uint8_t(TAO::Operation::OP::TYPES::UINT256_T) << user->KeyHash("lisp", 0, strPin, tx.nKeyType);
-
-            if(crypto.get<uint256_t>("network") != 0)
-                ssOperationStream << std::string("network") << uint8_t(TAO::Operation::OP::TYPES::UINT256_T) << user->KeyHash("network", 0, strPin, tx.nKeyType);
-
-            if(crypto.get<uint256_t>("sign") != 0)
-                ssOperationStream << std::string("sign") << uint8_t(TAO::Operation::OP::TYPES::UINT256_T) << user->KeyHash("sign", 0, strPin, tx.nKeyType);
+            /* Find the keys in use, the others stay disabled. */
+            std::vector<std::string> vTypes;
+            for(const auto& strType : {"auth", "lisp", "network", "sign", "verify", "cert"})
+            {
+                if(crypto.get<uint256_t>(strType) != 0)
+                    vTypes.push_back(strType);
+            }
 
-            if(crypto.get<uint256_t>("verify") != 0)
-                ssOperationStream << std::string("verify") << uint8_t(TAO::Operation::OP::TYPES::UINT256_T) << user->KeyHash("verify", 0, strPin, tx.nKeyType);
+            /* Derive the new keys together. */
+            const std::vector<uint256_t> vKeys = user->KeyHashes(vTypes, 0, strPin, tx.nKeyType);
 
-            if(crypto.get<uint256_t>("cert") != 0)
-                ssOperationStream << std::string("cert") << uint8_t(TAO::Operation::OP::TYPES::UINT256_T) << user->KeyHash("cert", 0, strPin, tx.nKeyType);
+            /* Update the keys */
+            for(uint32_t n = 0; n < vTypes.size(); ++n)
+                ssOperationStream << vTypes[n] << uint8_t(TAO::Operation::OP::TYPES::UINT256_T) << vKeys[n];
 
             /* Add the crypto update contract. */
             tx[tx.Size()] << uint8_t(TAO::Operation::OP::WRITE) << hashCrypto << ssOperationStream.Bytes();
@@ -37,14 +37,10 @@ namespace TAO
     /* API Layer namespace. */
     namespace API
     {
-        /* Returns the sigchain the account logged in. */
-        static memory::encrypted_ptr<TAO::Ledger::SignatureChain> null_ptr;
-
-
         /* Default Constructor. */
         Users::Users()
         : Base()
-        , mapSessions()
+        , sessions()
         , pActivePIN()
         , MUTEX()
         , EVENTS_MUTEX()
@@ -52,6 +48,7 @@ namespace TAO
         , CONDITION()
         , fEvent(false)
         , fShutdown(false)
+        , cursorEvents()
         , CREATE_MUTEX()
         {
             Initialize();
@@ -75,16 +72,8 @@ namespace TAO
                 EVENTS_THREAD.join();
             }
 
-            /* Iterate through the sessions map and delete any sig chains that are still active */
-            for(auto& session : mapSessions)
-            {
-                /* Check that is hasn't already been destroyed before freeing it*/
-                if(!session.second.IsNull())
-                    session.second.free();
-            }
-
-            /* Clear the sessions map of all entries */
-            mapSessions.clear();
+            /* Delete any sig chains that are still active */
+            sessions.Clear();
 
             if(!pActivePIN.IsNull())
                 pActivePIN.free();
@@ -94,9 +83,7 @@ namespace TAO
         /* Determine if a sessionless user is logged in. */
         bool Users::LoggedIn() const
         {
-            LOCK(MUTEX);
-
-            return !config::fMultiuser.load() && mapSessions.count(0);
+            return !config::fMultiuser.load() && sessions.Has(0);
         }
 
 
@@ -158,12 +145,13 @@ namespace TAO
         /* Returns a key from the account logged in. */
         uint512_t Users::GetKey(uint32_t nKey, SecureString strSecret, uint256_t nSession) const
         {
-            LOCK(MUTEX);
-
             /* For sessionless API use the active sig chain which is stored in session 0 */
             uint256_t nSessionToUse = config::fMultiuser.load() ? nSession : 0;
 
-            if(!mapSessions.count(nSessionToUse))
+            /* Hold the sigchain for the whole derivation, which is slow, so a logout can't free it underneath us. */
+            const std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> pUser = sessions.Get(nSessionToUse);
+            memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = *pUser;
+            if(user.IsNull())
             {
                 if(config::fMultiuser.load())
                     throw APIException(-9, debug::safe_printstr("Session ", nSessionToUse.ToString(), " doesn't exist"));
@@ -171,19 +159,19 @@ namespace TAO
                     throw APIException(-11, "User not logged in");
             }
 
-            return mapSessions[nSessionToUse]->Generate(nKey, strSecret);
+            return user->Generate(nKey, strSecret);
         }
 
 
         /* Returns the genesis ID from the account logged in. */
         uint256_t Users::GetGenesis(uint256_t nSession, bool fThrow) const
         {
-            LOCK(MUTEX);
-
             /* For sessionless API use the active sig chain which is stored in session 0 */
             uint256_t nSessionToUse = config::fMultiuser.load() ? nSession : 0;
 
-            if(!mapSessions.count(nSessionToUse))
+            /* The genesis is kept with the session, so the sigchain doesn't need decrypting. */
+            uint256_t hashGenesis = 0;
+            if(!sessions.Genesis(nSessionToUse, hashGenesis))
             {
                 if(fThrow)
                 {
@@ -198,7 +186,7 @@ namespace TAO
                 }
             }
 
-            return mapSessions[nSessionToUse]->Genesis(); //TODO: Assess the security of being able to generate genesis. Most likely this should be a localDB thing.
+            return hashGenesis;
         }
 
 
@@ -216,18 +204,13 @@ namespace TAO
 
 
         /*  Returns the sigchain the account logged in. */
-        memory::encrypted_ptr<TAO::Ledger::SignatureChain>& Users::GetAccount(uint256_t nSession) const
+        std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> Users::GetAccount(uint256_t nSession) const
         {
-            LOCK(MUTEX);
-
             /* For sessionless API use the active sig chain which is stored in session 0 */
             uint256_t nUse = config::fMultiuser.load() ? nSession : 0;
 
-            /* Check if you are logged in. */
-            if(!mapSessions.count(nUse))
-                return null_ptr;
-
-            return mapSessions[nUse];
+            /* Returns a null signature chain if you are not logged in. */
+            return sessions.Get(nUse);
         }
 
 
@@ -282,26 +282,78 @@ namespace TAO
 
 
         /* Generate the Merkle Tree from uint512_t hashes. */
-        uint512_t Block::BuildMerkleTree(std::vector<uint512_t> vMerkleTree) const
+        uint512_t Block::BuildMerkleTree(const std::vector<uint512_t>& vHashes) const
         {
-            uint32_t i = 0;
-            uint32_t j = 0;
-            uint32_t nSize = static_cast<uint32_t>(vMerkleTree.size());
+            /* Check for empty trees. */
+            if(vHashes.empty())
+                return 0;
+
+            /* Working copy of the leaves, each level is reduced in place at the front of this buffer. */
+            std::vector<uint512_t> vMerkleTree(vHashes);
 
+            uint32_t nSize = static_cast<uint32_t>(vMerkleTree.size());
             for(; nSize > 1; nSize = (nSize + 1) >> 1)
             {
-                for(i = 0; i < nSize; i += 2)
-                {
-                    /* get the references to the left and right leaves in the merkle tree */
-                    uint512_t &left_tx  = vMerkleTree[j+i];
-                    uint512_t &right_tx = vMerkleTree[j + std::min(i+1, nSize-1)];
+                /* Odd levels pair the last leaf with itself, grab it before the level is overwritten. */
+                const uint32_t nPairs = (nSize >> 1);
+                const uint512_t hashLast = vMerkleTree[nSize - 1];
+
+                /* Hash all of the full pairs in one batch, each pair is 128 contiguous bytes. */
+                LLC::SK512Batch((uint8_t*)&vMerkleTree[0], 128, nPairs, &vMerkleTree[0]);
+
+                /* Hash the odd leaf. */
+                if(nSize & 1)
+                    vMerkleTree[nPairs] = LLC::SK512(BEGIN(hashLast), END(hashLast), BEGIN(hashLast), END(hashLast));
+            }
+
+            return vMerkleTree[0];
+        }
 
-                    vMerkleTree.push_back(LLC::SK512(BEGIN(left_tx),  END(left_tx),
-                                                     BEGIN(right_tx), END(right_tx)));
+
+        /* Build the merkle branch for a leaf appended after the given hashes. */
+        std::vector<uint512_t> Block::BuildMerkleBranch(const std::vector<uint512_t>& vHashes) const
+        {
+            /* Working copy of the known leaves, each level is reduced in place like BuildMerkleTree. */
+            std::vector<uint512_t> vMerkleTree(vHashes);
+            std::vector<uint512_t> vBranch;
+
+            /* nIndex is the position of the unknown leaf, everything before it is known at every level. */
+            uint32_t nIndex = static_cast<uint32_t>(vMerkleTree.size());
+            for(; nIndex > 0; nIndex >>= 1)
+            {
+                /* Right hand leaves are paired with their left sibling, left hand leaves with themselves. */
+                if(nIndex & 1)
+                    vBranch.push_back(vMerkleTree[nIndex - 1]);
+
+                /* Hash the full pairs to the left of the unknown leaf. */
+                LLC::SK512Batch((uint8_t*)&vMerkleTree[0], 128, (nIndex >> 1), &vMerkleTree[0]);
+            }
+
+            return vBranch;
+        }
+
+
+        /* Calculate the merkle root from the last leaf and its merkle branch. */
+        uint512_t Block::BuildMerkleRoot(const uint512_t& hashLeaf, const std::vector<uint512_t>& vBranch, const uint32_t nIndex) const
+        {
+            uint512_t hashMerkle = hashLeaf;
+
+            uint32_t nBranch = 0;
+            for(uint32_t n = nIndex; n > 0; n >>= 1)
+            {
+                /* Pair with the left sibling from the branch. */
+                if(n & 1)
+                {
+                    const uint512_t& hashLeft = vBranch[nBranch++];
+                    hashMerkle = LLC::SK512(BEGIN(hashLeft), END(hashLeft), BEGIN(hashMerkle), END(hashMerkle));
                 }
-                j += nSize;
+
+                /* Pair with ourselves as the odd leaf. */
+                else
+                    hashMerkle = LLC::SK512(BEGIN(hashMerkle), END(hashMerkle), BEGIN(hashMerkle), END(hashMerkle));
             }
-            return (vMerkleTree.empty() ? 0 : vMerkleTree.back());
+
+            return hashMerkle;
         }
 
 
@@ -473,6 +525,20 @@ namespace TAO
         }
 
 
+        /* Get the input to StakeHash(hashGenesis) up to the nonce. */
+        std::vector<uint8_t> Block::StakePrefix(const uint256_t& hashGenesis) const
+        {
+            /* Create a data stream to get the prefix. */
+            DataStream ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
+            ss.reserve(256);
+
+            /* Serialize the same data as the stake hash, without the nonce. */
+            ss << nVersion << hashPrevBlock << nChannel << nHeight << nBits << hashGenesis;
+
+            return ss.Bytes();
+        }
+
+
         /* Generates the StakeHash for this block from a uint256_t hashGenesis*/
         uint1024_t Block::StakeHash(bool fGenesis, const uint576_t& hashTrustKey) const
         {
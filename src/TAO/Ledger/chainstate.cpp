@@ -21,6 +21,10 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/create.h>
 #include <TAO/Ledger/include/timelocks.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
 /* Global TAO namespace. */
 namespace TAO
 {
@@ -272,5 +276,32 @@ namespace TAO
         {
             return config::fTestNet.load() ? TAO::Ledger::hashGenesisTestnet : TAO::Ledger::hashGenesis;
         }
+
+
+        /* Mutex and condition for threads waiting on a new best chain. */
+        static std::mutex BEST_MUTEX;
+        static std::condition_variable BEST_CONDITION;
+
+
+        /* Sleep until the best chain moves off a block or a timeout passes. */
+        bool ChainState::WaitForBest(const uint1024_t& hashBlock, const uint64_t nMilliseconds)
+        {
+            std::unique_lock<std::mutex> lock(BEST_MUTEX);
+            BEST_CONDITION.wait_for(lock, std::chrono::milliseconds(nMilliseconds),
+                [&hashBlock]{ return hashBestChain.load() != hashBlock || config::fShutdown.load(); });
+
+            return hashBestChain.load() != hashBlock;
+        }
+
+
+        /* Wake the threads waiting for a new best chain. */
+        void ChainState::NotifyBest()
+        {
+            {
+                LOCK(BEST_MUTEX);
+            }
+
+            BEST_CONDITION.notify_all();
+        }
     }
 }
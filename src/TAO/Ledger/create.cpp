@@ -56,8 +56,71 @@ namespace TAO
         /* Condition variable for private blocks. */
         std::condition_variable PRIVATE_CONDITION;
 
-        /* Create a new block object from the chain.*/
-        static memory::atomic<TAO::Ledger::TritiumBlock> blockCache[4];
+        /** BlockTemplate
+         *
+         *  Cached block for a mining channel, along with the merkle branch of its producer so that
+         *  blocks with a new coinbase nonce only rehash the path to the merkle root.
+         *  Guarded by the users CREATE_MUTEX held in CreateBlock. The transactions are copied from the
+         *  template selection, which has its own lock.
+         *
+         **/
+        struct BlockTemplate
+        {
+            /** The cached block. **/
+            TAO::Ledger::TritiumBlock block;
+
+            /** The merkle branch of the producer for the cached block's transactions. **/
+            std::vector<uint512_t> vBranch;
+        };
+
+
+        /** TemplateSelection
+         *
+         *  Transactions from the memory pool selected for block templates. The selection is kept along
+         *  with the open miner memory transaction, so when the memory pool changes only the new
+         *  transactions are verified and connected. It is rebuilt when the best chain moves, when a
+         *  selected transaction leaves the memory pool, or after a transaction failed to connect.
+         *  Guarded by TEMPLATE_MUTEX.
+         *
+         **/
+        struct TemplateSelection
+        {
+            /** The best block the selection was built on. **/
+            uint1024_t hashBest;
+
+            /** The memory pool sequence last processed. **/
+            uint64_t nSequence;
+
+            /** Serialized size of a block holding the selected transactions. **/
+            uint64_t nSize;
+
+            /** Set when time dependent or failed checks skipped transactions, so the next update checks them again. **/
+            bool fPending;
+
+            /** Set when a transaction failed to connect, which can leave writes in the miner memory transaction. **/
+            bool fStale;
+
+            /** The selected transactions in block order. **/
+            std::vector<std::pair<uint8_t, uint512_t> > vtx;
+
+            /** Transactions already processed, whether they were selected or not. **/
+            std::set<uint512_t> setChecked;
+
+            /** Coinbase and coinstake transactions, which are never selected, so that their dependents are skipped. **/
+            std::set<uint512_t> setDependents;
+        };
+
+
+        /* The cached block templates by channel. */
+        static BlockTemplate blockCache[4];
+
+
+        /* The transactions selected for block templates. */
+        static TemplateSelection selection;
+
+
+        /* Mutex to guard the template selection and the miner memory transaction. */
+        static std::mutex TEMPLATE_MUTEX;
 
 
         /* Create a new transaction object from signature chain. */
@@ -126,29 +189,32 @@ namespace TAO
         }
 
 
-        /* Gets a list of transactions from memory pool for current block. */
-        void AddTransactions(TAO::Ledger::TritiumBlock& block)
+        /* Adds any new memory pool transactions to the template selection. Must hold TEMPLATE_MUTEX. */
+        static void SelectTransactions(const TAO::Ledger::BlockState& stateBest)
         {
-            /* Clear the transactions. */
-            block.vtx.clear();
+            /* Serialized size of a transaction entry in the block, the type byte and the 512-bit hash. */
+            const uint64_t nEntrySize = 1 + 64;
 
             /* Check the memory pool. */
             std::vector<uint512_t> vMempool;
             mempool.List(vMempool);
 
-            /* Start a ACID transaction (to be disposed). */
-            LLD::TxnBegin(FLAGS::MINER);
-
             debug::log(3, "BEGIN-------------------------------------");
 
+            /* Transactions skipped for this update only, they are checked again on the next update. */
+            std::set<uint512_t> setDeferred;
+
             /* Loop through the list of transactions. */
-            std::set<uint512_t> setDependents;
             for(const auto& hash : vMempool)
             {
                 /* Check the Size limits of the Current Block. */
-                if(::GetSerializeSize(block, SER_NETWORK, LLP::PROTOCOL_VERSION) + 256 >= MAX_BLOCK_SIZE)
+                if(selection.nSize + 256 >= MAX_BLOCK_SIZE)
                     break;
 
+                /* Skip transactions we have already processed. */
+                if(selection.setChecked.count(hash))
+                    continue;
+
                 /* Get the transaction from the memory pool. */
                 TAO::Ledger::Transaction tx;
                 if(!mempool.Get(hash, tx))
@@ -157,43 +223,38 @@ namespace TAO
                 /* Don't add transactions that are coinbase or coinstake. */
                 if(tx.IsCoinBase() || tx.IsCoinStake())
                 {
+                    selection.setChecked.insert(hash);
+
                     debug::log(2, FUNCTION, "Skipping transaction ", hash.SubString(), " - tx is coinbase/coinstake");
                     continue;
                 }
 
                 /* Check for failed dependants. */
-                if(setDependents.count(tx.hashPrevTx))
+                if(selection.setDependents.count(tx.hashPrevTx))
                 {
-                    setDependents.insert(hash);
+                    selection.setChecked.insert(hash);
+                    selection.setDependents.insert(hash);
 
                     debug::log(2, FUNCTION, "Skipping transaction ", hash.SubString(), " - INVALID dependent");
                     continue;
                 }
 
-                /* Check for timestamp violations. */
-                if(tx.nTimestamp > runtime::unifiedtimestamp() + runtime::maxdrift())
-                {
-                    setDependents.insert(hash);
-
-                    debug::log(2, FUNCTION, "Skipping transaction ", hash.SubString(), " - timesamp too far in future");
-                    continue;
-                }
-
-                /* Check the pre-states and post-states. */
-                if(!tx.Verify(FLAGS::MINER))
+                /* Check for deferred dependants. */
+                if(setDeferred.count(tx.hashPrevTx))
                 {
-                    setDependents.insert(hash);
+                    setDeferred.insert(hash);
 
-                    debug::log(2, FUNCTION, "Skipping transaction ", hash.SubString(), " - failed to verify");
+                    debug::log(2, FUNCTION, "Skipping transaction ", hash.SubString(), " - deferred dependent");
                     continue;
                 }
 
-                /* Check to see if this transaction connects. */
-                if(!tx.Connect(FLAGS::MINER))
+                /* Check for timestamp violations. */
+                if(tx.nTimestamp > runtime::unifiedtimestamp() + runtime::maxdrift())
                 {
-                    setDependents.insert(hash);
+                    setDeferred.insert(hash);
+                    selection.fPending = true;
 
-                    debug::log(2, FUNCTION, "Skipping transaction ", hash.SubString(), " - failed to connect");
+                    debug::log(2, FUNCTION, "Skipping transaction ", hash.SubString(), " - timesamp too far in future");
                     continue;
                 }
 
@@ -203,29 +264,51 @@ namespace TAO
                    we need to omit this transaction also. The simplest solution for this is to skip any transactions that are not
                    the first in the sequence if the hash last is not currently on disk. If a sig chain transcation and subsequent
                    transaction genuinely should be in the same block, then ths will just result in the subsequent transaction being
-                   left out of this block and included in the next.*/
+                   left out of this block and included in the next. This is checked before connecting so a skipped transaction
+                   leaves nothing in the miner memory transaction.*/
                 uint512_t hashLast = 0;
                 if(!tx.IsFirst() && !LLD::Ledger->ReadLast(tx.hashGenesis, hashLast) )
                 {
-                    setDependents.insert(hash);
+                    setDeferred.insert(hash);
 
                     debug::log(2, FUNCTION, "Skipping transaction ", hash.SubString(), " - genesis not on disk");
                     continue;
                 }
 
+                /* Check the pre-states and post-states. This can fail just because a transaction it depends on was listed
+                   after it, so it is checked again on the next update. */
+                if(!tx.Verify(FLAGS::MINER))
+                {
+                    setDeferred.insert(hash);
+                    selection.fPending = true;
+
+                    debug::log(2, FUNCTION, "Skipping transaction ", hash.SubString(), " - failed to verify");
+                    continue;
+                }
+
+                /* Check to see if this transaction connects. A failed connect can be partially applied to the miner memory
+                   transaction, so the selection is rebuilt on the next update. */
+                if(!tx.Connect(FLAGS::MINER))
+                {
+                    setDeferred.insert(hash);
+                    selection.fStale = true;
+
+                    debug::log(2, FUNCTION, "Skipping transaction ", hash.SubString(), " - failed to connect");
+                    continue;
+                }
+
                 /* Dump sequence on verbose 3 levels. */
                 if(config::nVerbose >= 3)
                     tx.print();
 
-                /* Add the transaction to the block. */
-                block.vtx.push_back(std::make_pair(TRANSACTION::TRITIUM, hash));
+                /* Add the transaction to the selection. */
+                selection.setChecked.insert(hash);
+                selection.vtx.push_back(std::make_pair(TRANSACTION::TRITIUM, hash));
+                selection.nSize += nEntrySize;
             }
 
             debug::log(3, "END-------------------------------------");
 
-            /* Abort the temporary ACID transaction. */
-            LLD::TxnAbort(FLAGS::MINER);
-
             /* Clear for legacy. */
             vMempool.clear();
 
@@ -234,13 +317,17 @@ namespace TAO
             TAO::Ledger::mempool.List(vMempool, 100, true);
 
             /* Loop through the list of transactions. */
-            TAO::Ledger::BlockState stateBest = TAO::Ledger::ChainState::stateBest.load();
+            TAO::Ledger::BlockState state = stateBest;
             for(const auto& hash : vMempool)
             {
                 /* Check the Size limits of the Current Block. */
-                if(::GetSerializeSize(block, SER_NETWORK, LLP::PROTOCOL_VERSION) + 256 >= MAX_BLOCK_SIZE)
+                if(selection.nSize + 256 >= MAX_BLOCK_SIZE)
                     break;
 
+                /* Skip transactions we have already selected. Legacy failures depend on the memory pool, so they are retried. */
+                if(selection.setChecked.count(hash))
+                    continue;
+
                 /* Get the transaction from the memory pool. */
                 Legacy::Transaction tx;
                 if(!mempool.Get(hash, tx))
@@ -259,13 +346,18 @@ namespace TAO
                 /* Check transaction for finality. */
                 if(!tx.IsFinal())
                 {
+                    selection.fPending = true;
+
                     debug::log(2, FUNCTION, "Mempool transaction is not Final ", hash.SubString(10));
                     continue;
                 }
 
                 /* Check for timestamp violations. */
                 if(tx.nTime > runtime::unifiedtimestamp() + runtime::maxdrift())
+                {
+                    selection.fPending = true;
                     continue;
+                }
 
                 /* Retrieve tx inputs */
                 std::map<uint512_t, std::pair<uint8_t, DataStream> > mapInputs;
@@ -284,7 +376,7 @@ namespace TAO
                 }
 
                 /* Check that transction can be connected. */
-                if(!tx.Connect(mapInputs, stateBest, FLAGS::MINER))
+                if(!tx.Connect(mapInputs, state, FLAGS::MINER))
                 {
                     debug::log(2, FUNCTION, "Failed to connect inputs ", hash.SubString(10));
                     continue;
@@ -294,12 +386,60 @@ namespace TAO
                 if(config::nVerbose >= 3)
                     tx.print();
 
-                /* Add the transaction to the block. */
-                block.vtx.push_back(std::make_pair(TRANSACTION::LEGACY, hash));
+                /* Add the transaction to the selection. */
+                selection.setChecked.insert(hash);
+                selection.vtx.push_back(std::make_pair(TRANSACTION::LEGACY, hash));
+                selection.nSize += nEntrySize;
             }
         }
 
 
+        /* Gets a list of transactions from memory pool for current block. */
+        void AddTransactions(TAO::Ledger::TritiumBlock& block)
+        {
+            LOCK(TEMPLATE_MUTEX);
+
+            /* Get the state to check for changes against. */
+            const TAO::Ledger::BlockState stateBest = ChainState::stateBest.load();
+            const uint64_t nSequence = mempool.Sequence();
+
+            /* Only touch the memory pool if the chain or the pool has changed since the last update. */
+            bool fRebuild = (selection.hashBest != stateBest.GetHash() || selection.fStale);
+            if(fRebuild || selection.fPending || selection.nSequence != nSequence)
+            {
+                /* Selected transactions leaving the memory pool invalidate the states connected after them. */
+                for(auto tx = selection.vtx.begin(); tx != selection.vtx.end() && !fRebuild; ++tx)
+                    fRebuild = !mempool.Has(tx->second);
+
+                /* Start over from the new best chain. */
+                if(fRebuild)
+                {
+                    debug::log(2, FUNCTION, "Rebuilding block template transactions at ", stateBest.GetHash().SubString());
+
+                    selection.hashBest = stateBest.GetHash();
+                    selection.nSize    = ::GetSerializeSize(TAO::Ledger::TritiumBlock(), SER_NETWORK, LLP::PROTOCOL_VERSION);
+                    selection.vtx.clear();
+                    selection.setChecked.clear();
+                    selection.setDependents.clear();
+                    selection.fStale   = false;
+
+                    /* Start a new ACID transaction, kept open so later updates connect on top of the selection. */
+                    LLD::TxnBegin(FLAGS::MINER);
+                }
+
+                /* Set the sequence before listing so that changes while we work trigger another update. */
+                selection.nSequence = nSequence;
+                selection.fPending  = false;
+
+                /* Extend the selection with new memory pool transactions. */
+                SelectTransactions(stateBest);
+            }
+
+            /* Copy the selected transactions. */
+            block.vtx = selection.vtx;
+        }
+
+
         /* Populate block header data for a new block. */
         void AddBlockData(const TAO::Ledger::BlockState& stateBest, const uint32_t nChannel, TAO::Ledger::TritiumBlock& block)
         {
@@ -353,14 +493,26 @@ namespace TAO
                 block.nVersion = nCurrent - 1;
 
             /* Handle if the block is cached. */
-            if(ChainState::stateBest.load().GetHash() == blockCache[nChannel].load().hashPrevBlock)
+            BlockTemplate& blockTemplate = blockCache[nChannel];
+            if(ChainState::stateBest.load().GetHash() == blockTemplate.block.hashPrevBlock)
             {
                 /* Set the block to cached block. */
-                block = blockCache[nChannel].load();
+                block = blockTemplate.block;
 
                 /* Add new transactions. */
                 AddTransactions(block);
 
+                /* Only rebuild the producer's merkle branch if the transactions changed. */
+                if(block.vtx != blockTemplate.block.vtx)
+                {
+                    std::vector<uint512_t> vHashes;
+                    for(const auto& tx : block.vtx)
+                        vHashes.push_back(tx.second);
+
+                    blockTemplate.vBranch   = block.BuildMerkleBranch(vHashes);
+                    blockTemplate.block.vtx = block.vtx;
+                }
+
                 /* Check that the producer isn't going to orphan any transactions. */
                 TAO::Ledger::Transaction tx;
                 if(mempool.Get(block.producer.hashGenesis, tx) && block.producer.hashPrevTx != tx.GetHash())
@@ -376,7 +528,7 @@ namespace TAO
                     UpdateProducerTimestamp(block);
 
                     /* Store new block cache. */
-                    blockCache[nChannel].store(block);
+                    blockTemplate.block = block;
                 }
 
                 /* Use the extra nonce if block is coinbase. */
@@ -461,16 +613,9 @@ namespace TAO
                 /* Sign the producer transaction. */
                 block.producer.Sign(user->Generate(block.producer.nSequence, pin));
 
-                /* Rebuild the merkle tree for updated block. */
-                std::vector<uint512_t> vHashes;
-                for(const auto& tx : block.vtx)
-                    vHashes.push_back(tx.second);
-
-                /* Producer transaction is last. */
-                vHashes.push_back(block.producer.GetHash());
-
-                /* Build the block's merkle root. */
-                block.hashMerkleRoot  = block.BuildMerkleTree(vHashes);
+                /* Producer transaction is last, so only its path to the root needs hashing. */
+                block.hashMerkleRoot = block.BuildMerkleRoot(block.producer.GetHash(), blockTemplate.vBranch,
+                    static_cast<uint32_t>(block.vtx.size()));
             }
             else //block not cached, set up new block
             {
@@ -628,8 +773,14 @@ namespace TAO
                 /* Populate the block metadata */
                 AddBlockData(stateBest, nChannel, block);
 
+                /* Build the producer's merkle branch for the cached block. */
+                std::vector<uint512_t> vHashes;
+                for(const auto& tx : block.vtx)
+                    vHashes.push_back(tx.second);
+
                 /* Store the cached block. */
-                blockCache[nChannel].store(block);
+                blockTemplate.block   = block;
+                blockTemplate.vBranch = block.BuildMerkleBranch(vHashes);
             }
 
             /* Update the time for the newly created block. */
@@ -0,0 +1,216 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/Ledger/types/event.h>
+#include <TAO/Ledger/types/transaction.h>
+
+#include <TAO/Operation/include/enum.h>
+#include <TAO/Operation/types/contract.h>
+
+#include <TAO/Register/include/constants.h>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        /* Default Constructor. */
+        Event::Event()
+        : hashTx     (0)
+        , nSequence  (0)
+        , nContract  (0)
+        , nOP        (0)
+        , hashProof  (0)
+        , hashTarget (0)
+        , nAmount    (0)
+        , nTimestamp (0)
+        {
+        }
+
+
+        /* Get the events a transaction raises for an address. */
+        void Event::Parse(const Transaction& tx, const uint512_t& hashTx, const uint256_t& hashAddress,
+                          const uint32_t nSequence, std::vector<Event> &vEvents)
+        {
+            const uint32_t nContracts = tx.Size();
+            for(uint32_t nContract = 0; nContract < nContracts; ++nContract)
+            {
+                /* Reference to contract to check */
+                const TAO::Operation::Contract& contract = tx[nContract];
+
+                Event event;
+                event.hashTx     = hashTx;
+                event.nSequence  = nSequence;
+                event.nContract  = nContract;
+                event.nTimestamp = tx.nTimestamp;
+
+                /* Malformed contracts can't raise events. */
+                try
+                {
+                    /* Reset the op stream */
+                    contract.Reset();
+                    contract >> event.nOP;
+
+                    /* Check for conditional OP */
+                    switch(event.nOP)
+                    {
+                        case TAO::Operation::OP::VALIDATE:
+                        {
+                            /* Seek through validate. */
+                            contract.Seek(68);
+                            contract >> event.nOP;
+
+                            break;
+                        }
+
+                        case TAO::Operation::OP::CONDITION:
+                        {
+                            /* Get new operation. */
+                            contract >> event.nOP;
+                        }
+                    }
+
+                    switch(event.nOP)
+                    {
+                        /* Debits to an account, the owner is checked when read as it can change. */
+                        case TAO::Operation::OP::DEBIT:
+                        {
+                            contract >> event.hashProof;
+                            contract >> event.hashTarget;
+                            contract >> event.nAmount;
+
+                            if(event.hashTarget == TAO::Register::WILDCARD_ADDRESS)
+                                continue;
+
+                            break;
+                        }
+
+                        /* Transfers to this address that must be claimed. */
+                        case TAO::Operation::OP::TRANSFER:
+                        {
+                            contract >> event.hashTarget;
+                            contract >> event.hashProof;
+
+                            uint8_t nType = 0;
+                            contract >> nType;
+
+                            if(nType == TAO::Operation::TRANSFER::FORCE || event.hashProof != hashAddress)
+                                continue;
+
+                            break;
+                        }
+
+                        /* Coinbases paid to this address. */
+                        case TAO::Operation::OP::COINBASE:
+                        {
+                            contract >> event.hashProof;
+                            contract >> event.nAmount;
+
+                            if(event.hashProof != hashAddress)
+                                continue;
+
+                            break;
+                        }
+
+                        default:
+                            continue;
+                    }
+                }
+                catch(const std::exception& e)
+                {
+                    continue;
+                }
+
+                vEvents.push_back(event);
+            }
+        }
+
+
+        /* Default Constructor. */
+        EventChunk::EventChunk()
+        : vStates (EVENT_CHUNK_SIZE, EMPTY)
+        , vEvents (EVENT_CHUNK_SIZE)
+        {
+        }
+
+
+        /* Set the events of a sequence. */
+        void EventChunk::Set(const uint32_t nSequence, const std::vector<Event>& vSequence)
+        {
+            const uint32_t nSlot = nSequence % EVENT_CHUNK_SIZE;
+            if(nSlot >= vStates.size() || nSlot >= vEvents.size())
+                return;
+
+            /* Slots keep their size when not SINGLE so the chunk is the same size whatever it holds. */
+            vEvents[nSlot] = (vSequence.size() == 1 ? vSequence[0] : Event());
+
+            if(vSequence.empty())
+                vStates[nSlot] = NONE;
+            else if(vSequence.size() == 1)
+                vStates[nSlot] = SINGLE;
+            else
+                vStates[nSlot] = MANY;
+        }
+
+
+        /* Clear the slot of a sequence. */
+        void EventChunk::Clear(const uint32_t nSequence)
+        {
+            const uint32_t nSlot = nSequence % EVENT_CHUNK_SIZE;
+            if(nSlot >= vStates.size() || nSlot >= vEvents.size())
+                return;
+
+            vStates[nSlot] = EMPTY;
+            vEvents[nSlot] = Event();
+        }
+
+
+        /* Check if no sequence in the chunk is written. */
+        bool EventChunk::Empty() const
+        {
+            for(const auto& nState : vStates)
+            {
+                if(nState != EMPTY)
+                    return false;
+            }
+
+            return true;
+        }
+
+
+        /* Get the events of a sequence. */
+        bool EventChunk::Get(const uint32_t nSequence, std::vector<Event> &vSequence) const
+        {
+            const uint32_t nSlot = nSequence % EVENT_CHUNK_SIZE;
+            if(nSlot >= vStates.size() || nSlot >= vEvents.size())
+                return false;
+
+            switch(vStates[nSlot])
+            {
+                case NONE:
+                    return true;
+
+                case SINGLE:
+                {
+                    vSequence.push_back(vEvents[nSlot]);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    }
+}
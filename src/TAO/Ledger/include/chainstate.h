@@ -89,6 +89,27 @@ namespace TAO
             uint1024_t Genesis();
 
 
+            /** WaitForBest
+             *
+             *  Sleep until the best chain moves off a block, shutdown starts, or a timeout passes.
+             *
+             *  @param[in] hashBlock The best block when the wait started.
+             *  @param[in] nMilliseconds The longest time to sleep.
+             *
+             *  @return True if the best chain moved.
+             *
+             **/
+            bool WaitForBest(const uint1024_t& hashBlock, const uint64_t nMilliseconds);
+
+
+            /** NotifyBest
+             *
+             *  Wake the threads waiting for a new best chain.
+             *
+             **/
+            void NotifyBest();
+
+
             /** The best block in the chain. **/
             extern memory::atomic<BlockState> stateBest;
 
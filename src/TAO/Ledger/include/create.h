@@ -52,7 +52,8 @@ namespace TAO
 
         /** AddTransactions
          *
-         *  Gets a list of transactions from memory pool for current block.
+         *  Gets a list of transactions from memory pool for current block. The selection is cached
+         *  and only new memory pool transactions are checked until the best chain changes.
          *
          *  @param[out] block The block to add the transactions to.
          *
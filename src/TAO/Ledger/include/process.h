@@ -19,6 +19,8 @@ ________________________________________________________________________________
 
 #include <TAO/Ledger/types/block.h>
 
+#include <Util/templates/flatmap.h>
+
 #include <map>
 #include <mutex>
 #include <memory>
@@ -47,7 +49,7 @@ namespace TAO
 
 
         /** Static instantiation of orphan blocks in queue to process. **/
-        extern std::map<uint1024_t, std::unique_ptr<TAO::Ledger::Block>> mapOrphans;
+        extern FlatMap<uint1024_t, std::unique_ptr<TAO::Ledger::Block>> mapOrphans;
 
 
         /** Mutex to protect checking more than one block at a time. **/
@@ -0,0 +1,48 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#pragma once
+#ifndef NEXUS_TAO_LEDGER_INCLUDE_REPLAY_H
+#define NEXUS_TAO_LEDGER_INCLUDE_REPLAY_H
+
+#include <cstdint>
+#include <string>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        /** Replay
+         *
+         *  Replays the best chain stored in another data directory through Check and Accept into this node's
+         *  databases, logging the time spent reading, checking, accepting and connecting the blocks.
+         *  The source is opened read only, and replay starts after this node's best block so an interrupted
+         *  replay can be resumed.
+         *
+         *  @param[in] strSource The directory holding the source _LEDGER and _LEGACY databases.
+         *  @param[in] nHeight The height to stop at, 0 for the end of the source chain.
+         *
+         *  @return true if every block was accepted.
+         *
+         **/
+        bool Replay(const std::string& strSource, const uint32_t nHeight = 0);
+
+    }
+}
+
+#endif
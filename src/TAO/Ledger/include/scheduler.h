@@ -0,0 +1,124 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_TAO_LEDGER_INCLUDE_SCHEDULER_H
+#define NEXUS_TAO_LEDGER_INCLUDE_SCHEDULER_H
+
+#include <LLC/types/uint1024.h>
+
+#include <Util/include/arena.h>
+
+#include <map>
+#include <vector>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+        /* Forward declarations. */
+        class Transaction;
+
+
+        /** ConnectSet
+         *
+         *  Get the set of sigchains, registers and transactions a transaction touches when connected to a block.
+         *  Only transactions made of simple register operations (write, append, create, debit, credit and fee)
+         *  have a known set, anything else returns false and must be connected on its own in block order.
+         *
+         *  @param[in] tx The transaction to check.
+         *  @param[in] hashTx The hash of the transaction.
+         *  @param[out] vAddresses The sigchains and registers read or written.
+         *  @param[out] vTransactions The transactions read or written, including this one.
+         *
+         *  @return true if the transaction can be connected concurrently with others that don't share its set.
+         *
+         **/
+        bool ConnectSet(const Transaction& tx, const uint512_t& hashTx,
+                        std::vector<uint256_t> &vAddresses, std::vector<uint512_t> &vTransactions);
+
+
+        /** ConnectScheduler
+         *
+         *  Orders transactions into waves by their connect sets. A transaction is put in the wave after the
+         *  last wave that touched any of its addresses or transactions, so transactions in the same wave are
+         *  independent, and any two transactions that share a key connect in block order.
+         *
+         **/
+        class ConnectScheduler
+        {
+            /** The last wave that used each address. **/
+            std::map<uint256_t, uint32_t, std::less<uint256_t>,
+                     ArenaAllocator<std::pair<const uint256_t, uint32_t>>> mapAddresses;
+
+
+            /** The last wave that used each transaction. **/
+            std::map<uint512_t, uint32_t, std::less<uint512_t>,
+                     ArenaAllocator<std::pair<const uint512_t, uint32_t>>> mapTransactions;
+
+
+            /** The block indexes scheduled in each wave. **/
+            std::vector<std::vector<uint32_t>> vWaves;
+
+
+        public:
+
+            /** Default Constructor. **/
+            ConnectScheduler();
+
+
+            /** Schedule
+             *
+             *  Add a transaction to the schedule.
+             *
+             *  @param[in] nIndex The index of the transaction to be returned in its wave.
+             *  @param[in] vAddresses The sigchains and registers the transaction uses.
+             *  @param[in] vTransactions The transactions the transaction uses.
+             *
+             *  @return The wave the transaction was put in.
+             *
+             **/
+            uint32_t Schedule(const uint32_t nIndex, const std::vector<uint256_t>& vAddresses,
+                              const std::vector<uint512_t>& vTransactions);
+
+
+            /** Waves
+             *
+             *  Get the scheduled waves, each a list of indexes in the order they were scheduled.
+             *
+             **/
+            const std::vector<std::vector<uint32_t>>& Waves() const;
+
+
+            /** Empty
+             *
+             *  @return true if nothing is scheduled.
+             *
+             **/
+            bool Empty() const;
+
+
+            /** Clear
+             *
+             *  Clear the schedule.
+             *
+             **/
+            void Clear();
+        };
+    }
+}
+
+#endif
@@ -30,6 +30,8 @@ ________________________________________________________________________________
 
 #include <TAO/Ledger/include/create.h>
 
+#include <Util/include/metrics.h>
+
 
 /* Global TAO namespace. */
 namespace TAO
@@ -43,14 +45,17 @@ namespace TAO
         /** Default Constructor. **/
         Mempool::Mempool()
         : MUTEX              ( )
+        , INDEX_MUTEX        ( )
         , mapLegacy          ( )
         , mapLegacyConflicts ( )
         , mapLedger          ( )
+        , mapGenesis         ( )
         , mapConflicts       ( )
+        , mapInputs          ( )
         , mapOrphans         ( )
         , mapClaimed         ( )
-        , mapInputs          ( )
         , setOrphansByIndex  ( )
+        , nSequence          (0)
         {
         }
 
@@ -74,7 +79,7 @@ namespace TAO
                 return false;
 
             /* Add to the map. */
-            mapLedger[hashTx] = tx;
+            add_ledger(hashTx, tx);
 
             return true;
         }
@@ -83,6 +88,10 @@ namespace TAO
         /* Accepts a transaction with validation rules. */
         bool Mempool::Accept(const TAO::Ledger::Transaction& tx, LLP::TritiumNode* pnode)
         {
+            static metrics::Histogram& metricAccept = metrics::GetHistogram("nexus_mempool_accept_seconds",
+                "Mempool transaction accept latency.", "type=\"tritium\"");
+            metrics::Timer timer(metricAccept);
+
             RLOCK(MUTEX);
 
             /* Get the transaction hash. */
@@ -144,6 +153,8 @@ namespace TAO
                 {
                     /* Add to conflicts map. */
                     debug::error(FUNCTION, "CONFLICT: prev tx ", (mapClaimed.count(tx.hashPrevTx) ? "CLAIMED " : "CONFLICTED "), tx.hashPrevTx.SubString());
+
+                    LOCK2(INDEX_MUTEX);
                     mapConflicts[hashTx] = tx;
 
                     return false;
@@ -159,6 +170,8 @@ namespace TAO
                 {
                     /* Add to conflicts map. */
                     debug::error(FUNCTION, "CONFLICT: hash last mismatch ", tx.hashPrevTx.SubString());
+
+                    LOCK2(INDEX_MUTEX);
                     mapConflicts[hashTx] = tx;
 
                     return false;
@@ -183,7 +196,7 @@ namespace TAO
             LLD::TxnCommit(FLAGS::MEMPOOL);
 
             /* Set the internal memory. */
-            mapLedger[hashTx] = tx;
+            add_ledger(hashTx, tx);
 
             /* Update map claimed if not first tx. */
             if(!tx.IsFirst())
@@ -224,8 +237,8 @@ namespace TAO
             uint512_t hashTx = hash;
             while(mapOrphans.count(hashTx))
             {
-                /* Get the transaction from map. */
-                TAO::Ledger::Transaction& tx = mapOrphans[hashTx];
+                /* Copy the transaction from the map, as accepting it can add to the map and move its entries. */
+                const TAO::Ledger::Transaction tx = mapOrphans.at(hashTx);
 
                 /* Get the previous hash. */
                 const uint512_t hashThis = tx.GetHash();
@@ -254,7 +267,7 @@ namespace TAO
         /* Gets a transaction from mempool */
         bool Mempool::Get(const uint512_t& hashTx, TAO::Ledger::Transaction &tx, bool &fConflicted) const
         {
-            RLOCK(MUTEX);
+            LOCK(INDEX_MUTEX);
 
             /* Check in conflict memory. */
             if(mapConflicts.count(hashTx))
@@ -269,9 +282,10 @@ namespace TAO
             }
 
             /* Check in ledger memory. */
-            if(mapLedger.count(hashTx))
+            const auto it = mapLedger.find(hashTx);
+            if(it != mapLedger.end())
             {
-                tx = mapLedger.at(hashTx);
+                tx = it->second;
 
                 return true;
             }
@@ -283,12 +297,13 @@ namespace TAO
         /* Gets a transaction from mempool */
         bool Mempool::Get(const uint512_t& hashTx, TAO::Ledger::Transaction &tx) const
         {
-            RLOCK(MUTEX);
+            LOCK(INDEX_MUTEX);
 
             /* Check in ledger memory. */
-            if(mapLedger.count(hashTx))
+            const auto it = mapLedger.find(hashTx);
+            if(it != mapLedger.end())
             {
-                tx = mapLedger.at(hashTx);
+                tx = it->second;
 
                 return true;
             }
@@ -300,22 +315,16 @@ namespace TAO
         /* Get by genesis. */
         bool Mempool::Get(const uint256_t& hashGenesis, std::vector<TAO::Ledger::Transaction> &vtx) const
         {
-            RLOCK(MUTEX);
+            LOCK(INDEX_MUTEX);
 
-            /* Check through the ledger map for the genesis. */
-            for(const auto& tx : mapLedger)
-            {
-                /* Check for non-conflicted genesis-id's. */
-                if(tx.second.hashGenesis == hashGenesis)
-                    vtx.push_back(tx.second);
-            }
-
-            /* Check that a transaction was found. */
-            if(vtx.size() == 0)
+            /* Check the genesis index, it is already in sequence order. */
+            const auto it = mapGenesis.find(hashGenesis);
+            if(it == mapGenesis.end())
                 return false;
 
-            /* Sort the list by sequence numbers. */
-            std::sort(vtx.begin(), vtx.end());
+            /* Get the transactions for the genesis. */
+            for(const auto& entry : it->second)
+                vtx.push_back(mapLedger.at(entry.second));
 
             /* Check that the mempool transactions are in correct order. */
             uint512_t hashLast = vtx[0].GetHash();
@@ -358,7 +367,7 @@ namespace TAO
         /* Checks if a transaction exists. */
         bool Mempool::Has(const uint512_t& hashTx) const
         {
-            RLOCK(MUTEX);
+            LOCK(INDEX_MUTEX);
 
             return mapLedger.count(hashTx) || mapLegacy.count(hashTx) || mapConflicts.count(hashTx);
         }
@@ -367,14 +376,9 @@ namespace TAO
         /* Checks if a genesis exists. */
         bool Mempool::Has(const uint256_t& hashGenesis) const
         {
-            RLOCK(MUTEX);
-
-            /* Check through the ledger map for the genesis. */
-            for(const auto& tx : mapLedger)
-                if(tx.second.hashGenesis == hashGenesis)
-                    return true;
+            LOCK(INDEX_MUTEX);
 
-            return false;
+            return mapGenesis.count(hashGenesis);
         }
 
 
@@ -383,43 +387,41 @@ namespace TAO
         {
             RLOCK(MUTEX);
 
+            /* Erase from orphans memory. */
+            setOrphansByIndex.erase(hashTx);
+
             /* Erase from conflicted memory. */
-            if(mapConflicts.count(hashTx))
-                mapConflicts.erase(hashTx);
+            {
+                LOCK2(INDEX_MUTEX);
 
-            /* Erase from legacy conflicted memory. */
-            if(mapLegacyConflicts.count(hashTx))
+                mapConflicts.erase(hashTx);
                 mapLegacyConflicts.erase(hashTx);
-
-            /* Erase from orphans memory. */
-            if(setOrphansByIndex.count(hashTx))
-                setOrphansByIndex.erase(hashTx);
+            }
 
             /* Find the transaction in pool. */
-            if(mapLedger.count(hashTx))
+            const auto itLedger = mapLedger.find(hashTx);
+            if(itLedger != mapLedger.end())
             {
-                /* Get a reference from the map. */
-                const TAO::Ledger::Transaction& tx = mapLedger[hashTx];
+                /* Erase from the claimed and orphan memory. */
+                mapClaimed.erase(itLedger->second.hashPrevTx);
+                mapOrphans.erase(itLedger->second.hashPrevTx);
 
                 /* Erase from the memory map. */
-                mapClaimed.erase(tx.hashPrevTx);
-                mapOrphans.erase(tx.hashPrevTx);
-                mapLedger.erase(hashTx);
-
-                return true;
+                return remove_ledger(hashTx);
             }
 
+            LOCK2(INDEX_MUTEX);
+
             /* Find the legacy transaction in pool. */
-            if(mapLegacy.count(hashTx))
+            const auto itLegacy = mapLegacy.find(hashTx);
+            if(itLegacy != mapLegacy.end())
             {
-                const Legacy::Transaction& tx = mapLegacy[hashTx];
-
                 /* Erase the claimed inputs */
-                uint32_t nSize = static_cast<uint32_t>(tx.vin.size());
-                for(uint32_t i = 0; i < nSize; ++i)
-                    mapInputs.erase(tx.vin[i].prevout);
+                for(const auto& vin : itLegacy->second.vin)
+                    mapInputs.erase(vin.prevout);
 
-                mapLegacy.erase(hashTx);
+                mapLegacy.erase(itLegacy);
+                ++nSequence;
             }
 
             return false;
@@ -433,21 +435,12 @@ namespace TAO
 
             //TODO: evict conflicted transctions from mempool
 
-            /* Create map of transactions by genesis. */
+            /* Copy the transactions by genesis, the genesis index keeps them in sequence order. */
             std::map<uint256_t, std::vector<TAO::Ledger::Transaction> > mapTransactions;
-
-            /* Loop through all the transactions. */
-            for(const auto& tx : mapLedger)
+            for(const auto& list : mapGenesis)
             {
-                /* Cache the genesis. */
-                const uint256_t& hashGenesis = tx.second.hashGenesis;
-
-                /* Check in map for push back. */
-                if(!mapTransactions.count(hashGenesis))
-                    mapTransactions[hashGenesis] = std::vector<TAO::Ledger::Transaction>();
-
-                /* Push to back of map. */
-                mapTransactions[hashGenesis].push_back(tx.second);
+                for(const auto& entry : list.second)
+                    mapTransactions[list.first].push_back(mapLedger.at(entry.second));
             }
 
             /* Loop transctions map by genesis. */
@@ -456,9 +449,6 @@ namespace TAO
                 /* Get reference of the vector. */
                 std::vector<TAO::Ledger::Transaction>& vtx = list.second;
 
-                /* Sort the list by sequence numbers. */
-                std::sort(vtx.begin(), vtx.end());
-
                 /* Add the hashes into list. */
                 uint512_t hashLast = 0;
 
@@ -498,7 +488,7 @@ namespace TAO
 
                                 /* Erase from the memory map. */
                                 mapClaimed.erase(tx->hashPrevTx);
-                                mapLedger.erase(tx->GetHash());
+                                remove_ledger(tx->GetHash());
                             }
                         }
 
@@ -571,91 +561,150 @@ namespace TAO
         /* List transactions in memory pool. */
         bool Mempool::List(std::vector<uint512_t> &vHashes, uint32_t nCount, bool fLegacy)
         {
-            RLOCK(MUTEX);
-
-            //TODO: need to check dependant transactions and sequence them properly otherwise this will fail
+            /* Check for an empty request. */
+            if(nCount == 0)
+                return vHashes.size() > 0;
 
             /* If legacy flag set, skip over getting tritium transactions. */
             if(!fLegacy)
             {
-                /* Create map of transactions by genesis. */
-                std::map<uint256_t, std::vector<TAO::Ledger::Transaction> > mapTransactions;
-
-                /* Loop through all the transactions. */
-                for(const auto& tx : mapLedger)
+                /* Copy the transactions by genesis, so that disk reads and fees are done without holding the lock. */
+                std::vector<std::vector<TAO::Ledger::Transaction> > vQueues;
                 {
-                    /* Check that this transaction isn't conflicted. */
-                    //if(mapConflicts.count(tx.first))
-                    //    continue;
-
-                    /* Cache the genesis. */
-                    const uint256_t& hashGenesis = tx.second.hashGenesis;
+                    LOCK(INDEX_MUTEX);
 
-                    /* Check in map for push back. */
-                    if(!mapTransactions.count(hashGenesis))
-                        mapTransactions[hashGenesis] = std::vector<TAO::Ledger::Transaction>();
+                    vQueues.reserve(mapGenesis.size());
+                    for(const auto& list : mapGenesis)
+                    {
+                        vQueues.push_back(std::vector<TAO::Ledger::Transaction>());
+                        vQueues.back().reserve(list.second.size());
 
-                    /* Push to back of map. */
-                    mapTransactions[hashGenesis].push_back(tx.second);
+                        for(const auto& entry : list.second)
+                            vQueues.back().push_back(mapLedger.at(entry.second));
+                    }
                 }
 
-                /* Loop transctions map by genesis. */
-                for(auto& list : mapTransactions)
-                {
-                    /* Get reference of the vector. */
-                    std::vector<TAO::Ledger::Transaction>& vtx = list.second;
-
-                    /* Sort the list by sequence numbers. */
-                    std::sort(vtx.begin(), vtx.end());
-
-                    /* Add the hashes into list. */
-                    uint512_t hashLast = 0;
+                /* Queues that connect, with their fees and the timestamp of their oldest transaction. */
+                std::vector<std::pair<std::pair<uint64_t, uint64_t>, std::vector<uint512_t> > > vReady;
 
+                /* Debits and transfers that credits and claims in the queues spend, by the spending transaction. */
+                std::map<uint512_t, std::vector<uint512_t> > mapDepends;
+                for(const auto& vtx : vQueues)
+                {
                     /* Check last hash for valid transactions. */
                     if(!vtx[0].IsFirst())
                     {
                         /* Read last index from disk. */
-                        if(!LLD::Ledger->ReadLast(list.first, hashLast))
-                            break; //NOTE: this may need an error
+                        uint512_t hashLast = 0;
+                        if(!LLD::Ledger->ReadLast(vtx[0].hashGenesis, hashLast))
+                            continue;
 
                         /* Check the last hash. */
                         if(vtx[0].hashPrevTx != hashLast)
-                            break;
+                            continue;
+                    }
+
+                    /* Add transactions while they are in sequence. */
+                    std::vector<uint512_t> vQueue(1, vtx[0].GetHash());
+                    uint64_t nFees = vtx[0].Fees();
+                    for(uint32_t n = 1; n < vtx.size(); ++n)
+                    {
+                        /* Check that transaction is in sequence. */
+                        if(vtx[n].hashPrevTx != vQueue.back())
+                            break; //SKIP ANY ORPHANS FOUND
+
+                        vQueue.push_back(vtx[n].GetHash());
+                        nFees += vtx[n].Fees();
                     }
 
-                    /* Set last from next transaction. */
-                    hashLast = vtx[0].GetHash();
+                    /* Get the transactions each queued transaction spends from. */
+                    for(uint32_t n = 0; n < vQueue.size(); ++n)
+                    {
+                        for(uint32_t nContract = 0; nContract < vtx[n].Size(); ++nContract)
+                        {
+                            uint512_t hashPrev = 0;
+                            uint32_t nPrev = 0;
+                            if(vtx[n][nContract].Dependant(hashPrev, nPrev))
+                                mapDepends[vQueue[n]].push_back(hashPrev);
+                        }
+                    }
 
-                    /* Loop through transaction by genesis. */
-                    for(uint32_t n = 1; n <= vtx.size(); ++n)
+                    vReady.push_back(std::make_pair(std::make_pair(nFees, vtx[0].nTimestamp), vQueue));
+                }
+
+                /* Highest fees first, then the oldest. */
+                std::stable_sort(vReady.begin(), vReady.end(),
+                    [](const std::pair<std::pair<uint64_t, uint64_t>, std::vector<uint512_t> >& a,
+                       const std::pair<std::pair<uint64_t, uint64_t>, std::vector<uint512_t> >& b)
                     {
-                        /* Add to the output queue. */
-                        vHashes.push_back(hashLast);
+                        if(a.first.first != b.first.first)
+                            return a.first.first > b.first.first;
 
-                        /* Check for end of index. */
-                        if(n == vtx.size())
-                            break;
+                        return a.first.second < b.first.second;
+                    });
 
-                        /* Check count. */
-                        if(--nCount == 0)
-                            return true;
+                /* Transactions in the queues that haven't been added to the output yet. */
+                std::set<uint512_t> setQueued;
+                for(const auto& queue : vReady)
+                    setQueued.insert(queue.second.begin(), queue.second.end());
 
-                        /* Check that transaction is in sequence. */
-                        if(vtx[n].hashPrevTx != hashLast)
-                            break; //SKIP ANY ORPHANS FOUND
+                /* Add to the output queue by priority, holding a queue back at a transaction that spends from one not added yet. */
+                std::vector<uint32_t> vNext(vReady.size(), 0);
+                bool fBlocked = false;
+                while(!setQueued.empty())
+                {
+                    bool fProgress = false;
+                    for(uint32_t nQueue = 0; nQueue < vReady.size(); ++nQueue)
+                    {
+                        const std::vector<uint512_t>& vQueue = vReady[nQueue].second;
+                        for( ; vNext[nQueue] < vQueue.size(); ++vNext[nQueue])
+                        {
+                            const uint512_t& hash = vQueue[vNext[nQueue]];
+
+                            /* Check for dependencies still queued, unless none of the queues can move on. */
+                            bool fWait = false;
+                            if(!fBlocked && mapDepends.count(hash))
+                            {
+                                for(const auto& hashPrev : mapDepends.at(hash))
+                                    fWait = fWait || setQueued.count(hashPrev);
+                            }
+
+                            if(fWait)
+                                break;
+
+                            vHashes.push_back(hash);
+                            setQueued.erase(hash);
+                            fProgress = true;
 
-                        /* Set last hash. */
-                        hashLast = vtx[n].GetHash();
+                            /* Check count. */
+                            if(--nCount == 0)
+                                return true;
+                        }
                     }
+
+                    /* Dependencies that can't be met fail when they are checked, so add the rest in priority order. */
+                    fBlocked = !fProgress;
                 }
             }
             else
             {
-                /* Loop transctions map by genesis. */
-                for(const auto& list : mapLegacy)
+                /* Get the legacy transactions with their timestamps. */
+                std::vector<std::pair<uint32_t, uint512_t> > vLegacy;
                 {
-                    /* Push legacy transactions last. */
-                    vHashes.push_back(list.first);;
+                    LOCK(INDEX_MUTEX);
+
+                    vLegacy.reserve(mapLegacy.size());
+                    for(const auto& tx : mapLegacy)
+                        vLegacy.push_back(std::make_pair(tx.second.nTime, tx.first));
+                }
+
+                /* Oldest transactions first. */
+                std::sort(vLegacy.begin(), vLegacy.end());
+
+                /* Push legacy transactions last. */
+                for(const auto& tx : vLegacy)
+                {
+                    vHashes.push_back(tx.second);
 
                     /* Check for end of line. */
                     if(--nCount == 0)
@@ -670,9 +719,54 @@ namespace TAO
         /* Gets the size of the memory pool. */
         uint32_t Mempool::Size()
         {
-            RLOCK(MUTEX);
+            LOCK(INDEX_MUTEX);
 
             return static_cast<uint32_t>(mapLedger.size() + mapLegacy.size());
         }
+
+
+        /* Gets the sequence counter of the memory pool. */
+        uint64_t Mempool::Sequence() const
+        {
+            return nSequence.load();
+        }
+
+
+        /* Add a transaction to the ledger memory and its indexes. */
+        void Mempool::add_ledger(const uint512_t& hashTx, const TAO::Ledger::Transaction& tx)
+        {
+            LOCK(INDEX_MUTEX);
+
+            mapLedger[hashTx] = tx;
+            mapGenesis[tx.hashGenesis].insert(std::make_pair(tx.nSequence, hashTx));
+
+            ++nSequence;
+        }
+
+
+        /* Remove a transaction from the ledger memory and its indexes. */
+        bool Mempool::remove_ledger(const uint512_t& hashTx)
+        {
+            LOCK(INDEX_MUTEX);
+
+            /* Find the transaction. */
+            const auto it = mapLedger.find(hashTx);
+            if(it == mapLedger.end())
+                return false;
+
+            /* Remove from the genesis index. */
+            const auto itGenesis = mapGenesis.find(it->second.hashGenesis);
+            if(itGenesis != mapGenesis.end())
+            {
+                itGenesis->second.erase(std::make_pair(it->second.nSequence, hashTx));
+                if(itGenesis->second.empty())
+                    mapGenesis.erase(itGenesis);
+            }
+
+            mapLedger.erase(it);
+            ++nSequence;
+
+            return true;
+        }
     }
 }
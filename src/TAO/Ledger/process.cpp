@@ -18,6 +18,8 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/process.h>
 #include <TAO/Ledger/include/chainstate.h>
 
+#include <Util/include/trace.h>
+
 /* Global TAO namespace. */
 namespace TAO
 {
@@ -26,7 +28,7 @@ namespace TAO
     namespace Ledger
     {
         /* Static instantiation of orphan blocks in queue to process. */
-        std::map<uint1024_t, std::unique_ptr<TAO::Ledger::Block>> mapOrphans;
+        FlatMap<uint1024_t, std::unique_ptr<TAO::Ledger::Block>> mapOrphans;
 
 
         /* Mutex to protect checking more than one block at a time. */
@@ -48,6 +50,8 @@ namespace TAO
         /* Processes a block incoming over the network. */
         void Process(const TAO::Ledger::Block& block, uint8_t &nStatus)
         {
+            trace::Span span("Process");
+
             LOCK(PROCESSING_MUTEX);
 
             /* Get the block's hash. */
@@ -200,8 +204,8 @@ namespace TAO
                 uint1024_t hash = block.GetHash();
                 while(mapOrphans.count(hash))
                 {
-                    /* Grab local copy of the pointer. */
-                    const std::unique_ptr<TAO::Ledger::Block>& pOrphan = mapOrphans.at(hash);
+                    /* Grab local copy of the pointer, as the map's entries can move while the orphan is accepted. */
+                    TAO::Ledger::Block* pOrphan = mapOrphans.at(hash).get();
 
                     /* Get the next hash backwards in the series. */
                     const uint1024_t hashPrev = pOrphan->GetHash();
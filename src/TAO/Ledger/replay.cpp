@@ -0,0 +1,194 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#include <LLD/include/global.h>
+
+#include <Legacy/types/legacy.h>
+
+#include <TAO/Ledger/include/chainstate.h>
+#include <TAO/Ledger/include/replay.h>
+#include <TAO/Ledger/types/state.h>
+#include <TAO/Ledger/types/syncblock.h>
+#include <TAO/Ledger/types/tritium.h>
+
+#include <Util/include/args.h>
+#include <Util/include/debug.h>
+#include <Util/include/filesystem.h>
+#include <Util/include/metrics.h>
+#include <Util/include/runtime.h>
+
+#include <memory>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        /* The time spent in each stage of replaying blocks, in microseconds. */
+        struct ReplayStats
+        {
+            uint64_t nBlocks  = 0;
+            uint64_t nTx      = 0;
+            uint64_t nRead    = 0;
+            uint64_t nCheck   = 0;
+            uint64_t nAccept  = 0;
+            uint64_t nConnect = 0;
+        };
+
+
+        /* Get the total time a histogram has observed in microseconds. */
+        static uint64_t observed(const metrics::Histogram& histogram)
+        {
+            std::array<uint64_t, metrics::BUCKET_COUNT> vCounts;
+            uint64_t nSum = 0;
+            histogram.Buckets(vCounts, nSum);
+
+            return nSum;
+        }
+
+
+        /* Log the time spent in each stage. */
+        static void report(const ReplayStats& stats, const uint64_t nElapsed, const uint32_t nHeight)
+        {
+            const double dBlocks = std::max(uint64_t(1), stats.nBlocks);
+            const double dTotal  = std::max(uint64_t(1), nElapsed);
+
+            debug::log(0, FUNCTION, "height=", nHeight, " blocks=", stats.nBlocks, " tx=", stats.nTx,
+                " [", stats.nBlocks * 1000000.0 / dTotal, " blocks/s, ", stats.nTx * 1000000.0 / dTotal, " tx/s]");
+
+            debug::log(0, FUNCTION, "    read    ", stats.nRead    / dBlocks, " us/block (", stats.nRead    * 100.0 / dTotal, "%)");
+            debug::log(0, FUNCTION, "    check   ", stats.nCheck   / dBlocks, " us/block (", stats.nCheck   * 100.0 / dTotal, "%)");
+            debug::log(0, FUNCTION, "    accept  ", stats.nAccept  / dBlocks, " us/block (", stats.nAccept  * 100.0 / dTotal, "%)");
+            debug::log(0, FUNCTION, "    connect ", stats.nConnect / dBlocks, " us/block (", stats.nConnect * 100.0 / dTotal, "%, part of accept)");
+        }
+
+
+        /* Replays the best chain stored in another data directory into this node's databases. */
+        bool Replay(const std::string& strSource, const uint32_t nHeight)
+        {
+            /* The source must be another node's databases. */
+            const std::string strPath = filesystem::system_complete(strSource);
+            if(strPath == config::GetDataDir())
+                return debug::error(FUNCTION, "replay source must be a different data directory to ", strPath);
+
+            if(!filesystem::exists(strPath + "_LEDGER") || !filesystem::exists(strPath + "_LEGACY"))
+                return debug::error(FUNCTION, "no ledger databases in ", strPath);
+
+            /* Open the source read only, with the same buckets it was written with. */
+            const uint32_t nCacheSize = config::GetArg("-ledgercache", 2) * 1024 * 1024;
+            std::unique_ptr<LLD::LedgerDB> pLedger(new LLD::LedgerDB(0, 256 * 256 * 64, nCacheSize, strPath + "_LEDGER"));
+            std::unique_ptr<LLD::LegacyDB> pLegacy(new LLD::LegacyDB(0, 256 * 256 * 64, nCacheSize, strPath + "_LEGACY"));
+
+            /* Start after our best block, which must be on the source chain. */
+            BlockState state;
+            if(!pLedger->ReadBlock(ChainState::hashBestChain.load(), state))
+                return debug::error(FUNCTION, "best block ", ChainState::hashBestChain.load().SubString(), " is not in ", strPath);
+
+            debug::log(0, FUNCTION, "replaying from ", strPath, " at height ", state.nHeight);
+
+            /* Connect is timed inside accept, so read it from its histogram. */
+            const metrics::Histogram& metricConnect = metrics::GetHistogram("nexus_block_connect_seconds",
+                "Block connect latency.");
+
+            ReplayStats stats;
+            ReplayStats statsWindow;
+
+            runtime::timer timerTotal;
+            timerTotal.Start();
+
+            runtime::timer timerWindow;
+            timerWindow.Start();
+
+            while(!config::fShutdown.load() && state.hashNextBlock != 0 && (nHeight == 0 || state.nHeight < nHeight))
+            {
+                ReplayStats statsBlock;
+                statsBlock.nBlocks = 1;
+
+                try
+                {
+                    runtime::timer timer;
+                    timer.Start();
+
+                    /* Read the next block and its transactions from the source. */
+                    BlockState stateNext;
+                    if(!pLedger->ReadBlock(state.hashNextBlock, stateNext))
+                        return debug::error(FUNCTION, "failed to read block ", state.hashNextBlock.SubString());
+
+                    const SyncBlock block(stateNext, pLedger.get(), pLegacy.get());
+
+                    std::unique_ptr<Block> pBlock;
+                    if(block.nVersion >= 7)
+                        pBlock.reset(new TritiumBlock(block));
+                    else
+                        pBlock.reset(new Legacy::LegacyBlock(block));
+
+                    statsBlock.nTx   = stateNext.vtx.size();
+                    statsBlock.nRead = timer.ElapsedMicroseconds();
+
+                    /* Check the block. */
+                    timer.Reset();
+                    if(!pBlock->Check())
+                        return debug::error(FUNCTION, "check failed at height ", stateNext.nHeight);
+
+                    statsBlock.nCheck = timer.ElapsedMicroseconds();
+
+                    /* Accept the block, which indexes and connects it. */
+                    const uint64_t nConnected = observed(metricConnect);
+
+                    timer.Reset();
+                    if(!pBlock->Accept())
+                        return debug::error(FUNCTION, "accept failed at height ", stateNext.nHeight);
+
+                    statsBlock.nAccept  = timer.ElapsedMicroseconds();
+                    statsBlock.nConnect = observed(metricConnect) - nConnected;
+
+                    state = stateNext;
+                }
+                catch(const std::exception& e)
+                {
+                    return debug::error(FUNCTION, "replay failed after height ", state.nHeight, ": ", e.what());
+                }
+
+                /* Add to the totals. */
+                for(ReplayStats* pStats : { &stats, &statsWindow })
+                {
+                    pStats->nBlocks  += statsBlock.nBlocks;
+                    pStats->nTx      += statsBlock.nTx;
+                    pStats->nRead    += statsBlock.nRead;
+                    pStats->nCheck   += statsBlock.nCheck;
+                    pStats->nAccept  += statsBlock.nAccept;
+                    pStats->nConnect += statsBlock.nConnect;
+                }
+
+                /* Report the last window of blocks. */
+                if(statsWindow.nBlocks == static_cast<uint64_t>(config::GetArg("-replaylog", 1000)))
+                {
+                    report(statsWindow, timerWindow.ElapsedMicroseconds(), state.nHeight);
+
+                    statsWindow = ReplayStats();
+                    timerWindow.Reset();
+                }
+            }
+
+            /* Report the totals. */
+            debug::log(0, FUNCTION, "replay ", config::fShutdown.load() ? "interrupted" : "completed");
+            report(stats, timerTotal.ElapsedMicroseconds(), state.nHeight);
+
+            return true;
+        }
+    }
+}
@@ -0,0 +1,291 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLD/include/global.h>
+
+#include <TAO/Operation/include/enum.h>
+#include <TAO/Operation/types/contract.h>
+
+#include <TAO/Register/include/constants.h>
+#include <TAO/Register/include/enum.h>
+#include <TAO/Register/include/unpack.h>
+#include <TAO/Register/types/object.h>
+
+#include <TAO/Ledger/include/scheduler.h>
+#include <TAO/Ledger/types/transaction.h>
+
+#include <algorithm>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        /* Add the owner of a register to a connect set. */
+        static bool add_owner(const uint256_t& hashAddress, std::vector<uint256_t> &vAddresses)
+        {
+            /* The register must already exist, as its owner can't be known otherwise. */
+            TAO::Register::State state;
+            if(!LLD::Register->ReadState(hashAddress, state))
+                return false;
+
+            vAddresses.push_back(state.hashOwner);
+
+            return true;
+        }
+
+
+        /* Add the registers used by a contract to a connect set. */
+        static bool add_contract(const TAO::Operation::Contract& contract,
+                                 std::vector<uint256_t> &vAddresses, std::vector<uint512_t> &vTransactions)
+        {
+            /* Dependant transactions are keyed by their proofs and claims. */
+            uint512_t hashPrev = 0;
+            uint32_t nPrev = 0;
+            if(contract.Dependant(hashPrev, nPrev))
+                vTransactions.push_back(hashPrev);
+
+            /* Get the primitive, conditions on the contract aren't run until they are claimed. */
+            contract.Reset();
+
+            uint8_t nOP = 0;
+            contract >> nOP;
+
+            if(nOP == TAO::Operation::OP::CONDITION)
+                contract >> nOP;
+
+            switch(nOP)
+            {
+                /* Operations on a single register. */
+                case TAO::Operation::OP::WRITE:
+                case TAO::Operation::OP::APPEND:
+                case TAO::Operation::OP::FEE:
+                {
+                    uint256_t hashAddress = 0;
+                    contract >> hashAddress;
+
+                    vAddresses.push_back(hashAddress);
+
+                    return true;
+                }
+
+
+                /* Creating an account reads its token. */
+                case TAO::Operation::OP::CREATE:
+                {
+                    TAO::Register::State state;
+                    uint256_t hashAddress = 0;
+                    if(!TAO::Register::Unpack(contract, state, hashAddress))
+                        return false;
+
+                    vAddresses.push_back(hashAddress);
+                    if(state.nType == TAO::Register::REGISTER::OBJECT)
+                    {
+                        TAO::Register::Object object = TAO::Register::Object(state);
+                        if(!object.Parse())
+                            return false;
+
+                        if(object.Standard() == TAO::Register::OBJECTS::ACCOUNT)
+                            vAddresses.push_back(object.get<uint256_t>("token"));
+                    }
+
+                    return true;
+                }
+
+
+                /* Debits write an event for the owner of the recipient. */
+                case TAO::Operation::OP::DEBIT:
+                {
+                    uint256_t hashFrom = 0;
+                    contract >> hashFrom;
+
+                    uint256_t hashTo = 0;
+                    contract >> hashTo;
+
+                    vAddresses.push_back(hashFrom);
+                    if(hashTo != TAO::Register::WILDCARD_ADDRESS)
+                    {
+                        vAddresses.push_back(hashTo);
+                        if(!add_owner(hashTo, vAddresses))
+                            return false;
+                    }
+
+                    return true;
+                }
+
+
+                /* Credits read the debit's registers and the token of partial payments. */
+                case TAO::Operation::OP::CREDIT:
+                {
+                    uint512_t hashTx = 0;
+                    contract >> hashTx;
+
+                    uint32_t nContract = 0;
+                    contract >> nContract;
+
+                    uint256_t hashAddress = 0;
+                    contract >> hashAddress;
+
+                    uint256_t hashProof = 0;
+                    contract >> hashProof;
+
+                    vAddresses.push_back(hashAddress);
+                    vAddresses.push_back(hashProof);
+
+                    /* Conditions on the debit can read any register. */
+                    const TAO::Operation::Contract debit = LLD::Ledger->ReadContract(hashTx, nContract);
+                    if(!debit.Empty(TAO::Operation::Contract::CONDITIONS))
+                        return false;
+
+                    debit.Reset();
+
+                    uint8_t nDebit = 0;
+                    debit >> nDebit;
+
+                    /* Coinbase credits only touch the credited account. */
+                    if(nDebit == TAO::Operation::OP::COINBASE)
+                        return true;
+
+                    if(nDebit != TAO::Operation::OP::DEBIT)
+                        return false;
+
+                    uint256_t hashFrom = 0;
+                    debit >> hashFrom;
+
+                    uint256_t hashTo = 0;
+                    debit >> hashTo;
+
+                    vAddresses.push_back(hashFrom);
+                    if(hashTo != TAO::Register::WILDCARD_ADDRESS)
+                    {
+                        vAddresses.push_back(hashTo);
+                        if(!add_owner(hashTo, vAddresses))
+                            return false;
+                    }
+
+                    return true;
+                }
+            }
+
+            /* Everything else connects in block order. */
+            return false;
+        }
+
+
+        /* Get the set of sigchains, registers and transactions a transaction touches. */
+        bool ConnectSet(const Transaction& tx, const uint512_t& hashTx,
+                        std::vector<uint256_t> &vAddresses, std::vector<uint512_t> &vTransactions)
+        {
+            vAddresses.clear();
+            vTransactions.clear();
+
+            /* Sigchain last, genesis and event indexes are keyed by genesis. */
+            vAddresses.push_back(tx.hashGenesis);
+            vTransactions.push_back(hashTx);
+
+            /* Staking and minting transactions update trust and supply. */
+            if(tx.IsCoinBase() || tx.IsCoinStake() || tx.IsPrivate())
+                return false;
+
+            /* Make sure malformed contracts fall back to block order. */
+            try
+            {
+                for(uint32_t nContract = 0; nContract < tx.Size(); ++nContract)
+                {
+                    const TAO::Operation::Contract& contract = tx[nContract];
+                    contract.Bind(&tx, false);
+                    if(!add_contract(contract, vAddresses, vTransactions))
+                        return false;
+                }
+            }
+            catch(const std::exception& e)
+            {
+                return false;
+            }
+
+            return true;
+        }
+
+
+        /* Default Constructor. */
+        ConnectScheduler::ConnectScheduler()
+        : mapAddresses    ( )
+        , mapTransactions ( )
+        , vWaves          ( )
+        {
+        }
+
+
+        /* Add a transaction to the schedule. */
+        uint32_t ConnectScheduler::Schedule(const uint32_t nIndex, const std::vector<uint256_t>& vAddresses,
+                                            const std::vector<uint512_t>& vTransactions)
+        {
+            /* Find the first wave after every wave that used our keys. */
+            uint32_t nWave = 0;
+            for(const auto& hash : vAddresses)
+            {
+                auto it = mapAddresses.find(hash);
+                if(it != mapAddresses.end())
+                    nWave = std::max(nWave, it->second + 1);
+            }
+
+            for(const auto& hash : vTransactions)
+            {
+                auto it = mapTransactions.find(hash);
+                if(it != mapTransactions.end())
+                    nWave = std::max(nWave, it->second + 1);
+            }
+
+            /* Claim the keys for this wave. */
+            for(const auto& hash : vAddresses)
+                mapAddresses[hash] = nWave;
+
+            for(const auto& hash : vTransactions)
+                mapTransactions[hash] = nWave;
+
+            /* Add to the wave. */
+            if(nWave >= vWaves.size())
+                vWaves.resize(nWave + 1);
+
+            vWaves[nWave].push_back(nIndex);
+
+            return nWave;
+        }
+
+
+        /* Get the scheduled waves. */
+        const std::vector<std::vector<uint32_t>>& ConnectScheduler::Waves() const
+        {
+            return vWaves;
+        }
+
+
+        /* Check if nothing is scheduled. */
+        bool ConnectScheduler::Empty() const
+        {
+            return vWaves.empty();
+        }
+
+
+        /* Clear the schedule. */
+        void ConnectScheduler::Clear()
+        {
+            mapAddresses.clear();
+            mapTransactions.clear();
+            vWaves.clear();
+        }
+    }
+}
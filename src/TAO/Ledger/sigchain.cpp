@@ -30,6 +30,9 @@ ________________________________________________________________________________
 #include <TAO/Register/types/object.h>
 
 #include <Util/include/debug.h>
+#include <Util/include/parallel.h>
+
+#include <exception>
 
 /* Global TAO namespace. */
 namespace TAO
@@ -41,22 +44,24 @@ namespace TAO
 
         /* Copy Constructor */
         SignatureChain::SignatureChain(const SignatureChain& sigchain)
-        : strUsername (sigchain.strUsername)
-        , strPassword (sigchain.strPassword)
-        , MUTEX       ( )
-        , pairCache   (sigchain.pairCache)
-        , hashGenesis (sigchain.hashGenesis)
+        : strUsername   (sigchain.strUsername)
+        , strPassword   (sigchain.strPassword)
+        , MUTEX         ( )
+        , vKeyCache     (sigchain.vKeyCache)
+        , nCacheCounter (sigchain.nCacheCounter)
+        , hashGenesis   (sigchain.hashGenesis)
         {
         }
 
 
         /** Move Constructor **/
         SignatureChain::SignatureChain(SignatureChain&& sigchain) noexcept
-        : strUsername (std::move(sigchain.strUsername.c_str()))
-        , strPassword (std::move(sigchain.strPassword.c_str()))
-        , MUTEX       ( )
-        , pairCache   (std::move(sigchain.pairCache))
-        , hashGenesis (std::move(sigchain.hashGenesis))
+        : strUsername   (std::move(sigchain.strUsername.c_str()))
+        , strPassword   (std::move(sigchain.strPassword.c_str()))
+        , MUTEX         ( )
+        , vKeyCache     (std::move(sigchain.vKeyCache))
+        , nCacheCounter (std::move(sigchain.nCacheCounter))
+        , hashGenesis   (std::move(sigchain.hashGenesis))
         {
         }
 
@@ -69,11 +74,12 @@ namespace TAO
 
         /* Constructor to generate Keychain */
         SignatureChain::SignatureChain(const SecureString& strUsernameIn, const SecureString& strPasswordIn)
-        : strUsername (strUsernameIn.c_str())
-        , strPassword (strPasswordIn.c_str())
-        , MUTEX       ( )
-        , pairCache   (std::make_pair(std::numeric_limits<uint32_t>::max(), ""))
-        , hashGenesis (SignatureChain::Genesis(strUsernameIn))
+        : strUsername   (strUsernameIn.c_str())
+        , strPassword   (strPasswordIn.c_str())
+        , MUTEX         ( )
+        , vKeyCache     ( )
+        , nCacheCounter (0)
+        , hashGenesis   (SignatureChain::Genesis(strUsernameIn))
         {
         }
 
@@ -155,104 +161,16 @@ namespace TAO
          */
         uint512_t SignatureChain::Generate(const uint32_t nKeyID, const SecureString& strSecret, bool fCache) const
         {
-            {
-                LOCK(MUTEX);
-
-                /* Handle cache to stop exhaustive hash key generation. */
-                if(fCache && nKeyID == pairCache.first)
-                {
-                    /* Create the hash key object. */
-                    uint512_t hashKey;
-
-                    /* Get the bytes from secure allocator. */
-                    std::vector<uint8_t> vBytes(pairCache.second.begin(), pairCache.second.end());
-
-                    /* Set the bytes of return value. */
-                    hashKey.SetBytes(vBytes);
-
-                    return hashKey;
-                }
-            }
-
-            /* Generate the Secret Phrase */
-            std::vector<uint8_t> vUsername(strUsername.begin(), strUsername.end());
-            vUsername.insert(vUsername.end(), (uint8_t*)&nKeyID, (uint8_t*)&nKeyID + sizeof(nKeyID));
-
-            /* Set to minimum salt limits. */
-            if(vUsername.size() < 8)
-                vUsername.resize(8);
-
-            /* Generate the Secret Phrase */
-            std::vector<uint8_t> vPassword(strPassword.begin(), strPassword.end());
-            vPassword.insert(vPassword.end(), (uint8_t*)&nKeyID, (uint8_t*)&nKeyID + sizeof(nKeyID));
-
-            /* Generate the secret data. */
-            std::vector<uint8_t> vSecret(strSecret.begin(), strSecret.end());
-            vSecret.insert(vSecret.end(), (uint8_t*)&nKeyID, (uint8_t*)&nKeyID + sizeof(nKeyID));
-
-            // low-level API
-            std::vector<uint8_t> hash(64);
-
-            /* Create the hash context. */
-            argon2_context context =
-            {
-                /* Hash Return Value. */
-                &hash[0],
-                64,
-
-                /* Password input data. */
-                &vPassword[0],
-                static_cast<uint32_t>(vPassword.size()),
-
-                /* Username and key ID as the salt. */
-                &vUsername[0],
-                static_cast<uint32_t>(vUsername.size()),
-
-                /* The secret phrase as secret data. */
-                &vSecret[0],
-                static_cast<uint32_t>(vSecret.size()),
-
-                /* Optional associated data */
-                NULL, 0,
-
-                /* Computational Cost. */
-                std::max(1u, uint32_t(config::GetArg("-argon2", 12))),
+            /* Handle cache to stop exhaustive hash key generation. */
+            const uint256_t hashIndex = key_index(nKeyID, strSecret, "");
 
-                /* Memory Cost (64 MB). */
-                uint32_t(1 << std::max(4u, uint32_t(config::GetArg("-argon2_memory", 16)))),
-
-                /* The number of threads and lanes */
-                1, 1,
-
-                /* Algorithm Version */
-                ARGON2_VERSION_13,
-
-                /* Custom memory allocation / deallocation functions. */
-                NULL, NULL,
-
-                /* By default only internal memory is cleared (pwd is not wiped) */
-                ARGON2_DEFAULT_FLAGS
-            };
-
-            /* Run the argon2 computation. */
-            int nRet = argon2id_ctx(&context);
-            if(nRet != ARGON2_OK)
-                throw std::runtime_error(debug::safe_printstr(FUNCTION, "Argon2 failed with code ", nRet));
-
-            /* Set the cache items. */
-            {
-                LOCK(MUTEX);
-
-                if(fCache)
-                {
-                    pairCache.first  = nKeyID;
-                    pairCache.second = SecureString(hash.begin(), hash.end());
-                }
-            }
-
-            /* Set the bytes for the key. */
             uint512_t hashKey;
-            hashKey.SetBytes(hash);
+            if(fCache && get_cache(hashIndex, hashKey))
+                return hashKey;
+
+            /* Derive the key and keep it for the next transaction that signs with it. */
+            hashKey = derive(nKeyID, strPassword, strSecret, "");
+            put_cache(hashIndex, hashKey);
 
             return hashKey;
         }
@@ -262,77 +180,7 @@ namespace TAO
         *  This version should be used when changing the password and/or pin */
         uint512_t SignatureChain::Generate(const uint32_t nKeyID, const SecureString& strPassword, const SecureString& strSecret) const
         {
-            /* Generate the Secret Phrase */
-            std::vector<uint8_t> vUsername(strUsername.begin(), strUsername.end());
-            vUsername.insert(vUsername.end(), (uint8_t*)&nKeyID, (uint8_t*)&nKeyID + sizeof(nKeyID));
-
-            /* Set to minimum salt limits. */
-            if(vUsername.size() < 8)
-                vUsername.resize(8);
-
-            /* Generate the Secret Phrase */
-            std::vector<uint8_t> vPassword(strPassword.begin(), strPassword.end());
-            vPassword.insert(vPassword.end(), (uint8_t*)&nKeyID, (uint8_t*)&nKeyID + sizeof(nKeyID));
-
-            /* Generate the secret data. */
-            std::vector<uint8_t> vSecret(strSecret.begin(), strSecret.end());
-            vSecret.insert(vSecret.end(), (uint8_t*)&nKeyID, (uint8_t*)&nKeyID + sizeof(nKeyID));
-
-            // low-level API
-            std::vector<uint8_t> hash(64);
-
-            /* Create the hash context. */
-            argon2_context context =
-            {
-                /* Hash Return Value. */
-                &hash[0],
-                64,
-
-                /* Password input data. */
-                &vPassword[0],
-                static_cast<uint32_t>(vPassword.size()),
-
-                /* Username and key ID as the salt. */
-                &vUsername[0],
-                static_cast<uint32_t>(vUsername.size()),
-
-                /* The secret phrase as secret data. */
-                &vSecret[0],
-                static_cast<uint32_t>(vSecret.size()),
-
-                /* Optional associated data */
-                NULL, 0,
-
-                /* Computational Cost. */
-                std::max(1u, uint32_t(config::GetArg("-argon2", 12))),
-
-                /* Memory Cost (64 MB). */
-                uint32_t(1 << std::max(4u, uint32_t(config::GetArg("-argon2_memory", 16)))),
-
-                /* The number of threads and lanes */
-                1, 1,
-
-                /* Algorithm Version */
-                ARGON2_VERSION_13,
-
-                /* Custom memory allocation / deallocation functions. */
-                NULL, NULL,
-
-                /* By default only internal memory is cleared (pwd is not wiped) */
-                ARGON2_DEFAULT_FLAGS
-            };
-
-            /* Run the argon2 computation. */
-            int nRet = argon2id_ctx(&context);
-            if(nRet != ARGON2_OK)
-                throw std::runtime_error(debug::safe_printstr(FUNCTION, "Argon2 failed with code ", nRet));
-
-
-            /* Set the bytes for the key. */
-            uint512_t hashKey;
-            hashKey.SetBytes(hash);
-
-            return hashKey;
+            return derive(nKeyID, strPassword, strSecret, "");
         }
 
 
@@ -342,77 +190,16 @@ namespace TAO
          */
         uint512_t SignatureChain::Generate(const std::string& strType, const uint32_t nKeyID, const SecureString& strSecret) const
         {
-            /* Generate the Secret Phrase */
-            std::vector<uint8_t> vUsername(strUsername.begin(), strUsername.end());
-            vUsername.insert(vUsername.end(), (uint8_t*)&nKeyID, (uint8_t*)&nKeyID + sizeof(nKeyID));
-
-            /* Set to minimum salt limits. */
-            if(vUsername.size() < 8)
-                vUsername.resize(8);
-
-            /* Generate the Secret Phrase */
-            std::vector<uint8_t> vPassword(strPassword.begin(), strPassword.end());
-            vPassword.insert(vPassword.end(), (uint8_t*)&nKeyID, (uint8_t*)&nKeyID + sizeof(nKeyID));
-
-            /* Generate the secret data. */
-            std::vector<uint8_t> vSecret(strSecret.begin(), strSecret.end());
-            vSecret.insert(vSecret.end(), (uint8_t*)&nKeyID, (uint8_t*)&nKeyID + sizeof(nKeyID));
-
-            /* Seed secret data with the key type. */
-            vSecret.insert(vSecret.end(), strType.begin(), strType.end());
-
-            // low-level API
-            std::vector<uint8_t> hash(64);
-
-            /* Create the hash context. */
-            argon2_context context =
-            {
-                /* Hash Return Value. */
-                &hash[0],
-                64,
-
-                /* Password input data. */
-                &vPassword[0],
-                static_cast<uint32_t>(vPassword.size()),
-
-                /* Username and key ID as the salt. */
-                &vUsername[0],
-                static_cast<uint32_t>(vUsername.size()),
-
-                /* The secret phrase as secret data. */
-                &vSecret[0],
-                static_cast<uint32_t>(vSecret.size()),
-
-                /* Optional associated data */
-                NULL, 0,
-
-                /* Computational Cost. */
-                std::max(1u, uint32_t(config::GetArg("-argon2", 12))),
-
-                /* Memory Cost (64 MB). */
-                uint32_t(1 << std::max(4u, uint32_t(config::GetArg("-argon2_memory", 16)))),
-
-                /* The number of threads and lanes */
-                1, 1,
-
-                /* Algorithm Version */
-                ARGON2_VERSION_13,
-
-                /* Custom memory allocation / deallocation functions. */
-                NULL, NULL,
+            /* Check the cache first. */
+            const uint256_t hashIndex = key_index(nKeyID, strSecret, strType);
 
-                /* By default only internal memory is cleared (pwd is not wiped) */
-                ARGON2_DEFAULT_FLAGS
-            };
-
-            /* Run the argon2 computation. */
-            int nRet = argon2id_ctx(&context);
-            if(nRet != ARGON2_OK)
-                throw std::runtime_error(debug::safe_printstr(FUNCTION, "Argon2 failed with code ", nRet));
-
-            /* Set the bytes for the key. */
             uint512_t hashKey;
-            hashKey.SetBytes(hash);
+            if(get_cache(hashIndex, hashKey))
+                return hashKey;
+
+            /* Derive the key and cache it. */
+            hashKey = derive(nKeyID, strPassword, strSecret, strType);
+            put_cache(hashIndex, hashKey);
 
             return hashKey;
         }
@@ -540,6 +327,39 @@ namespace TAO
         }
 
 
+        /* Generates the public key hashes of several key types at once. */
+        std::vector<uint256_t> SignatureChain::KeyHashes(const std::vector<std::string>& vTypes, const uint32_t nKeyID,
+                                                         const SecureString& strSecret, const uint8_t nType) const
+        {
+            /* Each key is an independent argon2 derivation, so they can run on their own cores. */
+            std::vector<uint256_t> vHashes(vTypes.size(), 0);
+
+            /* Exceptions can't leave the worker threads, so keep the first one to throw on the calling thread. */
+            std::mutex EXCEPTION_MUTEX;
+            std::exception_ptr pException;
+
+            ParallelFor(static_cast<uint32_t>(vTypes.size()), ParallelThreads(config::GetArg("-argon2_threads", 0)),
+                [&](const uint32_t nIndex)
+                {
+                    try
+                    {
+                        vHashes[nIndex] = KeyHash(vTypes[nIndex], nKeyID, strSecret, nType);
+                    }
+                    catch(...)
+                    {
+                        LOCK(EXCEPTION_MUTEX);
+                        if(!pException)
+                            pException = std::current_exception();
+                    }
+                });
+
+            if(pException)
+                std::rethrow_exception(pException);
+
+            return vHashes;
+        }
+
+
         /* This function generates a hash of a public key generated from a recovery seed phrase. */
         uint256_t SignatureChain::RecoveryHash(const SecureString& strRecovery, const uint8_t nType) const
         {
@@ -615,8 +435,8 @@ namespace TAO
         {
             encrypt(strUsername);
             encrypt(strPassword);
-            encrypt(pairCache.first);
-            encrypt(pairCache.second);
+            encrypt(vKeyCache);
+            encrypt(nCacheCounter);
             encrypt(hashGenesis);
         }
 
@@ -706,5 +526,151 @@ namespace TAO
 
         }
 
+
+        /* Run argon2 over the username, password and secret for a key in the keychain. */
+        uint512_t SignatureChain::derive(const uint32_t nKeyID, const SecureString& strPasswordIn,
+                                         const SecureString& strSecret, const std::string& strType) const
+        {
+            /* Generate the Secret Phrase */
+            std::vector<uint8_t> vUsername(strUsername.begin(), strUsername.end());
+            vUsername.insert(vUsername.end(), (uint8_t*)&nKeyID, (uint8_t*)&nKeyID + sizeof(nKeyID));
+
+            /* Set to minimum salt limits. */
+            if(vUsername.size() < 8)
+                vUsername.resize(8);
+
+            /* Generate the Secret Phrase */
+            std::vector<uint8_t> vPassword(strPasswordIn.begin(), strPasswordIn.end());
+            vPassword.insert(vPassword.end(), (uint8_t*)&nKeyID, (uint8_t*)&nKeyID + sizeof(nKeyID));
+
+            /* Generate the secret data. */
+            std::vector<uint8_t> vSecret(strSecret.begin(), strSecret.end());
+            vSecret.insert(vSecret.end(), (uint8_t*)&nKeyID, (uint8_t*)&nKeyID + sizeof(nKeyID));
+
+            /* Seed secret data with the key type. */
+            vSecret.insert(vSecret.end(), strType.begin(), strType.end());
+
+            // low-level API
+            std::vector<uint8_t> hash(64);
+
+            /* Create the hash context. */
+            argon2_context context =
+            {
+                /* Hash Return Value. */
+                &hash[0],
+                64,
+
+                /* Password input data. */
+                &vPassword[0],
+                static_cast<uint32_t>(vPassword.size()),
+
+                /* Username and key ID as the salt. */
+                &vUsername[0],
+                static_cast<uint32_t>(vUsername.size()),
+
+                /* The secret phrase as secret data. */
+                &vSecret[0],
+                static_cast<uint32_t>(vSecret.size()),
+
+                /* Optional associated data */
+                NULL, 0,
+
+                /* Computational Cost. */
+                std::max(1u, uint32_t(config::GetArg("-argon2", 12))),
+
+                /* Memory Cost (64 MB). */
+                uint32_t(1 << std::max(4u, uint32_t(config::GetArg("-argon2_memory", 16)))),
+
+                /* The number of threads and lanes (the lanes are part of the key, so they can't change). */
+                1, 1,
+
+                /* Algorithm Version */
+                ARGON2_VERSION_13,
+
+                /* Custom memory allocation / deallocation functions. */
+                NULL, NULL,
+
+                /* By default only internal memory is cleared (pwd is not wiped) */
+                ARGON2_DEFAULT_FLAGS
+            };
+
+            /* Run the argon2 computation. */
+            int nRet = argon2id_ctx(&context);
+            if(nRet != ARGON2_OK)
+                throw std::runtime_error(debug::safe_printstr(FUNCTION, "Argon2 failed with code ", nRet));
+
+            /* Set the bytes for the key. */
+            uint512_t hashKey;
+            hashKey.SetBytes(hash);
+
+            return hashKey;
+        }
+
+
+        /* Get the fingerprint of a key's inputs to find it in the cache. */
+        uint256_t SignatureChain::key_index(const uint32_t nKeyID, const SecureString& strSecret, const std::string& strType) const
+        {
+            /* Genesis, key ID and the length prefixed type, so a type and secret can't run into each other. */
+            std::vector<uint8_t> vData(hashGenesis.begin(), hashGenesis.end());
+            vData.insert(vData.end(), (uint8_t*)&nKeyID, (uint8_t*)&nKeyID + sizeof(nKeyID));
+            vData.push_back(static_cast<uint8_t>(strType.size()));
+            vData.insert(vData.end(), strType.begin(), strType.end());
+            vData.insert(vData.end(), strSecret.begin(), strSecret.end());
+
+            /* Make sure the unused marker can't be hit. */
+            uint256_t hashIndex = LLC::SK256(vData);
+            if(hashIndex == 0)
+                hashIndex = 1;
+
+            /* Don't leave the secret around in the heap. */
+            std::fill(vData.begin(), vData.end(), 0);
+
+            return hashIndex;
+        }
+
+
+        /* Get a derived key from the cache. */
+        bool SignatureChain::get_cache(const uint256_t& hashIndex, uint512_t &hashKey) const
+        {
+            LOCK(MUTEX);
+
+            for(auto& entry : vKeyCache)
+            {
+                if(entry.hashIndex != hashIndex)
+                    continue;
+
+                entry.nUsed = ++nCacheCounter;
+                hashKey     = entry.hashKey;
+
+                return true;
+            }
+
+            return false;
+        }
+
+
+        /* Add a derived key to the cache, replacing the least recently used key if full. */
+        void SignatureChain::put_cache(const uint256_t& hashIndex, const uint512_t& hashKey) const
+        {
+            LOCK(MUTEX);
+
+            /* Find the key if another thread derived it too, or the least recently used slot (unused slots are 0). */
+            KeyCache* pEntry = &vKeyCache[0];
+            for(auto& entry : vKeyCache)
+            {
+                if(entry.hashIndex == hashIndex)
+                {
+                    pEntry = &entry;
+                    break;
+                }
+
+                if(entry.nUsed < pEntry->nUsed)
+                    pEntry = &entry;
+            }
+
+            pEntry->hashIndex = hashIndex;
+            pEntry->hashKey   = hashKey;
+            pEntry->nUsed     = ++nCacheCounter;
+        }
     }
 }
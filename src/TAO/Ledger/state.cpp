@@ -22,6 +22,8 @@ ________________________________________________________________________________
 #include <Legacy/types/legacy.h>
 #include <Legacy/wallet/wallet.h>
 
+#include <TAO/API/include/global.h>
+
 #include <TAO/Operation/include/enum.h>
 
 #include <TAO/Register/include/enum.h>
@@ -36,6 +38,7 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/difficulty.h>
 #include <TAO/Ledger/include/enum.h>
 #include <TAO/Ledger/include/prime.h>
+#include <TAO/Ledger/include/scheduler.h>
 #include <TAO/Ledger/include/stake_change.h>
 #include <TAO/Ledger/include/supply.h>
 #include <TAO/Ledger/include/timelocks.h>
@@ -43,7 +46,11 @@ ________________________________________________________________________________
 #include <TAO/Ledger/types/genesis.h>
 #include <TAO/Ledger/types/mempool.h>
 
+#include <Util/include/arena.h>
+#include <Util/include/metrics.h>
+#include <Util/include/parallel.h>
 #include <Util/include/string.h>
+#include <Util/include/trace.h>
 
 
 
@@ -349,6 +356,8 @@ namespace TAO
         /* Accept a block state into chain. */
         bool BlockState::Index()
         {
+            trace::Span span("BlockState::Index");
+
             /* Runtime calculations. */
             runtime::timer timer;
             timer.Start();
@@ -685,6 +694,8 @@ namespace TAO
 
         bool BlockState::SetBest()
         {
+            trace::Span span("BlockState::SetBest");
+
             /* Reset timers for meters. */
             swContract.reset();
             swScript.reset();
@@ -890,6 +901,9 @@ namespace TAO
                 ChainState::nBestChainTrust    = nChainTrust;
                 ChainState::nBestHeight        = nHeight;
 
+                /* Wake anything waiting on the best chain, such as the stake minter. */
+                ChainState::NotifyBest();
+
                 /* Write the best chain pointer. */
                 if(!LLD::Ledger->WriteBestChain(ChainState::hashBestChain.load()))
                     return debug::error(FUNCTION, "failed to write best chain");
@@ -911,6 +925,10 @@ namespace TAO
                         debug::log(0, FUNCTION, "Block Notify Executed with code ", nRet);
                     }
 
+                    /* Wake the events processor, as the block may have notifications for the logged in user. */
+                    if(TAO::API::users)
+                        TAO::API::users->NotifyEvent();
+
                     /* If using Tritium server then we need to include the blocks transactions in the inventory before the block. */
                     if(LLP::TRITIUM_SERVER)
                     {
@@ -941,99 +959,216 @@ namespace TAO
         }
 
 
+        /* Connect a tritium transaction, checking it against its sigchain. */
+        static bool connect_tritium(const Transaction& tx, const uint512_t& hash, const BlockState* pblock)
+        {
+            /* Check for existing indexes. */
+            if(LLD::Ledger->HasIndex(hash))
+                return debug::error(FUNCTION, "transaction overwrites not allowed");
+
+            if(config::nVerbose >= 3)
+                tx.print();
+
+            /* Check the ledger rules for sigchain at end. */
+            if(!tx.IsFirst())
+            {
+                /* Check for the last hash. */
+                uint512_t hashLast = 0;
+                if(!LLD::Ledger->ReadLast(tx.hashGenesis, hashLast))
+                    return debug::error(FUNCTION, "failed to read last on non-genesis");
+
+                /* Check that the last transaction is correct. */
+                if(tx.hashPrevTx != hashLast)
+                    return debug::error(FUNCTION, "last hash hash mismatch");
+            }
+
+            /* Verify the Ledger Pre-States. */
+            if(!tx.Verify(FLAGS::BLOCK)) //NOTE: double checking this for now in post-processing
+                return false;
+
+            /* Connect the transaction. */
+            if(!tx.Connect(FLAGS::BLOCK, pblock))
+                return debug::error(FUNCTION, "failed to connect transaction");
+
+            return true;
+        }
+
+
+        /* Finish connecting a tritium transaction, must be called in block order. */
+        static bool commit_tritium(const Transaction& tx, const uint512_t& hash, BlockState& state)
+        {
+            /* Add legacy transactions to the wallet where appropriate */
+            Legacy::Wallet::GetInstance().AddToWalletIfInvolvingMe(tx, state, true);
+
+            /* Accumulate the fees. */
+            state.nFees += tx.Fees();
+
+            /* If tx is coinstake, also write the last stake. */
+            if(tx.IsCoinStake())
+            {
+                /* Check the trust values. */
+                if(!tx.CheckTrust(&state))
+                    return debug::error(FUNCTION, "trust checks failed");
+
+                /* Write the last stake value into the database. */
+                if(!LLD::Ledger->WriteStake(tx.hashGenesis, hash))
+                    return debug::error(FUNCTION, "failed to write last stake");
+
+                /* If local database has a stake change request for this transaction not marked as processed, update it.
+                 * This updates a request that was reset because coinstake was disconnected and now is reconnected, such
+                 * as if execute a forkblocks and re-sync.
+                 */
+                StakeChange request;
+                if(LLD::Local->ReadStakeChange(tx.hashGenesis, request)
+                && !request.fProcessed && request.hashTx == hash)
+                {
+                    /* Mark as processed. */
+                    request.fProcessed = true;
+
+                    /* Erase if we can't update it. */
+                    if(!LLD::Local->WriteStakeChange(tx.hashGenesis, request))
+                        LLD::Local->EraseStakeChange(tx.hashGenesis);
+                }
+            }
+
+            /* Keep track of total contracts processed. */
+            nTotalContracts += tx.Size();
+
+            return true;
+        }
+
+
+        /* Connect the scheduled tritium transactions wave by wave, then finish them in block order. */
+        static bool connect_pending(BlockState& state, std::vector<std::pair<uint512_t, Transaction>> &vPending,
+                                    ConnectScheduler &scheduler, const uint32_t nThreads)
+        {
+            /* Nothing to do if no transactions are waiting. */
+            if(vPending.empty())
+                return true;
+
+            /* Start the contracts stopwatch. */
+            swContract.start();
+
+            /* Transactions in a wave share no sigchains, registers or dependants. */
+            const uint1024_t hashBlock = state.GetHash();
+            for(const auto& vWave : scheduler.Waves())
+            {
+                std::atomic<bool> fFailed(false);
+                ParallelFor(vWave.size(), nThreads, [&](const uint32_t n)
+                {
+                    /* Skip the rest of the wave once any transaction fails. */
+                    if(fFailed.load())
+                        return;
+
+                    const auto& pending = vPending[vWave[n]];
+                    if(!connect_tritium(pending.second, pending.first, &state))
+                        fFailed.store(true);
+                });
+
+                /* The block is rejected if any transaction failed. */
+                if(fFailed.load())
+                {
+                    swContract.stop();
+                    return false;
+                }
+
+                /* Index the wave so later waves can check their dependants. */
+                for(const auto& nIndex : vWave)
+                    LLD::Ledger->IndexBlock(vPending[nIndex].first, hashBlock);
+            }
+
+            /* Finish in block order so fees, stakes and wallet updates are the same as serial. */
+            for(const auto& pending : vPending)
+            {
+                if(!commit_tritium(pending.second, pending.first, state))
+                {
+                    swContract.stop();
+                    return false;
+                }
+            }
+
+            swContract.stop();
+
+            /* Reset for the next run of transactions. */
+            vPending.clear();
+            scheduler.Clear();
+
+            return true;
+        }
+
+
         /** Connect a block state into chain. **/
         bool BlockState::Connect()
         {
+            static metrics::Histogram& metricConnect = metrics::GetHistogram("nexus_block_connect_seconds",
+                "Block connect latency.");
+            metrics::Timer timer(metricConnect);
+            trace::Span span("BlockState::Connect");
+
+            /* Temporaries of the block are allocated from an arena released when it is connected. */
+            ArenaScope arena;
+
             /* Reset the transaction fees. */
             nFees = 0;
 
             debug::log(3, "BLOCK BEGIN-------------------------------------");
 
+            /* Tritium transactions with known connect sets are scheduled, and connected concurrently by waves
+             * when the next transaction that must connect in block order is reached. Connecting is serial unless
+             * -connectthreads is set above 1, or to 0 for one thread per core. */
+            const uint32_t nThreads = ParallelThreads(config::GetArg("-connectthreads", 1));
+
+            std::vector<std::pair<uint512_t, Transaction>> vPending;
+            ConnectScheduler scheduler;
+
+            std::vector<uint256_t> vAddresses;
+            std::vector<uint512_t> vTransactions;
+
             /* Check through all the transactions. */
             for(const auto& proof : vtx)
             {
                 /* Only work on tritium transactions for now. */
                 if(proof.first == TRANSACTION::TRITIUM)
                 {
-                    /* Start the contracts stopwatch. */
-                    swContract.start();
-
                     /* Get the transaction hash. */
                     const uint512_t& hash = proof.second;
 
-                    /* Check for existing indexes. */
-                    if(LLD::Ledger->HasIndex(hash))
-                        return debug::error(FUNCTION, "transaction overwrites not allowed");
-
                     /* Make sure the transaction is on disk. */
                     TAO::Ledger::Transaction tx;
                     if(!LLD::Ledger->ReadTx(hash, tx))
                         return debug::error(FUNCTION, "transaction not on disk");
 
-                    if(config::nVerbose >= 3)
-                        tx.print();
-
-                    /* Check the ledger rules for sigchain at end. */
-                    if(!tx.IsFirst())
+                    /* Schedule the transaction if it doesn't need to connect on its own. */
+                    if(nThreads > 1 && ConnectSet(tx, hash, vAddresses, vTransactions))
                     {
-                        /* Check for the last hash. */
-                        uint512_t hashLast = 0;
-                        if(!LLD::Ledger->ReadLast(tx.hashGenesis, hashLast))
-                            return debug::error(FUNCTION, "failed to read last on non-genesis");
-
-                        /* Check that the last transaction is correct. */
-                        if(tx.hashPrevTx != hashLast)
-                            return debug::error(FUNCTION, "last hash hash mismatch");
+                        scheduler.Schedule(vPending.size(), vAddresses, vTransactions);
+                        vPending.emplace_back(hash, std::move(tx));
+
+                        continue;
                     }
 
-                    /* Verify the Ledger Pre-States. */
-                    if(!tx.Verify(FLAGS::BLOCK)) //NOTE: double checking this for now in post-processing
+                    /* Connect everything scheduled before this transaction. */
+                    if(!connect_pending(*this, vPending, scheduler, nThreads))
                         return false;
 
-                    /* Connect the transaction. */
-                    if(!tx.Connect(FLAGS::BLOCK, this))
-                        return debug::error(FUNCTION, "failed to connect transaction");
-
-                    /* Add legacy transactions to the wallet where appropriate */
-                    Legacy::Wallet::GetInstance().AddToWalletIfInvolvingMe(tx, *this, true);
-
-                    /* Accumulate the fees. */
-                    nFees += tx.Fees();
+                    /* Start the contracts stopwatch. */
+                    swContract.start();
 
-                    /* If tx is coinstake, also write the last stake. */
-                    if(tx.IsCoinStake())
+                    /* Connect the transaction. */
+                    if(!connect_tritium(tx, hash, this) || !commit_tritium(tx, hash, *this))
                     {
-                        /* Check the trust values. */
-                        if(!tx.CheckTrust(this))
-                            return debug::error(FUNCTION, "trust checks failed");
-
-                        /* Write the last stake value into the database. */
-                        if(!LLD::Ledger->WriteStake(tx.hashGenesis, hash))
-                            return debug::error(FUNCTION, "failed to write last stake");
-
-                        /* If local database has a stake change request for this transaction not marked as processed, update it.
-                         * This updates a request that was reset because coinstake was disconnected and now is reconnected, such
-                         * as if execute a forkblocks and re-sync.
-                         */
-                        StakeChange request;
-                        if(LLD::Local->ReadStakeChange(tx.hashGenesis, request)
-                        && !request.fProcessed && request.hashTx == tx.GetHash())
-                        {
-                            /* Mark as processed. */
-                            request.fProcessed = true;
-
-                            /* Erase if we can't update it. */
-                            if(!LLD::Local->WriteStakeChange(tx.hashGenesis, request))
-                                LLD::Local->EraseStakeChange(tx.hashGenesis);
-                        }
+                        swContract.stop();
+                        return false;
                     }
 
-                    /* Keep track of total contracts processed. */
-                    nTotalContracts += tx.Size();
                     swContract.stop();
                 }
                 else if(proof.first == TRANSACTION::LEGACY)
                 {
+                    /* Connect everything scheduled before this transaction. */
+                    if(!connect_pending(*this, vPending, scheduler, nThreads))
+                        return false;
+
                     /* Start the script stopwatch. */
                     swScript.start();
 
@@ -1072,6 +1207,10 @@ namespace TAO
                 LLD::Ledger->IndexBlock(proof.second, GetHash());
             }
 
+            /* Connect whatever is still scheduled. */
+            if(!connect_pending(*this, vPending, scheduler, nThreads))
+                return false;
+
             if(config::nVerbose >= 3)
                 debug::log(3, "Block Height ", nHeight, " Hash ", GetHash().SubString());
 
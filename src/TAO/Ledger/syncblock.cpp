@@ -114,6 +114,13 @@ namespace TAO
 
         /* Copy Constructor. */
         SyncBlock::SyncBlock(const BlockState& state)
+        : SyncBlock(state, LLD::Ledger, LLD::Legacy)
+        {
+        }
+
+
+        /* Build the block from a state, reading its transactions from the given databases. */
+        SyncBlock::SyncBlock(const BlockState& state, LLD::LedgerDB* pLedger, LLD::LegacyDB* pLegacy)
         : Block    (state)
         , nTime    (state.nTime)
         , ssSystem (state.ssSystem)
@@ -130,7 +137,7 @@ namespace TAO
                     {
                         /* Read the tritium transaction from disk. */
                         Transaction tx;
-                        if(!LLD::Ledger->ReadTx(proof.second, tx, FLAGS::MEMPOOL)) //check mempool too
+                        if(!pLedger->ReadTx(proof.second, tx, FLAGS::MEMPOOL)) //check mempool too
                             throw debug::exception(FUNCTION, "failed to read tx ", proof.second.SubString());
 
                         /* Serialize stream. */
@@ -148,7 +155,7 @@ namespace TAO
                     {
                         /* Read the tritium transaction from disk. */
                         Legacy::Transaction tx;
-                        if(!LLD::Legacy->ReadTx(proof.second, tx, FLAGS::MEMPOOL)) //check mempool too
+                        if(!pLegacy->ReadTx(proof.second, tx, FLAGS::MEMPOOL)) //check mempool too
                             throw debug::exception(FUNCTION, "failed to read tx ", proof.second.SubString());
 
                         /* Serialize stream. */
@@ -409,7 +409,7 @@ namespace TAO
         bool Transaction::Verify(const uint8_t nFlags) const
         {
             /* Create a temporary map for pre-states. */
-            std::map<uint256_t, TAO::Register::State> mapStates;
+            TAO::Register::StateMap mapStates;
 
             /* Run through all the contracts. */
             for(const auto& contract : vContracts)
@@ -43,6 +43,8 @@ ________________________________________________________________________________
 
 #include <Util/include/args.h>
 #include <Util/include/hex.h>
+#include <Util/include/metrics.h>
+#include <Util/include/trace.h>
 
 #include <cmath>
 
@@ -310,6 +312,11 @@ namespace TAO
         /* Checks if a block is valid if not connected to chain. */
         bool TritiumBlock::Check() const
         {
+            static metrics::Histogram& metricCheck = metrics::GetHistogram("nexus_block_check_seconds",
+                "Block check latency.", "type=\"tritium\"");
+            metrics::Timer timer(metricCheck);
+            trace::Span span("TritiumBlock::Check");
+
             /* Read ledger DB for duplicate block. */
             if(LLD::Ledger->HasBlock(GetHash()))
                 return false;//debug::error(FUNCTION, "already have block ", GetHash().SubString());
@@ -563,6 +570,11 @@ namespace TAO
         /** Accept a tritium block. **/
         bool TritiumBlock::Accept() const
         {
+            static metrics::Histogram& metricAccept = metrics::GetHistogram("nexus_block_accept_seconds",
+                "Block accept latency.", "type=\"tritium\"");
+            metrics::Timer timer(metricAccept);
+            trace::Span span("TritiumBlock::Accept");
+
             /* Read ledger DB for previous block. */
             TAO::Ledger::BlockState statePrev;
             if(!LLD::Ledger->ReadBlock(hashPrevBlock, statePrev))
@@ -848,5 +860,12 @@ namespace TAO
         {
             return Block::StakeHash(producer.hashGenesis);
         }
+
+
+        /* Get the input to the stake hash up to the nonce. */
+        std::vector<uint8_t> TritiumBlock::StakePrefix() const
+        {
+            return Block::StakePrefix(producer.hashGenesis);
+        }
     }
 }
@@ -46,9 +46,13 @@ ________________________________________________________________________________
 #include <Util/include/config.h>
 #include <Util/include/convert.h>
 #include <Util/include/debug.h>
+#include <Util/include/parallel.h>
 #include <Util/include/runtime.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <limits>
 
 
 /* Global TAO namespace. */
@@ -660,6 +664,85 @@ namespace TAO
         }
 
 
+        /* The most nonces hashed before the minter checks the chain and mempool again. */
+        const uint64_t STAKE_BATCH = 1 << 20;
+
+
+        /* The nonces a thread takes at a time. */
+        const uint64_t STAKE_CHUNK = 4096;
+
+
+        /* Get the last nonce at or below a cap that meets the required threshold at a block time, 0 for none. */
+        static uint64_t last_nonce(const uint32_t nBlockTime, const cv::softdouble& nRequired, const uint64_t nCap)
+        {
+            if(nBlockTime == 0)
+                return 0;
+
+            /* Every nonce meets a required threshold of zero or less. */
+            if(nRequired <= cv::softdouble(0.0))
+                return nCap;
+
+            /* Estimate from the threshold formula, then step to the exact boundary of the soft float comparison. */
+            const double dLast = (double(nBlockTime) * 100.0) / double(nRequired);
+            uint64_t nLast = (dLast >= double(nCap)) ? nCap : static_cast<uint64_t>(dLast);
+
+            while(nLast > 0 && GetCurrentThreshold(nBlockTime, nLast) < nRequired)
+                --nLast;
+
+            while(nLast < nCap && !(GetCurrentThreshold(nBlockTime, nLast + 1) < nRequired))
+                ++nLast;
+
+            return nLast;
+        }
+
+
+        /* Hash a range of nonces over a number of threads, finding the lowest with a stake hash within the target. */
+        static bool search_nonces(const LLC::SK1024Midstate& midstate, const uint1024_t& nHashTarget,
+                                  const uint1024_t& hashBlock, const uint64_t nFirst, const uint64_t nLast,
+                                  const uint32_t nThreads, uint64_t &nNonce)
+        {
+            const uint32_t nChunks = static_cast<uint32_t>((nLast - nFirst) / STAKE_CHUNK + 1);
+
+            std::atomic<uint64_t> nFound(std::numeric_limits<uint64_t>::max());
+            std::atomic<bool> fStale(false);
+            ParallelFor(nChunks, nThreads, [&](const uint32_t nChunk)
+            {
+                /* Stop once a new best block makes the candidate stale. */
+                if(fStale.load() || config::fShutdown.load())
+                    return;
+
+                if(ChainState::hashBestChain.load() != hashBlock)
+                {
+                    fStale.store(true);
+                    return;
+                }
+
+                const uint64_t nStart = nFirst + uint64_t(nChunk) * STAKE_CHUNK;
+                const uint64_t nEnd   = std::min(nLast, nStart + STAKE_CHUNK - 1);
+                for(uint64_t n = nStart; n <= nEnd; ++n)
+                {
+                    /* A lower nonce was already found. */
+                    if(n > nFound.load(std::memory_order_relaxed))
+                        return;
+
+                    if(midstate.Hash(n) <= nHashTarget)
+                    {
+                        uint64_t nCurrent = nFound.load();
+                        while(n < nCurrent && !nFound.compare_exchange_weak(nCurrent, n)) { }
+
+                        return;
+                    }
+                }
+            });
+
+            if(fStale.load() || nFound.load() == std::numeric_limits<uint64_t>::max())
+                return false;
+
+            nNonce = nFound.load();
+            return true;
+        }
+
+
         /* Attempt to solve the hashing algorithm at the current staking difficulty for the candidate block */
         void TritiumMinter::MintBlock(const memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user, const SecureString& strPIN)
         {
@@ -751,6 +834,12 @@ namespace TAO
                                     " at weight ", (nTrustWeight.load() + nBlockWeight.load()),
                                     " and stake rate ", nStakeRate.load());
 
+            /* The stake hash input is constant apart from the nonce while minting this block, so hash it once. */
+            const LLC::SK1024Midstate midstate(block.StakePrefix());
+
+            /* Threads to hash nonces with. */
+            const uint32_t nThreads = ParallelThreads(config::GetArg("-stakethreads", 1));
+
             /* Search for the proof of stake hash solution until it mines a block, minter is stopped,
              * or network generates a new block (minter must start over with new candidate)
              */
@@ -769,44 +858,39 @@ namespace TAO
                 block.UpdateTime();
                 uint32_t nBlockTime = block.GetBlockTime() - block.producer.nTimestamp; // How long working on this block
 
-                /* If just starting on block, wait */
-                if(nBlockTime == 0)
-                {
-                    runtime::sleep(1);
-                    continue;
-                }
-
-                /* Calculate the new Efficiency Threshold for the current nonce.
-                 * To stake, this value must be larger than required threshhold.
-                 * Block time increases the value while nonce decreases it.
-                 * nNonce = 1 at start of new block.
+                /* The threshold drops as the nonce rises, so every nonce up to a limit meets the required threshold
+                 * at this block time, and more become eligible each second. nNonce = 1 at start of new block.
                  */
-                cv::softdouble nThreshold = GetCurrentThreshold(nBlockTime, block.nNonce);
+                const uint64_t nCap  = block.nNonce + STAKE_BATCH - 1;
+                const uint64_t nLast = last_nonce(nBlockTime, nRequired, nCap);
 
-                /* If threshhold not larger than required, wait and keep trying the same nonce value until threshold increases */
-                if(nThreshold < nRequired)
+                /* Hash every newly eligible nonce. */
+                if(nLast >= block.nNonce)
                 {
-                    runtime::sleep(10);
-                    continue;
-                }
+                    debug::log(3, FUNCTION, "Threshold exceeds required ", nRequired,
+                        ", mining Proof of Stake with nonces ", block.nNonce, " to ", nLast);
+
+                    uint64_t nFound = 0;
+                    if(search_nonces(midstate, nHashTarget, hashLastBlock, block.nNonce, nLast, nThreads, nFound))
+                    {
+                        block.nNonce = nFound;
 
-                /* Log every 1000 attempts */
-                if(block.nNonce % 1000 == 0)
-                    debug::log(3, FUNCTION, "Threshold ", nThreshold, " exceeds required ",
-                        nRequired,", mining Proof of Stake with nonce ", block.nNonce);
+                        debug::log(0, FUNCTION, "Found new stake hash ", block.StakeHash().SubString());
 
-                /* Handle if block is found. */
-                uint1024_t hashProof = block.StakeHash();
-                if(hashProof <= nHashTarget)
-                {
-                    debug::log(0, FUNCTION, "Found new stake hash ", hashProof.SubString());
+                        ProcessBlock(user, strPIN);
+                        break;
+                    }
 
-                    ProcessBlock(user, strPIN);
-                    break;
+                    block.nNonce = nLast + 1;
+
+                    /* Keep going without waiting when the batch was cut short. */
+                    if(nLast == nCap)
+                        continue;
                 }
 
-                /* Increment nonce for next iteration. */
-                ++block.nNonce;
+                /* Nothing more is eligible until the block time ticks over, so sleep until then unless a new best
+                 * block arrives first. */
+                ChainState::WaitForBest(hashLastBlock, 1000 - (runtime::unifiedtimestamp(true) % 1000) + 1);
             }
 
             return;
@@ -1011,7 +1095,8 @@ namespace TAO
             /* Minting thread will continue repeating this loop until stop minter or shutdown */
             while(!TritiumMinter::fStop.load() && !config::fShutdown.load())
             {
-                runtime::sleep(pTritiumMinter->nSleepTime);
+                /* Wait before the next candidate, starting at once when the last one was made stale by a new block. */
+                ChainState::WaitForBest(pTritiumMinter->hashLastBlock, pTritiumMinter->nSleepTime);
 
                 /* Check stop/shutdown status after wakeup */
                 if(TritiumMinter::fStop.load() || config::fShutdown.load())
@@ -1025,7 +1110,8 @@ namespace TAO
                     break;
 
                 /* Get the active, unlocked sigchain. Requires session 0 */
-                memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = TAO::API::users->GetAccount(0);
+                const std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> pUser = TAO::API::users->GetAccount(0);
+                memory::encrypted_ptr<TAO::Ledger::SignatureChain>& user = *pUser;
                 if(!user)
                 {
                     debug::error(0, FUNCTION, "Stake minter could not retrieve the unlocked signature chain.");
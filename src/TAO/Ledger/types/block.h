@@ -261,12 +261,40 @@ namespace TAO
              *
              *  Build the merkle tree from the transaction list.
              *
-             *  @param[in] vMerkleTree The list of hashes to build merkle tree with.
+             *  @param[in] vHashes The list of hashes to build merkle tree with.
              *
              *  @return The 512-bit merkle root
              *
              **/
-            uint512_t BuildMerkleTree(std::vector<uint512_t> vMerkleTree) const;
+            uint512_t BuildMerkleTree(const std::vector<uint512_t>& vHashes) const;
+
+
+            /** BuildMerkleBranch
+             *
+             *  Build the merkle branch for a leaf appended after the given hashes. The branch only
+             *  depends on the leaves before it, so the root can be recomputed for any value of the
+             *  last leaf (the producer) without rebuilding the tree.
+             *
+             *  @param[in] vHashes The list of hashes before the last leaf.
+             *
+             *  @return The left siblings of the last leaf from the bottom of the tree up.
+             *
+             **/
+            std::vector<uint512_t> BuildMerkleBranch(const std::vector<uint512_t>& vHashes) const;
+
+
+            /** BuildMerkleRoot
+             *
+             *  Calculate the merkle root from the last leaf and its merkle branch.
+             *
+             *  @param[in] hashLeaf The hash of the last leaf.
+             *  @param[in] vBranch The merkle branch from BuildMerkleBranch.
+             *  @param[in] nIndex The index of the last leaf (number of hashes before it).
+             *
+             *  @return The 512-bit merkle root
+             *
+             **/
+            uint512_t BuildMerkleRoot(const uint512_t& hashLeaf, const std::vector<uint512_t>& vBranch, const uint32_t nIndex) const;
 
 
             /** ToString
@@ -367,6 +395,18 @@ namespace TAO
             uint1024_t StakeHash(const uint256_t& hashGenesis) const;
 
 
+            /** StakePrefix
+             *
+             *  Get the input to StakeHash(hashGenesis) up to the nonce.
+             *
+             *  @param[in] hashGenesis The hash of the user-id used to lock user search space
+             *
+             *  @return The serialized bytes before the nonce.
+             *
+             **/
+            std::vector<uint8_t> StakePrefix(const uint256_t& hashGenesis) const;
+
+
             /** StakeHash
              *
              *  Generates the StakeHash for this block from a uint576_t trust key
@@ -0,0 +1,199 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_TAO_LEDGER_TYPES_EVENT_H
+#define NEXUS_TAO_LEDGER_TYPES_EVENT_H
+
+#include <LLC/types/uint1024.h>
+
+#include <Util/templates/serialize.h>
+
+#include <vector>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+        /* Forward declarations. */
+        class Transaction;
+
+
+        /** The number of event sequences kept in each event chunk. **/
+        const uint32_t EVENT_CHUNK_SIZE = 16;
+
+
+        /** Event
+         *
+         *  Compact record of a contract that raised an event for an address, so outstanding notifications can be found
+         *  without reading every event's transaction.
+         *
+         **/
+        class Event
+        {
+        public:
+
+            /** The transaction that raised the event. **/
+            uint512_t hashTx;
+
+
+            /** The event sequence number for the address. **/
+            uint32_t nSequence;
+
+
+            /** The contract within the transaction. **/
+            uint32_t nContract;
+
+
+            /** The primitive operation of the contract (DEBIT, TRANSFER or COINBASE). **/
+            uint8_t nOP;
+
+
+            /** The proof to claim the contract with: the debited account, the transfer recipient or the miner. **/
+            uint256_t hashProof;
+
+
+            /** The debit recipient or the register transferred, 0 for coinbases. **/
+            uint256_t hashTarget;
+
+
+            /** The amount debited or mined, 0 for transfers. **/
+            uint64_t nAmount;
+
+
+            /** The timestamp of the transaction. **/
+            uint64_t nTimestamp;
+
+
+            IMPLEMENT_SERIALIZE
+            (
+                READWRITE(hashTx);
+                READWRITE(nSequence);
+                READWRITE(nContract);
+                READWRITE(nOP);
+                READWRITE(hashProof);
+                READWRITE(hashTarget);
+                READWRITE(nAmount);
+                READWRITE(nTimestamp);
+            )
+
+
+            /** Default Constructor. **/
+            Event();
+
+
+            /** Parse
+             *
+             *  Get the events a transaction raises for an address, one for each contract that could be meant for it.
+             *  Debits are kept whatever their recipient, as the recipient account can change owner.
+             *
+             *  @param[in] tx The transaction to parse.
+             *  @param[in] hashTx The hash of the transaction.
+             *  @param[in] hashAddress The address the event was written for.
+             *  @param[in] nSequence The event sequence number for the address.
+             *  @param[out] vEvents The events, added to the end.
+             *
+             **/
+            static void Parse(const Transaction& tx, const uint512_t& hashTx, const uint256_t& hashAddress,
+                              const uint32_t nSequence, std::vector<Event> &vEvents);
+        };
+
+
+        /** EventChunk
+         *
+         *  The compact events of EVENT_CHUNK_SIZE consecutive sequences of an address, so looking back through an address's
+         *  events takes one read per chunk. Every sequence has a slot of the same size whether it is written or not, so the
+         *  chunk never outgrows its sector and is updated in place as events are added.
+         *
+         **/
+        class EventChunk
+        {
+        public:
+
+            /** The states of a sequence's slot. **/
+            enum
+            {
+                EMPTY  = 0, //the sequence has not been written
+                NONE   = 1, //nothing in the sequence's transaction could be meant for the address
+                SINGLE = 2, //the sequence's only event is in its slot
+                MANY   = 3  //the sequence has more events than fit its slot, so its transaction must be read
+            };
+
+
+            /** The state of each sequence's slot. **/
+            std::vector<uint8_t> vStates;
+
+
+            /** The event of each sequence in the SINGLE state. **/
+            std::vector<Event> vEvents;
+
+
+            IMPLEMENT_SERIALIZE
+            (
+                READWRITE(vStates);
+                READWRITE(vEvents);
+            )
+
+
+            /** Default Constructor. **/
+            EventChunk();
+
+
+            /** Set
+             *
+             *  Set the events of a sequence.
+             *
+             *  @param[in] nSequence The sequence number.
+             *  @param[in] vSequence The events of the sequence.
+             *
+             **/
+            void Set(const uint32_t nSequence, const std::vector<Event>& vSequence);
+
+
+            /** Clear
+             *
+             *  Clear the slot of a sequence.
+             *
+             *  @param[in] nSequence The sequence number.
+             *
+             **/
+            void Clear(const uint32_t nSequence);
+
+
+            /** Empty
+             *
+             *  Check if no sequence in the chunk is written.
+             *
+             **/
+            bool Empty() const;
+
+
+            /** Get
+             *
+             *  Get the events of a sequence.
+             *
+             *  @param[in] nSequence The sequence number.
+             *  @param[out] vSequence The events, added to the end.
+             *
+             *  @return False if the sequence's events are not in the chunk and must be read from its transaction.
+             *
+             **/
+            bool Get(const uint32_t nSequence, std::vector<Event> &vSequence) const;
+        };
+    }
+}
+
+#endif
@@ -25,6 +25,10 @@ ________________________________________________________________________________
 #include <Legacy/types/outpoint.h>
 
 #include <Util/include/mutex.h>
+#include <Util/templates/flatmap.h>
+
+#include <atomic>
+#include <set>
 
 namespace LLP
 {
@@ -49,13 +53,31 @@ namespace TAO
         {
         public:
 
-            /* Mutex to local access to the mempool */
+            /* Mutex to serialize changes to the mempool. Readers don't need it, so it can be held through validation. */
             mutable std::recursive_mutex MUTEX;
 
         private:
 
+            /** OutPointHasher
+             *
+             *  Hash functor for legacy inputs, mixing the output index into the transaction id.
+             *
+             **/
+            struct OutPointHasher
+            {
+                size_t operator()(const Legacy::OutPoint& prevout) const
+                {
+                    return static_cast<size_t>(prevout.hash.Get64() ^ (uint64_t(prevout.n) * 0x9e3779b97f4a7c15));
+                }
+            };
+
+
+            /* Mutex to guard the indexes. Writers hold MUTEX and INDEX_MUTEX, readers only need one of them. */
+            mutable std::mutex INDEX_MUTEX;
+
+
             /** The transactions in the ledger memory pool. **/
-            std::map<uint512_t, Legacy::Transaction> mapLegacy;
+            FlatMap<uint512_t, Legacy::Transaction> mapLegacy;
 
 
             /** The transactions in conflicted legacy memory pool. */
@@ -63,28 +85,36 @@ namespace TAO
 
 
             /** The transactions in the ledger memory pool. **/
-            std::map<uint512_t, TAO::Ledger::Transaction> mapLedger;
+            FlatMap<uint512_t, TAO::Ledger::Transaction> mapLedger;
+
+
+            /** The transactions in the ledger memory pool by genesis, ordered by sequence. **/
+            std::map<uint256_t, std::set<std::pair<uint32_t, uint512_t> > > mapGenesis;
 
 
             /** The transactions in the conflicted ledger memory pool. **/
             std::map<uint512_t, TAO::Ledger::Transaction> mapConflicts;
 
 
-            /** Oprhan transactions in queue. **/
-            std::map<uint512_t, TAO::Ledger::Transaction> mapOrphans;
+            /** Record of legacy inputs in the mempool. **/
+            FlatMap<Legacy::OutPoint, uint512_t, OutPointHasher> mapInputs;
 
 
-            /** Record of conflicted transactions in mempool. **/
-            std::map<uint512_t, uint512_t> mapClaimed;
+            /** Oprhan transactions in queue. Guarded by MUTEX only. **/
+            FlatMap<uint512_t, TAO::Ledger::Transaction> mapOrphans;
 
 
-            /** Record of legacy inputs in the mempool. **/
-            std::map<Legacy::OutPoint, uint512_t> mapInputs;
+            /** Record of conflicted transactions in mempool. Guarded by MUTEX only. **/
+            FlatMap<uint512_t, uint512_t> mapClaimed;
 
 
-            /** Set to keep track of duplicate orphans by index. **/
+            /** Set to keep track of duplicate orphans by index. Guarded by MUTEX only. **/
             std::set<uint512_t> setOrphansByIndex;
 
+
+            /** Sequence counter, incremented whenever transactions are added or removed. **/
+            std::atomic<uint64_t> nSequence;
+
         public:
 
             /** Default Constructor. **/
@@ -301,7 +331,10 @@ namespace TAO
 
             /** List
              *
-             *  List transactions in memory pool.
+             *  List transactions in memory pool. Tritium transactions are listed by sigchain in
+             *  sequence order, with the sigchains paying the most fees first and then the oldest.
+             *  A credit or claim is listed after the debit or transfer it spends when that is in the
+             *  memory pool too. Legacy transactions are listed oldest first.
              *
              *  @param[out] vHashes List of transaction hashes.
              *  @param[in] nCount The total transactions to get.
@@ -320,12 +353,47 @@ namespace TAO
             uint32_t Size();
 
 
+            /** Sequence
+             *
+             *  Gets the sequence counter of the memory pool. Any change to the set of
+             *  transactions in the pool changes this value, so callers can cheaply tell
+             *  whether anything needs to be re-read.
+             *
+             **/
+            uint64_t Sequence() const;
+
+
             /** SizeLegacy
              *
              *  Gets the size of the legacy memory pool.
              *
              **/
             uint32_t SizeLegacy();
+
+
+        private:
+
+            /** add_ledger
+             *
+             *  Add a transaction to the ledger memory and its indexes. Must hold MUTEX.
+             *
+             *  @param[in] hashTx The transaction hash.
+             *  @param[in] tx The transaction to add.
+             *
+             **/
+            void add_ledger(const uint512_t& hashTx, const TAO::Ledger::Transaction& tx);
+
+
+            /** remove_ledger
+             *
+             *  Remove a transaction from the ledger memory and its indexes. Must hold MUTEX.
+             *
+             *  @param[in] hashTx The transaction hash.
+             *
+             *  @return true if the transaction was removed.
+             *
+             **/
+            bool remove_ledger(const uint512_t& hashTx);
         };
 
         extern Mempool mempool;
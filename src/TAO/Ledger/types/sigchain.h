@@ -22,7 +22,9 @@ ________________________________________________________________________________
 #include <Util/include/mutex.h>
 #include <Util/include/memory.h>
 
+#include <array>
 #include <string>
+#include <vector>
 
 /* Global TAO namespace. */
 namespace TAO
@@ -52,12 +54,40 @@ namespace TAO
             const SecureString strPassword;
 
 
+            /** KeyCache
+             *
+             *  A derived key and the fingerprint of the genesis, key ID, key type and secret it was derived from.
+             *
+             **/
+            struct KeyCache
+            {
+                /** The fingerprint of the key's inputs, 0 if unused. **/
+                uint256_t hashIndex;
+
+
+                /** The derived key. **/
+                uint512_t hashKey;
+
+
+                /** The cache counter when the key was last used. **/
+                uint64_t nUsed;
+            };
+
+
+            /** The number of derived keys kept per signature chain. **/
+            static const uint32_t KEY_CACHE_SIZE = 16;
+
+
             /* Internal mutex for caches. */
             mutable std::mutex MUTEX;
 
 
-            /** Internal sigchain cache (to not exhaust ourselves regenerating the same key). **/
-            mutable std::pair<uint32_t, SecureString> pairCache;
+            /** Internal key cache (to not exhaust ourselves regenerating the same keys with argon2). **/
+            mutable std::array<KeyCache, KEY_CACHE_SIZE> vKeyCache;
+
+
+            /** Counter to find the least recently used key in the cache. **/
+            mutable uint64_t nCacheCounter;
 
 
             /** Internal genesis hash. **/
@@ -128,7 +158,7 @@ namespace TAO
              *
              *  @param[in] nKeyID The key number in the keychian
              *  @param[in] strSecret The secret phrase to use
-             *  @param[in] fCache Use the cache on hand for keys.
+             *  @param[in] fCache Use the cache on hand for keys, the derived key is cached either way.
              *
              *  @return The 512 bit hash of this key in the series.
              **/
@@ -190,6 +220,22 @@ namespace TAO
             uint256_t KeyHash(const std::string& strType, const uint32_t nKeyID, const SecureString& strSecret, const uint8_t nType) const;
 
 
+            /** KeyHashes
+             *
+             *  Generates the public key hashes of several key types at once, deriving the keys on separate threads.
+             *  The number of threads is set by -argon2_threads, where 0 means one per core.
+             *
+             *  @param[in] vTypes The types of signing keys used.
+             *  @param[in] nKeyID The key number in the keychian
+             *  @param[in] strSecret The secret phrase to use
+             *  @param[in] nType The key type to use.
+             *
+             *  @return The 256 bit hashes of the keys, in the order of the types.
+             **/
+            std::vector<uint256_t> KeyHashes(const std::vector<std::string>& vTypes, const uint32_t nKeyID,
+                                             const SecureString& strSecret, const uint8_t nType) const;
+
+
             /** RecoveryHash
              *
              *  This function generates a hash of a public key generated from a recovery seed phrase.
@@ -235,6 +281,53 @@ namespace TAO
             bool Sign(const std::string& strType, const std::vector<uint8_t>& vchData, const uint512_t& hashSecret,
                                       std::vector<uint8_t>& vchPubKey, std::vector<uint8_t>& vchSig) const;
 
+
+        private:
+
+            /** derive
+             *
+             *  Run argon2 over the username, password and secret for a key in the keychain.
+             *
+             *  @param[in] nKeyID The key number in the keychian
+             *  @param[in] strPasswordIn The password to use
+             *  @param[in] strSecret The secret phrase to use
+             *  @param[in] strType The type of signing key, empty for the transaction keys.
+             *
+             *  @return The 512 bit hash of this key in the series.
+             *
+             **/
+            uint512_t derive(const uint32_t nKeyID, const SecureString& strPasswordIn,
+                             const SecureString& strSecret, const std::string& strType) const;
+
+
+            /** key_index
+             *
+             *  Get the fingerprint of a key's inputs to find it in the cache.
+             *
+             **/
+            uint256_t key_index(const uint32_t nKeyID, const SecureString& strSecret, const std::string& strType) const;
+
+
+            /** get_cache
+             *
+             *  Get a derived key from the cache.
+             *
+             *  @param[in] hashIndex The fingerprint of the key's inputs.
+             *  @param[out] hashKey The derived key.
+             *
+             *  @return true if the key was cached.
+             *
+             **/
+            bool get_cache(const uint256_t& hashIndex, uint512_t &hashKey) const;
+
+
+            /** put_cache
+             *
+             *  Add a derived key to the cache, replacing the least recently used key if full.
+             *
+             **/
+            void put_cache(const uint256_t& hashIndex, const uint512_t& hashKey) const;
+
         };
     }
 }
@@ -24,6 +24,14 @@ ________________________________________________________________________________
 
 #include <Util/templates/serialize.h>
 
+
+/* Forward declarations. */
+namespace LLD
+{
+    class LedgerDB;
+    class LegacyDB;
+}
+
 /* Global TAO namespace. */
 namespace TAO
 {
@@ -113,6 +121,19 @@ namespace TAO
             /** Copy Constructor. **/
             SyncBlock(const BlockState& state);
 
+
+            /** Database Constructor
+             *
+             *  Build the block from a state, reading its transactions from the given databases rather than the
+             *  global instances.
+             *
+             *  @param[in] state The block state to build from.
+             *  @param[in] pLedger The ledger database to read tritium transactions from.
+             *  @param[in] pLegacy The legacy database to read legacy transactions from.
+             *
+             **/
+            SyncBlock(const BlockState& state, LLD::LedgerDB* pLedger, LLD::LegacyDB* pLegacy);
+
         };
     }
 }
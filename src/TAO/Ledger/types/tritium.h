@@ -225,6 +225,16 @@ namespace TAO
             uint1024_t StakeHash() const;
 
 
+            /** StakePrefix
+             *
+             *  Get the input to the stake hash up to the nonce, which is constant while minting a block.
+             *
+             *  @return The serialized bytes before the nonce.
+             *
+             **/
+            std::vector<uint8_t> StakePrefix() const;
+
+
             /** ToString
              *
              *  For debugging Purposes seeing block state data dump
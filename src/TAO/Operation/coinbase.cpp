@@ -15,6 +15,7 @@ ________________________________________________________________________________
 
 #include <TAO/Operation/include/coinbase.h>
 #include <TAO/Operation/include/enum.h>
+#include <TAO/Operation/types/contract.h>
 
 /* Global TAO namespace. */
 namespace TAO
@@ -25,13 +26,13 @@ namespace TAO
     {
 
         /* Commit the final state to disk. */
-        bool Coinbase::Commit(const uint256_t& hashAddress, const uint512_t& hashTx, const uint8_t nFlags)
+        bool Coinbase::Commit(const uint256_t& hashAddress, const Contract& contract, const uint8_t nFlags)
         {
             /* Check to contract caller. */
             if(nFlags == TAO::Ledger::FLAGS::BLOCK)
             {
                 /* Write the event to the database. */
-                if(!LLD::Ledger->WriteEvent(hashAddress, hashTx))
+                if(!contract.Tx() || !LLD::Ledger->WriteEvent(hashAddress, contract.Hash(), *contract.Tx()))
                     return debug::error(FUNCTION, "OP::COINBASE: failed to write event for coinbase");
             }
 
@@ -36,6 +36,13 @@ namespace TAO
         , contract              (condition.contract)
         , caller                (condition.caller)
         , vEvaluate             (condition.vEvaluate)
+        , mapStates             (condition.mapStates)
+        , statePrestate         (condition.statePrestate)
+        , fPrestate             (condition.fPrestate)
+        , nBestHeight           (condition.nBestHeight)
+        , nBestSupply           (condition.nBestSupply)
+        , nBestTime             (condition.nBestTime)
+        , fBest                 (condition.fBest)
         , nCost                 (condition.nCost)
         {
         }
@@ -47,6 +54,13 @@ namespace TAO
         , contract              (std::move(condition.contract))
         , caller                (std::move(condition.caller))
         , vEvaluate             (std::move(condition.vEvaluate))
+        , mapStates             (std::move(condition.mapStates))
+        , statePrestate         (std::move(condition.statePrestate))
+        , fPrestate             (std::move(condition.fPrestate))
+        , nBestHeight           (std::move(condition.nBestHeight))
+        , nBestSupply           (std::move(condition.nBestSupply))
+        , nBestTime             (std::move(condition.nBestTime))
+        , fBest                 (std::move(condition.fBest))
         , nCost                 (std::move(condition.nCost))
         {
         }
@@ -63,6 +77,13 @@ namespace TAO
         , contract              (contractIn)
         , caller                (callerIn)
         , vEvaluate             ( )
+        , mapStates             ( )
+        , statePrestate         ( )
+        , fPrestate             (false)
+        , nBestHeight           (0)
+        , nBestSupply           (0)
+        , nBestTime             (0)
+        , fBest                 (false)
         , nCost                 (nCostIn)
         {
             /* Push base group, which is what contains final return value. */
@@ -1106,7 +1127,7 @@ namespace TAO
                                 deallocate(hashRegister, vRet);
 
                                 /* Read the register states. */
-                                if(!LLD::Register->ReadState(hashRegister, state))
+                                if(!read_state(hashRegister, state))
                                     return false;
 
                                 /* Check for overflows. */
@@ -1121,18 +1142,8 @@ namespace TAO
 
                             case OP::CALLER::PRESTATE::MODIFIED:
                             {
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
-
-                                /* Read the pre-state state. */
-                                uint8_t nState = 0;
-                                caller >>= nState;
-
                                 /* Get the pre-state. */
-                                caller >>= state;
-
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
+                                read_prestate(state);
 
                                 /* Check for overflows. */
                                 if(nCost + 8 < nCost)
@@ -1169,7 +1180,7 @@ namespace TAO
                                 deallocate(hashRegister, vRet);
 
                                 /* Read the register states. */
-                                if(!LLD::Register->ReadState(hashRegister, state))
+                                if(!read_state(hashRegister, state))
                                     return false;
 
                                 /* Check for overflows. */
@@ -1184,18 +1195,8 @@ namespace TAO
 
                             case OP::CALLER::PRESTATE::CREATED:
                             {
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
-
-                                /* Read the pre-state state. */
-                                uint8_t nState = 0;
-                                caller >>= nState;
-
                                 /* Get the pre-state. */
-                                caller >>= state;
-
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
+                                read_prestate(state);
 
                                 /* Check for overflows. */
                                 if(nCost + 8 < nCost)
@@ -1232,7 +1233,7 @@ namespace TAO
                                 deallocate(hashRegister, vRet);
 
                                 /* Read the register states. */
-                                if(!LLD::Register->ReadState(hashRegister, state))
+                                if(!read_state(hashRegister, state))
                                     return false;
 
                                 /* Check for overflows. */
@@ -1247,18 +1248,8 @@ namespace TAO
 
                             case OP::CALLER::PRESTATE::OWNER:
                             {
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
-
-                                /* Read the pre-state state. */
-                                uint8_t nState = 0;
-                                caller >>= nState;
-
                                 /* Get the pre-state. */
-                                caller >>= state;
-
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
+                                read_prestate(state);
 
                                 /* Check for overflows. */
                                 if(nCost + 32 < nCost)
@@ -1295,7 +1286,7 @@ namespace TAO
                                 deallocate(hashRegister, vRet);
 
                                 /* Read the register states. */
-                                if(!LLD::Register->ReadState(hashRegister, state))
+                                if(!read_state(hashRegister, state))
                                     return false;
 
                                 /* Check for overflows. */
@@ -1310,18 +1301,8 @@ namespace TAO
 
                             case OP::CALLER::PRESTATE::TYPE:
                             {
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
-
-                                /* Read the pre-state state. */
-                                uint8_t nState = 0;
-                                caller >>= nState;
-
                                 /* Get the pre-state. */
-                                caller >>= state;
-
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
+                                read_prestate(state);
 
                                 /* Check for overflows. */
                                 if(nCost + 1 < nCost)
@@ -1358,7 +1339,7 @@ namespace TAO
                                 deallocate(hashRegister, vRet);
 
                                 /* Read the register states. */
-                                if(!LLD::Register->ReadState(hashRegister, state))
+                                if(!read_state(hashRegister, state))
                                     return false;
 
                                 /* Check for overflows. */
@@ -1374,18 +1355,8 @@ namespace TAO
 
                             case OP::CALLER::PRESTATE::STATE:
                             {
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
-
-                                /* Read the pre-state state. */
-                                uint8_t nState = 0;
-                                caller >>= nState;
-
                                 /* Get the pre-state. */
-                                caller >>= state;
-
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
+                                read_prestate(state);
 
                                 /* Check for overflows. */
                                 uint32_t nSize = state.GetState().size();
@@ -1423,7 +1394,7 @@ namespace TAO
                                 deallocate(hashRegister, vRet);
 
                                 /* Read the register states. */
-                                if(!LLD::Register->ReadState(hashRegister, object))
+                                if(!read_state(hashRegister, object))
                                     return false;
 
                                 /* Check for overflows. */
@@ -1438,18 +1409,8 @@ namespace TAO
 
                             case OP::CALLER::PRESTATE::VALUE:
                             {
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
-
-                                /* Read the pre-state state. */
-                                uint8_t nState = 0;
-                                caller >>= nState;
-
                                 /* Get the pre-state. */
-                                caller >>= object;
-
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
+                                read_prestate(object);
 
                                 break;
                             }
@@ -1858,7 +1819,8 @@ namespace TAO
                     case OP::LEDGER::HEIGHT:
                     {
                         /* Allocate to the registers. */
-                        allocate(TAO::Ledger::ChainState::stateBest.load().nHeight, vRet);
+                        load_best();
+                        allocate(nBestHeight, vRet);
 
                         /* Check for overflows. */
                         if(nCost + 4 < nCost)
@@ -1875,7 +1837,8 @@ namespace TAO
                     case OP::LEDGER::SUPPLY:
                     {
                         /* Allocate to the registers. */
-                        allocate(uint64_t(TAO::Ledger::ChainState::stateBest.load().nMoneySupply), vRet);
+                        load_best();
+                        allocate(nBestSupply, vRet);
 
                         /* Check for overflows. */
                         if(nCost + 8 < nCost)
@@ -1892,7 +1855,8 @@ namespace TAO
                     case OP::LEDGER::TIMESTAMP:
                     {
                         /* Allocate to the registers. */
-                        allocate(uint64_t(TAO::Ledger::ChainState::stateBest.load().nTime), vRet);
+                        load_best();
+                        allocate(nBestTime, vRet);
 
                         /* Check for overflows. */
                         if(nCost + 8 < nCost)
@@ -1971,5 +1935,67 @@ namespace TAO
 
             return true;
         }
+
+
+        /* Read a register state, reusing states already read during this evaluation. */
+        bool Condition::read_state(const uint256_t& hashRegister, TAO::Register::State& state)
+        {
+            /* Check for a state already read. */
+            auto it = mapStates.find(hashRegister);
+            if(it == mapStates.end())
+            {
+                /* Read the register states. */
+                TAO::Register::State stateRead;
+                if(!LLD::Register->ReadState(hashRegister, stateRead))
+                    return false;
+
+                it = mapStates.emplace(hashRegister, std::move(stateRead)).first;
+            }
+
+            state = it->second;
+
+            return true;
+        }
+
+
+        /* Read the caller's pre-state, deserializing it from the caller on first use. */
+        void Condition::read_prestate(TAO::Register::State& state)
+        {
+            if(!fPrestate)
+            {
+                /* Reset the contract. */
+                caller.Reset(Contract::REGISTERS);
+
+                /* Read the pre-state state. */
+                uint8_t nState = 0;
+                caller >>= nState;
+
+                /* Get the pre-state. */
+                caller >>= statePrestate;
+
+                /* Reset the contract. */
+                caller.Reset(Contract::REGISTERS);
+
+                fPrestate = true;
+            }
+
+            state = statePrestate;
+        }
+
+
+        /* Load the best chain values on first use. */
+        void Condition::load_best()
+        {
+            if(fBest)
+                return;
+
+            /* Copy the best state once, it holds the whole block. */
+            const TAO::Ledger::BlockState stateBest = TAO::Ledger::ChainState::stateBest.load();
+            nBestHeight = stateBest.nHeight;
+            nBestSupply = stateBest.nMoneySupply;
+            nBestTime   = stateBest.nTime;
+
+            fBest = true;
+        }
     }
 }
@@ -36,6 +36,7 @@ namespace TAO
         , nTimestamp  (0)
         , hashTx      (0)
         , nVersion    (TAO::Ledger::CurrentTransactionVersion())
+        , ptx         (nullptr)
         {
         }
 
@@ -49,6 +50,7 @@ namespace TAO
         , nTimestamp  (contract.nTimestamp)
         , hashTx      (contract.hashTx)
         , nVersion    (contract.nVersion)
+        , ptx         (nullptr)
         {
         }
 
@@ -62,6 +64,7 @@ namespace TAO
         , nTimestamp  (std::move(contract.nTimestamp))
         , hashTx      (std::move(contract.hashTx))
         , nVersion    (std::move(contract.nVersion))
+        , ptx         (nullptr)
         {
         }
 
@@ -76,6 +79,7 @@ namespace TAO
             nTimestamp  = contract.nTimestamp;
             hashTx      = contract.hashTx;
             nVersion    = contract.nVersion;
+            ptx         = nullptr;
 
             return *this;
         }
@@ -91,6 +95,7 @@ namespace TAO
             nTimestamp  = std::move(contract.nTimestamp);
             hashTx      = std::move(contract.hashTx);
             nVersion    = std::move(contract.nVersion);
+            ptx         = nullptr;
 
             return *this;
         }
@@ -114,6 +119,7 @@ namespace TAO
             nTimestamp = tx->nTimestamp;
             hashTx     = tx->GetHash();
             nVersion   = tx->nVersion;
+            ptx        = tx;
         }
 
         /* Get the primitive operation. */
@@ -177,6 +183,13 @@ namespace TAO
         }
 
 
+        /* Get the transaction the contract is bound to */
+        const TAO::Ledger::Transaction* Contract::Tx() const
+        {
+            return ptx;
+        }
+
+
         /* Get the value of the contract if valid */
         bool Contract::Value(uint64_t &nValue) const
         {
@@ -15,6 +15,7 @@ ________________________________________________________________________________
 
 #include <TAO/Operation/include/debit.h>
 #include <TAO/Operation/include/enum.h>
+#include <TAO/Operation/types/contract.h>
 
 #include <TAO/Register/include/constants.h>
 #include <TAO/Register/include/reserved.h>
@@ -31,7 +32,7 @@ namespace TAO
     {
 
         /* Commit the final state to disk. */
-        bool Debit::Commit(const TAO::Register::Object& account, const uint512_t& hashTx,
+        bool Debit::Commit(const TAO::Register::Object& account, const Contract& contract,
                            const uint256_t& hashFrom, const uint256_t& hashTo, const uint8_t nFlags)
         {
             /* Only commit events on new block. */
@@ -45,7 +46,7 @@ namespace TAO
                 if(nFlags == TAO::Ledger::FLAGS::BLOCK)
                 {
                     /* Commit an event for other sigchain. */
-                    if(!LLD::Ledger->WriteEvent(state.hashOwner, hashTx))
+                    if(!contract.Tx() || !LLD::Ledger->WriteEvent(state.hashOwner, contract.Hash(), *contract.Tx()))
                         return debug::error(FUNCTION, "failed to write event for account ", state.hashOwner.SubString());
                 }
             }
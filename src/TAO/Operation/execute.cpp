@@ -380,7 +380,7 @@ namespace TAO
                             return debug::error(FUNCTION, "OP::TRANSFER: invalid register post-state");
 
                         /* Commit the register to disk. */
-                        if(!Transfer::Commit(state, contract.Hash(), hashAddress, hashTransfer, nFlags))
+                        if(!Transfer::Commit(state, contract, hashAddress, hashTransfer, nFlags))
                             return false;
 
                         break;
@@ -502,7 +502,7 @@ namespace TAO
                         contract.Seek(16);
 
                         /* Commit to disk. */
-                        if(contract.Caller() != hashGenesis && !Coinbase::Commit(hashGenesis, contract.Hash(), nFlags))
+                        if(contract.Caller() != hashGenesis && !Coinbase::Commit(hashGenesis, contract, nFlags))
                             return false;
 
                         break;
@@ -694,7 +694,7 @@ namespace TAO
                             return debug::error(FUNCTION, "OP::DEBIT: invalid register post-state");
 
                         /* Commit the register to disk. */
-                        if(!Debit::Commit(object, contract.Hash(), hashFrom, hashTo, nFlags))
+                        if(!Debit::Commit(object, contract, hashFrom, hashTo, nFlags))
                             return false;
 
                         break;
@@ -44,13 +44,13 @@ namespace TAO
              *
              *  @param[in] state The state to commit.
              *  @param[in] hashAddress The register address to commit.
-             *  @param[in] hashTx The transaction that is calling coinbase
+             *  @param[in] contract The contract to commit, bound to its calling transaction.
              *  @param[in] nFlags Flags to the LLD instance.
              *
              *  @return true if successful.
              *
              **/
-            bool Commit(const uint256_t& hashAddress, const uint512_t& hashTx, const uint8_t nFlags);
+            bool Commit(const uint256_t& hashAddress, const Contract& contract, const uint8_t nFlags);
 
 
             /** Verify
@@ -50,7 +50,7 @@ namespace TAO
              *  Commit the final state to disk.
              *
              *  @param[in] state The state to commit.
-             *  @param[in] hashTx The tx-id of calling transaction.
+             *  @param[in] contract The contract to commit, bound to its calling transaction.
              *  @param[in] hashAddress The register address to commit.
              *  @param[in] hashTransfer The new user to be transferred to..
              *  @param[in] nFlags Flags to the LLD instance.
@@ -58,7 +58,7 @@ namespace TAO
              *  @return true if successful.
              *
              **/
-            bool Commit(const TAO::Register::State& state, const uint512_t& hashTx,
+            bool Commit(const TAO::Register::State& state, const Contract& contract,
                         const uint256_t& hashAddress, const uint256_t& hashTransfer, const uint8_t nFlags);
 
 
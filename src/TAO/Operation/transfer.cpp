@@ -31,14 +31,14 @@ namespace TAO
     {
 
         /* Commit the final state to disk. */
-        bool Transfer::Commit(const TAO::Register::State& state, const uint512_t& hashTx,
+        bool Transfer::Commit(const TAO::Register::State& state, const Contract& contract,
                               const uint256_t& hashAddress, const uint256_t& hashTransfer, const uint8_t nFlags)
         {
             /* Only commit events on new block. */
             if((nFlags == TAO::Ledger::FLAGS::BLOCK) && hashTransfer != TAO::Register::WILDCARD_ADDRESS)
             {
                 /* Write the transfer event. */
-                if(!LLD::Ledger->WriteEvent(hashTransfer, hashTx))
+                if(!contract.Tx() || !LLD::Ledger->WriteEvent(hashTransfer, contract.Hash(), *contract.Tx()))
                     return debug::error(FUNCTION, "failed to write event for ", hashTransfer.SubString());
             }
 
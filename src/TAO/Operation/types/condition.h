@@ -18,10 +18,12 @@ ________________________________________________________________________________
 #include <TAO/Operation/types/stream.h>
 
 #include <TAO/Register/types/basevm.h>
+#include <TAO/Register/types/state.h>
 #include <TAO/Register/types/value.h>
 
 #include <TAO/Ledger/types/transaction.h>
 
+#include <map>
 #include <stack>
 
 namespace TAO
@@ -48,6 +50,28 @@ namespace TAO
             std::stack<std::pair<bool, uint8_t>> vEvaluate;
 
 
+            /** Register states read during this evaluation, so repeated references don't go back to the database. **/
+            std::map<uint256_t, TAO::Register::State> mapStates;
+
+
+            /** The caller's pre-state, deserialized on first use. **/
+            TAO::Register::State statePrestate;
+
+
+            /** Flag to tell if the caller's pre-state has been deserialized. **/
+            bool fPrestate;
+
+
+            /** The best chain height, supply and time, loaded on first use. **/
+            uint32_t nBestHeight;
+            uint64_t nBestSupply;
+            uint64_t nBestTime;
+
+
+            /** Flag to tell if the best chain values have been loaded. **/
+            bool fBest;
+
+
         public:
 
 
@@ -125,6 +149,36 @@ namespace TAO
             bool EvaluateV2();
 
 
+            /** read_state
+             *
+             *  Read a register state, reusing states already read during this evaluation.
+             *
+             *  @param[in] hashRegister The register address.
+             *  @param[out] state The state read.
+             *
+             *  @return true if the register exists.
+             *
+             **/
+            bool read_state(const uint256_t& hashRegister, TAO::Register::State& state);
+
+
+            /** read_prestate
+             *
+             *  Read the caller's pre-state, deserializing it from the caller on first use.
+             *
+             *  @param[out] state The pre-state read.
+             *
+             **/
+            void read_prestate(TAO::Register::State& state);
+
+
+            /** load_best
+             *
+             *  Load the best chain values on first use.
+             *
+             **/
+            void load_best();
+
 
         };
     }
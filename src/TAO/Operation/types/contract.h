@@ -75,6 +75,10 @@ namespace TAO
             mutable uint32_t nVersion;
 
 
+            /** MEMORY ONLY: the calling transaction, not kept by copies as it is only valid while that transaction is. **/
+            mutable const TAO::Ledger::Transaction* ptx;
+
+
         public:
 
             /** Enumeration to handle setting aspects of the contract. */
@@ -180,6 +184,16 @@ namespace TAO
             const uint32_t& Version() const;
 
 
+            /** Tx
+             *
+             *  Get the transaction the contract is bound to
+             *
+             *  @return Returns the calling tx, or nullptr if not bound since it was copied
+             *
+             **/
+            const TAO::Ledger::Transaction* Tx() const;
+
+
             /** Value
              *
              *  Get the value of the contract if valid
@@ -17,16 +17,68 @@ ________________________________________________________________________________
 #include <TAO/Register/types/basevm.h>
 #include <TAO/Register/types/exception.h>
 
+#include <algorithm>
+
 namespace TAO
 {
 
     namespace Register
     {
 
+        /* Size Constructor, all registers start as zero. */
+        RegisterMemory::RegisterMemory(const uint32_t nSizeIn)
+        : vHeap ( )
+        , pData (vInline)
+        , nSize (nSizeIn)
+        {
+            /* Use the heap for sizes beyond the inline memory. */
+            if(nSize > INLINE)
+            {
+                vHeap.resize(nSize, 0);
+                pData = &vHeap[0];
+            }
+            else
+                std::fill(vInline, vInline + nSize, 0);
+        }
+
+
+        /* Copy constructor. */
+        RegisterMemory::RegisterMemory(const RegisterMemory& memory)
+        : vHeap (memory.vHeap)
+        , pData (vInline)
+        , nSize (memory.nSize)
+        {
+            /* Point to our own copy of the memory. */
+            if(nSize > INLINE)
+                pData = &vHeap[0];
+            else
+                std::copy(memory.vInline, memory.vInline + nSize, vInline);
+        }
+
+
+        /* Copy assignment. */
+        RegisterMemory& RegisterMemory::operator=(const RegisterMemory& memory)
+        {
+            if(this == &memory)
+                return *this;
+
+            vHeap = memory.vHeap;
+            nSize = memory.nSize;
+            pData = vInline;
+
+            /* Point to our own copy of the memory. */
+            if(nSize > INLINE)
+                pData = &vHeap[0];
+            else
+                std::copy(memory.vInline, memory.vInline + nSize, vInline);
+
+            return *this;
+        }
+
 
         /* Default constructor. */
         BaseVM::BaseVM(const uint32_t nSize)
-        : vRegister (nSize, 0)
+        : vRegister (nSize)
         , nPointer  (0)
         {
         }
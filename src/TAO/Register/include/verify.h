@@ -19,6 +19,10 @@ ________________________________________________________________________________
 
 #include <TAO/Ledger/include/enum.h>
 
+#include <Util/include/arena.h>
+
+#include <map>
+
 /* Global TAO namespace. */
 namespace TAO
 {
@@ -35,6 +39,11 @@ namespace TAO
     {
         class State;
 
+
+        /** Temporary states by address, allocated from the current arena. **/
+        typedef std::map<uint256_t, State, std::less<uint256_t>,
+                         ArenaAllocator<std::pair<const uint256_t, State>>> StateMap;
+
         /** Verify
          *
          *  Verify the pre-states of a register to current network state.
@@ -47,7 +56,7 @@ namespace TAO
          *
          **/
         bool Verify(const TAO::Operation::Contract& contract,
-                    std::map<uint256_t, TAO::Register::State>& mapStates, const uint8_t nFlags = TAO::Ledger::FLAGS::BLOCK);
+                    StateMap& mapStates, const uint8_t nFlags = TAO::Ledger::FLAGS::BLOCK);
 
     }
 }
@@ -0,0 +1,114 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/Register/types/layout.h>
+#include <TAO/Register/include/enum.h>
+
+#include <Util/include/mutex.h>
+
+#include <algorithm>
+#include <unordered_map>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Register Layer namespace. */
+    namespace Register
+    {
+
+        /* The maximum number of interned layouts, schemas past this are parsed into their own layout. */
+        const uint32_t MAX_LAYOUTS = 4096;
+
+
+        /* Mutex to protect the interned layouts. */
+        static std::mutex LAYOUT_MUTEX;
+
+
+        /* The interned layouts by schema. */
+        static std::unordered_map<std::string, std::shared_ptr<const ObjectLayout>> mapLayouts;
+
+
+        /* Layouts this thread already found in the interned layouts. They are never removed from there, so these don't go stale. */
+        static thread_local std::unordered_map<std::string, std::shared_ptr<const ObjectLayout>> mapThreadLayouts;
+
+
+        /* Default Constructor. */
+        ObjectLayout::ObjectLayout()
+        : vFields   ( )
+        , nStandard (OBJECTS::NONSTANDARD)
+        {
+        }
+
+
+        /* Find a field by name. */
+        const ObjectField* ObjectLayout::Find(const std::string& strName) const
+        {
+            auto it = std::lower_bound(vFields.begin(), vFields.end(), strName,
+                [](const ObjectField& field, const std::string& strFind)
+                {
+                    return field.strName < strFind;
+                });
+
+            if(it == vFields.end() || it->strName != strName)
+                return nullptr;
+
+            return &(*it);
+        }
+
+
+        /* Get an interned layout by its schema. */
+        std::shared_ptr<const ObjectLayout> ObjectLayout::Get(const std::string& strSchema)
+        {
+            /* Check this thread's layouts first, so lookups of known schemas don't take the lock. */
+            auto itThread = mapThreadLayouts.find(strSchema);
+            if(itThread != mapThreadLayouts.end())
+                return itThread->second;
+
+            std::shared_ptr<const ObjectLayout> pLayout;
+            {
+                LOCK(LAYOUT_MUTEX);
+
+                auto it = mapLayouts.find(strSchema);
+                if(it == mapLayouts.end())
+                    return pLayout;
+
+                pLayout = it->second;
+            }
+
+            /* Keep it for this thread's next lookup. */
+            mapThreadLayouts.emplace(strSchema, pLayout);
+
+            return pLayout;
+        }
+
+
+        /* Add a layout for a schema. */
+        std::shared_ptr<const ObjectLayout> ObjectLayout::Intern(const std::string& strSchema,
+                                                                 const std::shared_ptr<const ObjectLayout>& pLayout)
+        {
+            LOCK(LAYOUT_MUTEX);
+
+            /* Use the existing layout if there is one. */
+            auto it = mapLayouts.find(strSchema);
+            if(it != mapLayouts.end())
+                return it->second;
+
+            /* Don't let arbitrary schemas grow the table without bound. */
+            if(mapLayouts.size() < MAX_LAYOUTS)
+                mapLayouts.emplace(strSchema, pLayout);
+
+            return pLayout;
+        }
+    }
+}
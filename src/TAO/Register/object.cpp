@@ -30,7 +30,7 @@ namespace TAO
         Object::Object()
         : State     (uint8_t(REGISTER::OBJECT))
         , vchSystem (512, 0) //system memory by default is 512 bytes
-        , mapData   ()
+        , pLayout   ()
         {
         }
 
@@ -39,7 +39,7 @@ namespace TAO
         Object::Object(const Object& object)
         : State     (object)
         , vchSystem (object.vchSystem)
-        , mapData   (object.mapData)
+        , pLayout   (object.pLayout)
         {
         }
 
@@ -48,7 +48,7 @@ namespace TAO
         Object::Object(Object&& object) noexcept
         : State     (std::move(object))
         , vchSystem (std::move(object.vchSystem))
-        , mapData   (std::move(object.mapData))
+        , pLayout   (std::move(object.pLayout))
         {
         }
 
@@ -66,7 +66,7 @@ namespace TAO
             hashChecksum = object.hashChecksum;
 
             nReadPos     = 0; //don't copy over read position
-            mapData      = object.mapData;
+            pLayout      = object.pLayout;
 
             return *this;
         }
@@ -85,7 +85,7 @@ namespace TAO
             hashChecksum = std::move(object.hashChecksum);
 
             nReadPos     = 0; //don't copy over read position
-            mapData      = std::move(object.mapData);
+            pLayout      = std::move(object.pLayout);
 
             return *this;
         }
@@ -101,19 +101,33 @@ namespace TAO
         Object::Object(const State& state)
         : State     (state)
         , vchSystem ()
-        , mapData   ()
+        , pLayout   ()
         {
         }
 
 
         /* Get's the standard object type. */
         uint8_t Object::Standard() const
+        {
+            /* The standard type only depends on the layout so it is worked out when parsing. */
+            if(pLayout)
+                return pLayout->nStandard;
+
+            return standard();
+        }
+
+
+        /* Work out the standard object type from the data members. */
+        uint8_t Object::standard() const
         {
             /* Set the return value. */
             uint8_t nType = OBJECTS::NONSTANDARD;
 
+            /* Get the number of data members. */
+            const uint64_t nFields = (pLayout ? pLayout->vFields.size() : 0);
+
             /* Search object register for key types. */
-            if(mapData.size() == 1
+            if(nFields == 1
             && Check("namespace", TYPES::STRING, false))
             {
                 /* If it only contains one field called namespace then it must be a namespace */
@@ -121,7 +135,7 @@ namespace TAO
                 nType = OBJECTS::NAMESPACE;
 
             }
-            else if(mapData.size() == 9
+            else if(nFields == 9
             && Check("auth", TYPES::UINT256_T, true)
             && Check("lisp", TYPES::UINT256_T, true)
             && Check("network", TYPES::UINT256_T, true)
@@ -135,7 +149,7 @@ namespace TAO
                 /* Set the return value. */
                 nType = OBJECTS::CRYPTO;
             }
-            else if(mapData.size() == 3
+            else if(nFields == 3
             && Check("namespace", TYPES::STRING, false)
             && Check("name", TYPES::STRING, false)
             && CheckName("address")) /* Name registers can store different types in the address so don't check the field type */
@@ -195,8 +209,8 @@ namespace TAO
         /* Get the cost to create this object register.*/
         uint64_t Object::Cost() const
         {
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
                 throw debug::exception(FUNCTION, "cannot get cost when object isn't parsed");
 
             /* Switch based on standard types. */
@@ -264,8 +278,8 @@ namespace TAO
         /* Parses out the data members of an object register. */
         bool Object::Parse()
         {
-            /* Check the map for empty. */
-            if(!mapData.empty())
+            /* Check the layout for empty. */
+            if(pLayout)
                 return debug::error(FUNCTION, "object is already parsed");
 
             /* Ensure that object register is of proper type. */
@@ -273,19 +287,39 @@ namespace TAO
             && this->nType != REGISTER::SYSTEM)
                 return false;
 
+            /* The raw field headers make up the schema, fields are recorded without copying their names. */
+            struct Span
+            {
+                uint64_t nName;
+                uint64_t nLength;
+                uint16_t nPosition;
+                bool fMutable;
+            };
+
+            static thread_local std::string strSchema;
+            static thread_local std::vector<Span> vSpans;
+
+            strSchema.clear();
+            vSpans.clear();
+
+            /* Only objects of fixed size fields have positions determined by their schema. */
+            bool fFixed = true;
+
             /* Reset the read position. */
             nReadPos   = 0;
 
             /* Read until end of state. */
             while(!end())
             {
-                /* Deserialize the named value. */
-                std::string name;
-                *this >> name;
+                /* Deserialize the name size and skip over the name. */
+                const uint64_t nStart  = nReadPos;
+                const uint64_t nLength = ReadCompactSize(*this);
+                const uint64_t nName   = nReadPos;
 
-                /* Disallow duplicate value entries. */
-                if(mapData.count(name))
-                    return debug::error(FUNCTION, "duplicate value entries");
+                if(nReadPos + nLength > vchState.size())
+                    throw std::runtime_error(debug::safe_printstr(FUNCTION, "reached end of stream ", nReadPos));
+
+                nReadPos += nLength;
 
                 /* Deserialize the type. */
                 uint8_t nType;
@@ -304,109 +338,54 @@ namespace TAO
                     *this >> nType;
                 }
 
+                /* Track the binary position of type. */
+                strSchema.append(reinterpret_cast<const char*>(&vchState[nStart]), nReadPos - nStart);
+                vSpans.push_back({nName, nLength, uint16_t(nReadPos - 1), fMutable});
+
                 /* Switch between supported types. */
                 switch(nType)
                 {
-
                     /* Standard type for C++ uint8_t. */
                     case TYPES::UINT8_T:
-                    {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate the types size plus type byte. */
-                        nReadPos += 2;
-
+                        nReadPos += 1;
                         break;
-                    }
-
 
                     /* Standard type for C++ uint16_t. */
                     case TYPES::UINT16_T:
-                    {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate the types size plus type byte. */
-                        nReadPos += 3;
-
+                        nReadPos += 2;
                         break;
-                    }
-
 
                     /* Standard type for C++ uint32_t. */
                     case TYPES::UINT32_T:
-                    {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate the types size plus type byte. */
-                        nReadPos += 5;
-
+                        nReadPos += 4;
                         break;
-                    }
-
 
                     /* Standard type for C++ uint64_t. */
                     case TYPES::UINT64_T:
-                    {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate the types size plus type byte. */
-                        nReadPos += 9;
-
+                        nReadPos += 8;
                         break;
-                    }
-
 
                     /* Standard type for Custom uint256_t */
                     case TYPES::UINT256_T:
-                    {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate the types size plus type byte. */
-                        nReadPos += 33;
-
+                        nReadPos += 32;
                         break;
-                    }
-
 
                     /* Standard type for Custom uint512_t */
                     case TYPES::UINT512_T:
-                    {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate the types size plus type byte. */
-                        nReadPos += 65;
-
+                        nReadPos += 64;
                         break;
-                    }
-
 
                     /* Standard type for Custom uint1024_t */
                     case TYPES::UINT1024_T:
-                    {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate the types size plus type byte. */
-                        nReadPos += 129;
-
+                        nReadPos += 128;
                         break;
-                    }
-
 
-                    /* Standard type for STL string */
+                    /* Standard types for STL string and STL vector with C++ type uint8_t */
                     case TYPES::STRING:
+                    case TYPES::BYTES:
                     {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate to start of size. */
-                        ++nReadPos;
+                        /* Variable sizes shift the positions of the fields after them. */
+                        fFixed = false;
 
                         /* Find the serialized size of type. */
                         uint64_t nSize = ReadCompactSize(*this);
@@ -417,31 +396,58 @@ namespace TAO
                         break;
                     }
 
+                    /* Fail if types are unknown. */
+                    default:
+                        return debug::error(FUNCTION, "malformed object register (unexpected type ", uint32_t(nType), ")");
+                }
+            }
 
-                    /* Standard type for STL vector with C++ type uint8_t */
-                    case TYPES::BYTES:
-                    {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
+            /* Objects without data members stay unparsed. */
+            if(vSpans.empty())
+                return true;
 
-                        /* Iterate to start of size. */
-                        ++nReadPos;
+            /* Use the interned layout for this schema. */
+            if(fFixed)
+            {
+                pLayout = ObjectLayout::Get(strSchema);
+                if(pLayout)
+                    return true;
+            }
 
-                        /* Find the serialized size of type. */
-                        uint64_t nSize = ReadCompactSize(*this);
+            /* Build a new layout. */
+            std::shared_ptr<ObjectLayout> pBuild = std::make_shared<ObjectLayout>();
+            pBuild->vFields.reserve(vSpans.size());
+            for(const auto& span : vSpans)
+            {
+                pBuild->vFields.push_back
+                ({
+                    std::string(reinterpret_cast<const char*>(&vchState[span.nName]), span.nLength),
+                    span.nPosition,
+                    span.fMutable
+                });
+            }
 
-                        /* Iterate the type size */
-                        nReadPos += nSize;
+            /* Sort by name for lookups. */
+            std::sort(pBuild->vFields.begin(), pBuild->vFields.end(),
+                [](const ObjectField& a, const ObjectField& b)
+                {
+                    return a.strName < b.strName;
+                });
 
-                        break;
-                    }
+            /* Disallow duplicate value entries. */
+            for(uint32_t n = 1; n < pBuild->vFields.size(); ++n)
+            {
+                if(pBuild->vFields[n - 1].strName == pBuild->vFields[n].strName)
+                    return debug::error(FUNCTION, "duplicate value entries");
+            }
 
+            /* Work out the standard type before the layout is shared. */
+            pLayout = pBuild;
+            pBuild->nStandard = standard();
 
-                    /* Fail if types are unknown. */
-                    default:
-                        return debug::error(FUNCTION, "malformed object register (unexpected type ", uint32_t(nType), ")");
-                }
-            }
+            /* Intern layouts of fixed size objects. */
+            if(fFixed)
+                pLayout = ObjectLayout::Intern(strSchema, pLayout);
 
             return true;
         }
@@ -453,13 +459,16 @@ namespace TAO
             /* Declare the vector of field names to return */
             std::vector<std::string> vFieldNames;
 
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
+            {
                 debug::error(FUNCTION, "object is not parsed");
+                return vFieldNames;
+            }
 
-            /* Iterate data map and pull field names out into return vector */
-            for(const auto& fieldName : mapData)
-                vFieldNames.push_back(fieldName.first);
+            /* Iterate the layout and pull field names out into return vector */
+            for(const auto& field : pLayout->vFields)
+                vFieldNames.push_back(field.strName);
 
             return vFieldNames;
         }
@@ -468,16 +477,17 @@ namespace TAO
         /* Get the type enumeration from the object register. */
         bool Object::Type(const std::string& strName, uint8_t& nType) const
         {
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
                 return debug::error(FUNCTION, "object is not parsed");
 
             /* Check that the name exists in the object. */
-            if(!mapData.count(strName))
+            const ObjectField* pField = pLayout->Find(strName);
+            if(!pField)
                 return false;
 
             /* Find the binary position of value. */
-            nReadPos = mapData[strName].first;
+            nReadPos = pField->nPosition;
 
             /* Deserialize the type specifier. */
             *this >> nType;
@@ -493,16 +503,17 @@ namespace TAO
         /* Check the type enumeration from the object register. */
         bool Object::Check(const std::string& strName, const uint8_t nType, bool fMutable) const
         {
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
                 return debug::error(FUNCTION, "object is not parsed");
 
             /* Check that the name exists in the object. */
-            if(!mapData.count(strName))
+            const ObjectField* pField = pLayout->Find(strName);
+            if(!pField)
                 return false;
 
             /* Find the binary position of value. */
-            nReadPos = mapData[strName].first;
+            nReadPos = pField->nPosition;
 
             /* Deserialize the type specifier. */
             uint8_t nCheck;
@@ -512,27 +523,40 @@ namespace TAO
             if(nType != nCheck)
                 return false;
 
-            return (fMutable == mapData[strName].second);
+            return (fMutable == pField->fMutable);
         }
 
 
         /* Check the name exists in the object register without checking type. */
         bool Object::CheckName(const std::string& strName) const
         {
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
                 return debug::error(FUNCTION, "object is not parsed");
 
             /* Check that the name exists in the object. */
-            return mapData.count(strName) > 0;
+            return pLayout->Find(strName) != nullptr;
+        }
+
+
+        /* Check if a field in the object register can be written. */
+        bool Object::Mutable(const std::string& strName) const
+        {
+            /* Check the layout for empty. */
+            if(!pLayout)
+                return debug::error(FUNCTION, "object is not parsed");
+
+            /* Check that the name exists and is mutable. */
+            const ObjectField* pField = pLayout->Find(strName);
+            return (pField && pField->fMutable);
         }
 
 
         /*  Get the size of value in object register. */
         uint64_t Object::Size(const std::string& strName) const
         {
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
                 return debug::error(FUNCTION, "object is not parsed");
 
             /* Get the type for given name. */
@@ -588,20 +612,21 @@ namespace TAO
         /* Write into the object register a value of type bytes. */
         bool Object::Write(const std::string& strName, const std::string& strValue)
         {
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
                 return debug::error(FUNCTION, "object is not parsed");
 
             /* Check that the name exists in the object. */
-            if(!mapData.count(strName))
+            const ObjectField* pField = pLayout->Find(strName);
+            if(!pField)
                 return false;
 
             /* Check that the value is mutable (writes allowed). */
-            if(!mapData[strName].second)
+            if(!pField->fMutable)
                 return debug::error(FUNCTION, "cannot set value for READONLY data member");
 
             /* Find the binary position of value. */
-            nReadPos = mapData[strName].first;
+            nReadPos = pField->nPosition;
 
             /* Deserialize the type specifier. */
             uint8_t nType;
@@ -630,20 +655,21 @@ namespace TAO
         /* Write into the object register a value of type bytes. */
         bool Object::Write(const std::string& strName, const std::vector<uint8_t>& vData)
         {
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
                 return debug::error(FUNCTION, "object is not parsed");
 
             /* Check that the name exists in the object. */
-            if(!mapData.count(strName))
+            const ObjectField* pField = pLayout->Find(strName);
+            if(!pField)
                 return false;
 
             /* Check that the value is mutable (writes allowed). */
-            if(!mapData[strName].second)
+            if(!pField->fMutable)
                 return debug::error(FUNCTION, "cannot set value for READONLY data member");
 
             /* Find the binary position of value. */
-            nReadPos = mapData[strName].first;
+            nReadPos = pField->nPosition;
 
             /* Deserialize the type specifier. */
             uint8_t nType;
@@ -21,11 +21,89 @@ ________________________________________________________________________________
 
 #include <Util/include/debug.h>
 
+#include <cstdint>
+#include <vector>
+
 namespace TAO
 {
 
     namespace Register
     {
+        /** RegisterMemory
+         *
+         *  The 64-bit register memory of a virtual machine. Memory up to the default VM size is held inline,
+         *  so creating a VM for every condition that is validated doesn't need a heap allocation.
+         *
+         **/
+        class RegisterMemory
+        {
+            /** Number of registers held inline. **/
+            static const uint32_t INLINE = 256;
+
+
+            /** Inline register memory. **/
+            uint64_t vInline[INLINE];
+
+
+            /** Heap register memory for larger sizes. **/
+            std::vector<uint64_t> vHeap;
+
+
+            /** Pointer to the memory in use. **/
+            uint64_t* pData;
+
+
+            /** The number of registers. **/
+            uint32_t nSize;
+
+        public:
+
+            /** Size Constructor, all registers start as zero. **/
+            RegisterMemory(const uint32_t nSizeIn);
+
+
+            /** Copy constructor. **/
+            RegisterMemory(const RegisterMemory& memory);
+
+
+            /** Copy assignment. **/
+            RegisterMemory& operator=(const RegisterMemory& memory);
+
+
+            /** operator[]
+             *
+             *  Access a register.
+             *
+             **/
+            uint64_t& operator[](const uint32_t n)
+            {
+                return pData[n];
+            }
+
+
+            /** operator[]
+             *
+             *  Access a register.
+             *
+             **/
+            const uint64_t& operator[](const uint32_t n) const
+            {
+                return pData[n];
+            }
+
+
+            /** size
+             *
+             *  Get the number of registers.
+             *
+             **/
+            uint32_t size() const
+            {
+                return nSize;
+            }
+        };
+
+
         /** BaseVM
          *
          *  A virtual machine that manages processing memory in 64-bit registers.
@@ -36,7 +114,7 @@ namespace TAO
         protected:
 
             /** The internal register memory. **/
-            std::vector<uint64_t> vRegister;
+            RegisterMemory vRegister;
 
 
             /** The internal memory pointer. */
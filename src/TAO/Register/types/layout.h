@@ -0,0 +1,117 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_TAO_REGISTER_TYPES_LAYOUT_H
+#define NEXUS_TAO_REGISTER_TYPES_LAYOUT_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Register Layer namespace. */
+    namespace Register
+    {
+
+        /** ObjectField
+         *
+         *  A data member of an object register and the binary position of its type byte.
+         *
+         **/
+        struct ObjectField
+        {
+            /** The name of the field. **/
+            std::string strName;
+
+
+            /** The binary position of the field's type in the state. **/
+            uint16_t nPosition;
+
+
+            /** Flag for fields that can be written. **/
+            bool fMutable;
+        };
+
+
+        /** ObjectLayout
+         *
+         *  Immutable table of an object register's fields sorted by name.
+         *
+         *  Objects whose fields are all fixed size have their positions fully determined by their schema (the field
+         *  names, types and mutability), so their layouts are interned and shared by every object of the same shape,
+         *  such as all token accounts or all trust accounts. Objects with strings or bytes get their own layout.
+         *
+         **/
+        class ObjectLayout
+        {
+        public:
+
+            /** The fields sorted by name. **/
+            std::vector<ObjectField> vFields;
+
+
+            /** The standard object type, worked out once per layout. **/
+            uint8_t nStandard;
+
+
+            /** Default Constructor. **/
+            ObjectLayout();
+
+
+            /** Find
+             *
+             *  Find a field by name.
+             *
+             *  @param[in] strName The name of the field.
+             *
+             *  @return Pointer to the field, or nullptr if not found.
+             *
+             **/
+            const ObjectField* Find(const std::string& strName) const;
+
+
+            /** Get
+             *
+             *  Get an interned layout by its schema. Layouts a thread has already found are kept
+             *  per thread, so repeat lookups don't take the lock of the interned layouts.
+             *
+             *  @param[in] strSchema The raw field headers of a fixed size object.
+             *
+             *  @return The layout, or an empty pointer if it isn't interned yet.
+             *
+             **/
+            static std::shared_ptr<const ObjectLayout> Get(const std::string& strSchema);
+
+
+            /** Intern
+             *
+             *  Add a layout for a schema, returning the layout already interned if another thread won the race.
+             *
+             *  @param[in] strSchema The raw field headers of a fixed size object.
+             *  @param[in] pLayout The layout built for this schema.
+             *
+             *  @return The interned layout.
+             *
+             **/
+            static std::shared_ptr<const ObjectLayout> Intern(const std::string& strSchema,
+                                                              const std::shared_ptr<const ObjectLayout>& pLayout);
+        };
+    }
+}
+
+#endif
@@ -15,6 +15,7 @@ ________________________________________________________________________________
 #ifndef NEXUS_TAO_REGISTER_INCLUDE_OBJECT_H
 #define NEXUS_TAO_REGISTER_INCLUDE_OBJECT_H
 
+#include <TAO/Register/types/layout.h>
 #include <TAO/Register/types/state.h>
 #include <TAO/Register/include/enum.h>
 
@@ -38,8 +39,8 @@ namespace TAO
 
         public:
 
-            /** Internal map for managing object data members and their binary positions. **/
-            mutable std::map< std::string, std::pair<uint16_t, bool> > mapData; //internal map for data members
+            /** Shared layout of the object data members and their binary positions, empty until parsed. **/
+            std::shared_ptr<const ObjectLayout> pLayout;
 
 
             /** Default constructor. **/
@@ -165,6 +166,18 @@ namespace TAO
             bool CheckName(const std::string& strName) const;
 
 
+            /** Mutable
+             *
+             *  Check if a field in the object register can be written.
+             *
+             *  @param[in] strName The name of the field to check
+             *
+             *  @return True if the field exists and is mutable.
+             *
+             **/
+            bool Mutable(const std::string& strName) const;
+
+
             /** Size
              *
              *  Get the size of value in object register.
@@ -190,16 +203,17 @@ namespace TAO
             template<typename Type>
             bool Read(const std::string& strName, Type& value) const
             {
-                /* Check the map for empty. */
-                if(mapData.empty())
+                /* Check the layout for empty. */
+                if(!pLayout)
                     return debug::error(FUNCTION, "object is not parsed");
 
                 /* Check that the name exists in the object. */
-                if(!mapData.count(strName))
+                const ObjectField* pField = pLayout->Find(strName);
+                if(!pField)
                     return false;
 
                 /* Find the binary position of value. */
-                nReadPos = mapData[strName].first;
+                nReadPos = pField->nPosition;
 
                 /* Deserialize the type specifier. */
                 uint8_t nType;
@@ -234,15 +248,16 @@ namespace TAO
             bool Write(const std::string& strName, const Type& value)
             {
                 /* Check that the name exists in the object. */
-                if(!mapData.count(strName))
+                const ObjectField* pField = (pLayout ? pLayout->Find(strName) : nullptr);
+                if(!pField)
                     return false;
 
                 /* Check that the value is mutable (writes allowed). */
-                if(!mapData[strName].second)
+                if(!pField->fMutable)
                     return debug::error(FUNCTION, "cannot set value for READONLY data member");
 
                 /* Find the binary position of value. */
-                nReadPos = mapData[strName].first;
+                nReadPos = pField->nPosition;
 
                 /* Deserialize the type specifier. */
                 uint8_t nType;
@@ -342,6 +357,14 @@ namespace TAO
 
         private:
 
+            /** standard
+             *
+             *  Work out the standard object type from the data members.
+             *
+             **/
+            uint8_t standard() const;
+
+
             /** type
              *
              *  Helper function that uses template deduction to find type enum.
@@ -45,7 +45,7 @@ namespace TAO
 
         /* Verify the pre-states of a register to current network state. */
         bool Verify(const TAO::Operation::Contract& contract,
-                    std::map<uint256_t, TAO::Register::State>& mapStates, const uint8_t nFlags)
+                    StateMap& mapStates, const uint8_t nFlags)
         {
             /* Reset the contract streams. */
             contract.Reset();
@@ -0,0 +1,157 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#include <Util/include/arena.h>
+
+#include <memory>
+
+
+/* The arena of the calling thread, used by every scope on it. */
+static thread_local std::unique_ptr<Arena> pThreadArena;
+
+/* The arena current on the calling thread, null outside of a scope. */
+static thread_local Arena* pCurrent = nullptr;
+
+/* The number of scopes open on the calling thread. */
+static thread_local uint32_t nDepth = 0;
+
+
+/* Definitions of the size constants. */
+const uint64_t Arena::CHUNK_SIZE;
+const uint64_t Arena::LARGE_SIZE;
+const uint32_t Arena::RETAIN_CHUNKS;
+
+
+/* Default Constructor. */
+Arena::Arena()
+: vChunks ( )
+, vLarge  ( )
+, nChunk  (0)
+, nOffset (0)
+, nUsed   (0)
+{
+}
+
+
+/* Default Destructor. */
+Arena::~Arena()
+{
+    for(const auto& chunk : vChunks)
+        delete[] chunk.pData;
+
+    for(const auto& pData : vLarge)
+        delete[] pData;
+}
+
+
+/* Allocate memory that stays valid until the arena is reset. */
+void* Arena::Allocate(const uint64_t nSize, const uint64_t nAlign)
+{
+    nUsed += nSize;
+
+    /* Large allocations would waste most of a chunk. */
+    if(nSize > LARGE_SIZE)
+    {
+        vLarge.push_back(new uint8_t[nSize]);
+        return vLarge.back();
+    }
+
+    /* Bump the offset in the current chunk, moving to the next when it is full. */
+    while(nChunk < vChunks.size())
+    {
+        const uint64_t nStart = (nOffset + nAlign - 1) & ~(nAlign - 1);
+        if(nStart + nSize <= vChunks[nChunk].nSize)
+        {
+            nOffset = nStart + nSize;
+            return vChunks[nChunk].pData + nStart;
+        }
+
+        ++nChunk;
+        nOffset = 0;
+    }
+
+    /* Add a chunk when every chunk is full. */
+    Chunk chunk;
+    chunk.pData = new uint8_t[CHUNK_SIZE];
+    chunk.nSize = CHUNK_SIZE;
+    vChunks.push_back(chunk);
+
+    nOffset = nSize;
+    return chunk.pData;
+}
+
+
+/* Release everything allocated, keeping some chunks for reuse. */
+void Arena::Reset()
+{
+    for(uint32_t n = RETAIN_CHUNKS; n < vChunks.size(); ++n)
+        delete[] vChunks[n].pData;
+
+    if(vChunks.size() > RETAIN_CHUNKS)
+        vChunks.resize(RETAIN_CHUNKS);
+
+    for(const auto& pData : vLarge)
+        delete[] pData;
+    vLarge.clear();
+
+    nChunk  = 0;
+    nOffset = 0;
+    nUsed   = 0;
+}
+
+
+/* Get the number of bytes handed out since the last reset. */
+uint64_t Arena::Used() const
+{
+    return nUsed;
+}
+
+
+/* Get the number of bytes held in chunks. */
+uint64_t Arena::Reserved() const
+{
+    return vChunks.size() * CHUNK_SIZE;
+}
+
+
+/* Get the arena of the calling thread's innermost scope. */
+Arena* Arena::Current()
+{
+    return pCurrent;
+}
+
+
+/* Make the calling thread's arena current. */
+ArenaScope::ArenaScope()
+{
+    if(nDepth++ > 0)
+        return;
+
+    /* Threads that never open a scope don't pay for an arena. */
+    if(!pThreadArena)
+        pThreadArena.reset(new Arena());
+
+    pCurrent = pThreadArena.get();
+}
+
+
+/* Reset the arena when the outermost scope ends. */
+ArenaScope::~ArenaScope()
+{
+    if(--nDepth > 0)
+        return;
+
+    pCurrent = nullptr;
+    pThreadArena->Reset();
+}
@@ -17,13 +17,22 @@ ________________________________________________________________________________
 #include <Util/include/config.h>
 #include <Util/include/convert.h>
 #include <Util/include/filesystem.h>
+#include <Util/include/metrics.h>
 #include <Util/include/mutex.h>
 #include <Util/include/runtime.h>
 #include <Util/include/version.h>
 
+#include <Util/templates/ringbuffer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdarg>
 #include <cstdio>
+#include <ctime>
 #include <map>
+#include <memory>
+#include <thread>
 #include <vector>
 
 #include <iostream>
@@ -69,6 +78,220 @@ namespace debug
     uint32_t nLogSizeMB;
 
 
+    /* A log line waiting for the log writer. */
+    struct LogLine
+    {
+        /* The order the line was logged in across all threads. */
+        uint64_t nSequence;
+
+        /* The time the line was logged in milliseconds. */
+        uint64_t nTimestamp;
+
+        /* The formatted line without its timestamp. */
+        std::string strLine;
+    };
+
+
+    /* The lines a thread has queued for the log writer. */
+    struct LogBuffer
+    {
+        /* The queued lines, pushed by the owning thread and popped by the log writer. */
+        RingBuffer<LogLine> ring;
+
+        /* The lines dropped since the log writer last checked. */
+        std::atomic<uint64_t> nDropped;
+
+        LogBuffer(const uint32_t nCapacity)
+        : ring     (nCapacity)
+        , nDropped (0)
+        {
+        }
+    };
+
+
+    /* Mutex to protect the list of log buffers. */
+    static std::mutex BUFFERS_MUTEX;
+
+    /* The log buffers of every thread that has logged. */
+    static std::vector<std::shared_ptr<LogBuffer>> vBuffers;
+
+    /* The calling thread's log buffer, created when it first logs. */
+    static thread_local std::shared_ptr<LogBuffer> pThreadBuffer;
+
+    /* The number of lines each thread can queue before lines are dropped. */
+    static uint32_t nLogBuffer = 4096;
+
+    /* Flag to tell if lines are being queued for the log writer. */
+    static std::atomic<bool> fLogWriter(false);
+
+    /* Flag to tell the log writer to stop. */
+    static std::atomic<bool> fLogStop(false);
+
+    /* The total number of lines dropped. */
+    static std::atomic<uint64_t> nLogDropped(0);
+
+    /* The order of the next line logged. */
+    static std::atomic<uint64_t> nLogSequence(0);
+
+    /* The log writer thread and the condition to wake it with. */
+    static std::thread LOG_THREAD;
+    static std::mutex WRITER_MUTEX;
+    static std::condition_variable WRITER_CONDITION;
+
+
+    /* Add a timestamped line to the end of a batch. */
+    static void append_line(std::string &strBatch, const uint64_t nTimestamp, const std::string& strLine)
+    {
+        /* Build the timestamp, localtime is protected by DEBUG_MUTEX. */
+        time_t nTime = static_cast<time_t>(nTimestamp / 1000);
+
+        char chTime[32];
+        if(std::strftime(chTime, sizeof(chTime), "%H:%M:%S", std::localtime(&nTime)) == 0)
+            chTime[0] = 0;
+
+        char chMillis[8];
+        std::snprintf(chMillis, sizeof(chMillis), ".%03u] ", static_cast<uint32_t>(nTimestamp % 1000));
+
+        strBatch += "[";
+        strBatch += chTime;
+        strBatch += chMillis;
+        strBatch += strLine;
+        strBatch += "\n";
+    }
+
+
+    /* Write a batch to the console and debug file. Requires DEBUG_MUTEX. */
+    static void write_batch(const std::string& strBatch)
+    {
+        /* Dump it to the console. */
+        std::cout << strBatch << std::flush;
+
+        /* Write it to the debug file. */
+        ssFile << strBatch << std::flush;
+
+        /* Check if the current file should be archived and take action. */
+        check_log_archive(ssFile);
+    }
+
+
+    /* Get the calling thread's log buffer. */
+    static LogBuffer* thread_buffer()
+    {
+        if(!pThreadBuffer)
+        {
+            pThreadBuffer = std::make_shared<LogBuffer>(nLogBuffer);
+
+            LOCK(BUFFERS_MUTEX);
+            vBuffers.push_back(pThreadBuffer);
+        }
+
+        return pThreadBuffer.get();
+    }
+
+
+    /* Write out the lines queued on every thread's log buffer. Only called from one thread at a time. */
+    static void write_buffers(std::vector<LogLine> &vLines)
+    {
+        /* Get the buffers, forgetting those of threads that have exited once they are empty. */
+        std::vector<std::shared_ptr<LogBuffer>> vSnapshot;
+        {
+            LOCK(BUFFERS_MUTEX);
+
+            vBuffers.erase(std::remove_if(vBuffers.begin(), vBuffers.end(),
+                [](const std::shared_ptr<LogBuffer>& pBuffer)
+                {
+                    return pBuffer.use_count() == 1 && pBuffer->ring.Size() == 0;
+                }), vBuffers.end());
+
+            vSnapshot = vBuffers;
+        }
+
+        /* Take what is queued now, so a busy thread can't keep the writer here. */
+        uint64_t nDropped = 0;
+        for(const auto& pBuffer : vSnapshot)
+        {
+            nDropped += pBuffer->nDropped.exchange(0);
+
+            LogLine line;
+            for(uint64_t nSize = pBuffer->ring.Size(); nSize > 0 && pBuffer->ring.Pop(line); --nSize)
+                vLines.push_back(std::move(line));
+        }
+
+        if(vLines.empty() && nDropped == 0)
+            return;
+
+        /* Put the lines from different threads back in the order they were logged. */
+        std::sort(vLines.begin(), vLines.end(),
+            [](const LogLine& a, const LogLine& b)
+            {
+                return a.nSequence < b.nSequence;
+            });
+
+        {
+            LOCK(DEBUG_MUTEX);
+
+            std::string strBatch;
+            for(const auto& line : vLines)
+                append_line(strBatch, line.nTimestamp, line.strLine);
+
+            if(nDropped > 0)
+                append_line(strBatch, runtime::timestamp(true),
+                    safe_printstr(ANSI_COLOR_BRIGHT_YELLOW, "LOG: ", ANSI_COLOR_RESET, "dropped ", nDropped, " lines, log buffers full"));
+
+            write_batch(strBatch);
+        }
+
+        vLines.clear();
+    }
+
+
+    /* Write out queued lines in the background until stopped. */
+    static void log_writer()
+    {
+        std::vector<LogLine> vLines;
+        while(!fLogStop.load())
+        {
+            {
+                std::unique_lock<std::mutex> lock(WRITER_MUTEX);
+                WRITER_CONDITION.wait_for(lock, std::chrono::milliseconds(10), []{ return fLogStop.load(); });
+            }
+
+            write_buffers(vLines);
+        }
+
+        /* Write out whatever is left. */
+        write_buffers(vLines);
+    }
+
+
+    /* Stop the log writer if it is running, writing out everything queued. */
+    static void stop_writer()
+    {
+        /* Stop queueing lines and let the log writer write out the rest. */
+        if(!fLogWriter.exchange(false))
+            return;
+
+        fLogStop.store(true);
+        WRITER_CONDITION.notify_all();
+
+        LOG_THREAD.join();
+
+        /* Catch lines queued while the writer was stopping. */
+        std::vector<LogLine> vLines;
+        write_buffers(vLines);
+    }
+
+
+    /* Stops the log writer on exit paths that skip Shutdown, as a running thread can't be destroyed. */
+    static struct LogWriterGuard
+    {
+        ~LogWriterGuard()
+        {
+            stop_writer();
+        }
+    } LOG_WRITER_GUARD;
+
+
     /* Write startup information into the log file */
     void Initialize()
     {
@@ -93,12 +316,28 @@ namespace debug
         /* Get the debug logging configuration parameters (or default if none specified) */
         nLogFiles  = config::GetArg("-logfiles", 20);
         nLogSizeMB = config::GetArg("-logsizeMB", 5);
+        nLogBuffer = std::max(int64_t(16), config::GetArg("-logbuffer", 4096));
+
+        /* Export the dropped line count to the metrics registry. */
+        metrics::AddGauge("nexus_log_dropped_total", "Log lines dropped because a log buffer was full.", "",
+            []{ return static_cast<double>(LogDropped()); }, true);
+
+        /* Start the log writer so logging threads don't wait on the console and disk. */
+        if(config::GetBoolArg("-logasync", true) && !fLogWriter.load())
+        {
+            fLogStop.store(false);
+            LOG_THREAD = std::thread(log_writer);
+
+            fLogWriter.store(true);
+        }
     }
 
 
-    /*  Close the debug log file. */
+    /*  Stop the log writer and close the debug log file. */
     void Shutdown()
     {
+        stop_writer();
+
         LOCK(DEBUG_MUTEX);
 
         if(ssFile.is_open())
@@ -106,6 +345,13 @@ namespace debug
     }
 
 
+    /* Get the number of log lines dropped because a thread's log buffer was full. */
+    uint64_t LogDropped()
+    {
+        return nLogDropped.load();
+    }
+
+
     /*  Log startup information. */
     void LogStartup(int argc, char** argv)
     {
@@ -228,31 +474,50 @@ namespace debug
 
 
     /*  Writes log output to console and debug file with timestamps.
-     *  Encapsulated log for improved compile time. Not thread safe. */
-    void log_(time_t &timestamp, std::string &debug_str)
+     *  Encapsulated log for improved compile time. */
+    void log_(uint32_t nLevel, std::string &debug_str)
     {
-        /* Build the timestamp */
-        std::string time_str = safe_printstr(
-            "[",
-            std::put_time(std::localtime(&timestamp), "%H:%M:%S"),
-            ".",
-            std::setfill('0'),
-            std::setw(3),
-            (runtime::timestamp(true) % 1000),
-            "] ");
-
-        /* Get the final timestamped debug string. */
-        std::string final_str = time_str + debug_str;
+        /* Get the timestamp. */
+        const uint64_t nTimestamp = runtime::timestamp(true);
 
-        /* Dump it to the console. */
-        std::cout << final_str << std::endl;
+        /* Queue the line for the log writer. */
+        if(fLogWriter.load())
+        {
+            LogBuffer* pBuffer = thread_buffer();
 
-        /* Write it to the debug file. */
-        ssFile << final_str << std::endl;
+            LogLine line;
+            line.nSequence  = nLogSequence++;
+            line.nTimestamp = nTimestamp;
+            line.strLine    = std::move(debug_str);
 
-        /* Check if the current file should be archived and take action. */
-        check_log_archive(ssFile);
+            if(pBuffer->ring.Push(std::move(line)))
+            {
+                /* Wake the writer early when a buffer is filling up. */
+                if(pBuffer->ring.Size() == pBuffer->ring.Capacity() / 2)
+                    WRITER_CONDITION.notify_one();
+
+                return;
+            }
+
+            /* Drop verbose lines rather than wait, but always write level 0 lines as they include errors. */
+            if(nLevel > 0)
+            {
+                ++pBuffer->nDropped;
+                ++nLogDropped;
+
+                return;
+            }
+
+            debug_str = std::move(line.strLine);
+        }
+
+        /* Write straight away. */
+        LOCK(DEBUG_MUTEX);
+
+        std::string strBatch;
+        append_line(strBatch, nTimestamp, debug_str);
 
+        write_batch(strBatch);
     }
 
 
@@ -0,0 +1,266 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#pragma once
+#ifndef NEXUS_UTIL_INCLUDE_ARENA_H
+#define NEXUS_UTIL_INCLUDE_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+
+/** Arena
+ *
+ *  Monotonic allocator for the short lived temporaries of one unit of work, such as connecting a block or
+ *  answering an API request. Allocation bumps an offset in a chunk, freeing is a no-op, and everything is
+ *  released at once when the work is done, keeping the first chunks for the next unit of work.
+ *
+ *  An arena belongs to one thread and is not thread safe. Memory must not be used after the arena is reset.
+ *
+ **/
+class Arena
+{
+    /** Chunk of memory allocated from. **/
+    struct Chunk
+    {
+        /** The start of the chunk. **/
+        uint8_t* pData;
+
+
+        /** The size of the chunk in bytes. **/
+        uint64_t nSize;
+    };
+
+
+    /** The chunks bump allocated from, each CHUNK_SIZE bytes. **/
+    std::vector<Chunk> vChunks;
+
+
+    /** The allocations too large for a chunk, freed on reset. **/
+    std::vector<uint8_t*> vLarge;
+
+
+    /** The chunk being allocated from. **/
+    uint32_t nChunk;
+
+
+    /** The offset of the next allocation in the current chunk. **/
+    uint64_t nOffset;
+
+
+    /** The number of bytes handed out since the last reset. **/
+    uint64_t nUsed;
+
+
+public:
+
+    /** The size of each chunk in bytes. **/
+    static const uint64_t CHUNK_SIZE = 64 * 1024;
+
+
+    /** Allocations above this size get memory of their own. **/
+    static const uint64_t LARGE_SIZE = CHUNK_SIZE / 4;
+
+
+    /** The number of chunks kept when the arena is reset. **/
+    static const uint32_t RETAIN_CHUNKS = 16;
+
+
+    /** Default Constructor. **/
+    Arena();
+
+
+    /** Copy Constructor. **/
+    Arena(const Arena& arena)            = delete;
+
+
+    /** Copy assignment. **/
+    Arena& operator=(const Arena& arena) = delete;
+
+
+    /** Default Destructor. **/
+    ~Arena();
+
+
+    /** Allocate
+     *
+     *  Allocate memory that stays valid until the arena is reset.
+     *
+     *  @param[in] nSize The number of bytes to allocate.
+     *  @param[in] nAlign The alignment, a power of two no larger than alignof(std::max_align_t).
+     *
+     *  @return A pointer to the memory.
+     *
+     **/
+    void* Allocate(const uint64_t nSize, const uint64_t nAlign = alignof(std::max_align_t));
+
+
+    /** Reset
+     *
+     *  Release everything allocated, keeping up to RETAIN_CHUNKS chunks for reuse.
+     *
+     **/
+    void Reset();
+
+
+    /** Used
+     *
+     *  @return The number of bytes handed out since the last reset.
+     *
+     **/
+    uint64_t Used() const;
+
+
+    /** Reserved
+     *
+     *  @return The number of bytes held in chunks, not counting large allocations.
+     *
+     **/
+    uint64_t Reserved() const;
+
+
+    /** Current
+     *
+     *  Get the arena of the calling thread's innermost ArenaScope.
+     *
+     *  @return The arena, or null if the thread is not inside a scope.
+     *
+     **/
+    static Arena* Current();
+};
+
+
+/** ArenaScope
+ *
+ *  Makes the calling thread's arena current for the life of the scope. Scopes nest, and only the outermost
+ *  scope resets the arena when it ends, so a block connected inside an API request is released with the request.
+ *
+ **/
+class ArenaScope
+{
+public:
+
+    /** Default Constructor. **/
+    ArenaScope();
+
+
+    /** Copy Constructor. **/
+    ArenaScope(const ArenaScope& scope)            = delete;
+
+
+    /** Copy assignment. **/
+    ArenaScope& operator=(const ArenaScope& scope) = delete;
+
+
+    /** Default Destructor. **/
+    ~ArenaScope();
+};
+
+
+/** ArenaAllocator
+ *
+ *  Standard allocator that takes memory from the arena current when it was constructed, or from the heap when
+ *  there was none. Containers using it must be destroyed before the scope that was current ends, and only
+ *  used on the thread that created them.
+ *
+ **/
+template<typename Type>
+class ArenaAllocator
+{
+    template<typename Other>
+    friend class ArenaAllocator;
+
+    /** The arena to allocate from, null for the heap. **/
+    Arena* pArena;
+
+public:
+
+    typedef Type value_type;
+
+    static_assert(alignof(Type) <= alignof(std::max_align_t), "arena can't align type");
+
+
+    /** Default Constructor. **/
+    ArenaAllocator()
+    : pArena (Arena::Current())
+    {
+    }
+
+
+    /** Rebind Constructor. **/
+    template<typename Other>
+    ArenaAllocator(const ArenaAllocator<Other>& allocator)
+    : pArena (allocator.pArena)
+    {
+    }
+
+
+    /** Rebind structure. **/
+    template<typename Other>
+    struct rebind
+    {
+        typedef ArenaAllocator<Other> other;
+    };
+
+
+    /** allocate
+     *
+     *  Allocate memory for a number of objects.
+     *
+     *  @param[in] nCount The number of objects.
+     *
+     **/
+    Type* allocate(const std::size_t nCount)
+    {
+        if(pArena)
+            return static_cast<Type*>(pArena->Allocate(nCount * sizeof(Type), alignof(Type)));
+
+        return static_cast<Type*>(::operator new(nCount * sizeof(Type)));
+    }
+
+
+    /** deallocate
+     *
+     *  Free memory from the heap, arena memory is freed when the arena is reset.
+     *
+     *  @param[in] pData The memory to free.
+     *  @param[in] nCount The number of objects.
+     *
+     **/
+    void deallocate(Type* pData, const std::size_t nCount)
+    {
+        if(!pArena)
+            ::operator delete(pData);
+    }
+
+
+    /** Relational operator equals. **/
+    template<typename Other>
+    bool operator==(const ArenaAllocator<Other>& allocator) const
+    {
+        return pArena == allocator.pArena;
+    }
+
+
+    /** Relational operator not equals. **/
+    template<typename Other>
+    bool operator!=(const ArenaAllocator<Other>& allocator) const
+    {
+        return pArena != allocator.pArena;
+    }
+};
+
+#endif
@@ -108,12 +108,20 @@ namespace debug
 
     /** Shutdown
      *
-     *  Close the debug log file.
+     *  Stop the log writer, write out anything still queued and close the debug log file.
      *
      **/
     void Shutdown();
 
 
+    /** LogDropped
+     *
+     *  Get the number of log lines dropped because a thread's log buffer was full.
+     *
+     **/
+    uint64_t LogDropped();
+
+
     /** LogStartup
      *
      *  Log startup information.
@@ -180,10 +188,16 @@ namespace debug
     /** log_
      *
      *  Writes log output to console and debug file with timestamps.
-     *  Encapsulated log for improved compile time. Not thread safe.
+     *  Encapsulated log for improved compile time.
+     *
+     *  While the log writer is running the line is queued on the calling thread's log buffer and written in
+     *  the background, otherwise it is written straight away. Thread safe.
+     *
+     *  @param[in] nLevel The log level being written, lines above 0 are dropped if the buffer is full.
+     *  @param[in] debug_str The log line, moved from.
      *
      **/
-     void log_(time_t &timestamp, std::string &debug_str);
+     void log_(uint32_t nLevel, std::string &debug_str);
 
 
     /** log
@@ -198,20 +212,14 @@ namespace debug
     template<class... Args>
     void log(uint32_t nLevel, Args&&... args)
     {
-        /* Don't write if log level is below set level. */
+        /* Don't format anything if log level is below set level. */
         if(config::nVerbose < nLevel)
             return;
 
-        /* Lock the mutex. */
-        LOCK(DEBUG_MUTEX);
-
-        /* Get the debug string and log file. */
+        /* Get the debug string. */
         std::string debug = safe_printstr(args...);
 
-        /* Get the timestamp. */
-        time_t timestamp = std::time(nullptr);
-
-        log_(timestamp, debug);
+        log_(nLevel, debug);
     }
 
 
@@ -0,0 +1,329 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_UTIL_INCLUDE_METRICS_H
+#define NEXUS_UTIL_INCLUDE_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+
+/** Metrics
+ *
+ *  Registry of counters and latency histograms for the hot paths of the node, exported in the Prometheus
+ *  text format.
+ *
+ *  Metrics are looked up by name and labels once and the reference kept, as the registry takes a lock and
+ *  never frees a metric. Updates are relaxed atomic adds on a stripe picked by the calling thread, so threads
+ *  updating the same metric don't contend on one cache line.
+ *
+ **/
+namespace metrics
+{
+
+    /** The number of stripes each metric is split over. **/
+    const uint32_t STRIPES = 16;
+
+
+    /** The upper bounds of the histogram buckets in microseconds, the last bucket takes everything above. **/
+    const uint64_t BUCKETS[] = { 10, 50, 100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000, 5000000 };
+
+
+    /** The number of histogram buckets including the overflow bucket. **/
+    const uint32_t BUCKET_COUNT = sizeof(BUCKETS) / sizeof(BUCKETS[0]) + 1;
+
+
+    /** stripe
+     *
+     *  Get the stripe for the calling thread.
+     *
+     **/
+    uint32_t stripe();
+
+
+    /** Counter
+     *
+     *  Monotonic count of events.
+     *
+     **/
+    class Counter
+    {
+        /** Stripe of the counter, padded to a cache line. **/
+        struct Stripe
+        {
+            std::atomic<uint64_t> nValue;
+            uint8_t vPadding[56];
+        };
+
+
+        /** The stripes of the counter. **/
+        std::array<Stripe, STRIPES> vStripes;
+
+
+    public:
+
+        /** Default Constructor. **/
+        Counter();
+
+
+        /** Add
+         *
+         *  Add to the counter.
+         *
+         *  @param[in] nAmount The amount to add.
+         *
+         **/
+        void Add(const uint64_t nAmount = 1)
+        {
+            vStripes[stripe()].nValue.fetch_add(nAmount, std::memory_order_relaxed);
+        }
+
+
+        /** Value
+         *
+         *  @return The total of the counter.
+         *
+         **/
+        uint64_t Value() const;
+    };
+
+
+    /** Histogram
+     *
+     *  Distribution of latencies over fixed buckets, with their count and sum.
+     *
+     **/
+    class Histogram
+    {
+        /** Stripe of the histogram, padded to whole cache lines. **/
+        struct Stripe
+        {
+            /** The number of observations in each bucket. **/
+            std::atomic<uint64_t> vBuckets[BUCKET_COUNT];
+
+
+            /** The sum of all observations in microseconds. **/
+            std::atomic<uint64_t> nSum;
+
+
+            /** Padding to the end of the cache line. **/
+            uint8_t vPadding[64 - (sizeof(uint64_t) * (BUCKET_COUNT + 1)) % 64];
+        };
+
+
+        /** The stripes of the histogram. **/
+        std::array<Stripe, STRIPES> vStripes;
+
+
+    public:
+
+        /** Default Constructor. **/
+        Histogram();
+
+
+        /** Observe
+         *
+         *  Add an observation.
+         *
+         *  @param[in] nMicroseconds The latency observed.
+         *
+         **/
+        void Observe(const uint64_t nMicroseconds)
+        {
+            uint32_t nBucket = 0;
+            while(nBucket < BUCKET_COUNT - 1 && nMicroseconds > BUCKETS[nBucket])
+                ++nBucket;
+
+            Stripe& stats = vStripes[stripe()];
+            stats.vBuckets[nBucket].fetch_add(1, std::memory_order_relaxed);
+            stats.nSum.fetch_add(nMicroseconds, std::memory_order_relaxed);
+        }
+
+
+        /** Buckets
+         *
+         *  Get the number of observations in each bucket, not cumulative.
+         *
+         *  @param[out] vCounts The counts for each bucket.
+         *  @param[out] nSum The sum of all observations in microseconds.
+         *
+         **/
+        void Buckets(std::array<uint64_t, BUCKET_COUNT> &vCounts, uint64_t &nSum) const;
+
+
+        /** Count
+         *
+         *  @return The number of observations.
+         *
+         **/
+        uint64_t Count() const;
+    };
+
+
+    /** Timer
+     *
+     *  Adds the time between its construction and destruction to a histogram.
+     *
+     **/
+    class Timer
+    {
+        /** The histogram to add to. **/
+        Histogram& histogram;
+
+
+        /** The time the timer was started. **/
+        const std::chrono::steady_clock::time_point tStart;
+
+
+    public:
+
+        /** Histogram Constructor
+         *
+         *  @param[in] histogramIn The histogram to add the elapsed time to.
+         *
+         **/
+        Timer(Histogram& histogramIn)
+        : histogram (histogramIn)
+        , tStart    (std::chrono::steady_clock::now())
+        {
+        }
+
+
+        /** Default Destructor. **/
+        ~Timer()
+        {
+            histogram.Observe(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - tStart).count());
+        }
+    };
+
+
+    /** GetCounter
+     *
+     *  Get a counter from the registry, adding it if it doesn't exist.
+     *
+     *  @param[in] strName The metric name.
+     *  @param[in] strHelp The description of the metric.
+     *  @param[in] strLabels The labels as they appear between the braces, such as db="ledger".
+     *
+     *  @return The counter, valid for the life of the process.
+     *
+     **/
+    Counter& GetCounter(const std::string& strName, const std::string& strHelp, const std::string& strLabels = "");
+
+
+    /** GetHistogram
+     *
+     *  Get a latency histogram from the registry, adding it if it doesn't exist.
+     *
+     *  @param[in] strName The metric name, exported in seconds.
+     *  @param[in] strHelp The description of the metric.
+     *  @param[in] strLabels The labels as they appear between the braces.
+     *
+     *  @return The histogram, valid for the life of the process.
+     *
+     **/
+    Histogram& GetHistogram(const std::string& strName, const std::string& strHelp, const std::string& strLabels = "");
+
+
+    /** AddGauge
+     *
+     *  Add a value that is read when the metrics are exported, for statistics kept elsewhere.
+     *  Replaces any function already added with the same name and labels.
+     *
+     *  @param[in] strName The metric name.
+     *  @param[in] strHelp The description of the metric.
+     *  @param[in] strLabels The labels as they appear between the braces.
+     *  @param[in] fnValue The function to read the value with, called under the registry lock.
+     *  @param[in] fCounter Flag to export the value as a counter rather than a gauge.
+     *
+     **/
+    void AddGauge(const std::string& strName, const std::string& strHelp, const std::string& strLabels,
+                  const std::function<double()>& fnValue, const bool fCounter = false);
+
+
+    /** Prometheus
+     *
+     *  Get every metric in the Prometheus text exposition format.
+     *
+     **/
+    std::string Prometheus();
+
+
+    /** CounterIndex
+     *
+     *  Counters for a small set of codes, such as message types, that are added to the registry the first time
+     *  each code is seen. Codes past the end of the index share one counter labelled "other".
+     *
+     **/
+    class CounterIndex
+    {
+        /** The number of codes indexed. **/
+        static const uint32_t SIZE = 256;
+
+
+        /** The metric name. **/
+        const std::string strName;
+
+
+        /** The description of the metric. **/
+        const std::string strHelp;
+
+
+        /** The labels every counter has. **/
+        const std::string strLabels;
+
+
+        /** The name of the label holding the code. **/
+        const std::string strKey;
+
+
+        /** The counters by code, null until first seen. **/
+        std::array<std::atomic<Counter*>, SIZE> vCounters;
+
+
+        /** The counter for codes past the end of the index. **/
+        Counter& counterOther;
+
+
+    public:
+
+        /** Constructor
+         *
+         *  @param[in] strNameIn The metric name.
+         *  @param[in] strHelpIn The description of the metric.
+         *  @param[in] strLabelsIn The labels every counter has.
+         *  @param[in] strKeyIn The name of the label holding the code.
+         *
+         **/
+        CounterIndex(const std::string& strNameIn, const std::string& strHelpIn,
+                     const std::string& strLabelsIn, const std::string& strKeyIn);
+
+
+        /** Get
+         *
+         *  Get the counter for a code.
+         *
+         *  @param[in] nCode The code, exported in hex.
+         *
+         **/
+        Counter& Get(const uint32_t nCode);
+    };
+}
+
+#endif
@@ -0,0 +1,135 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_UTIL_INCLUDE_PARALLEL_H
+#define NEXUS_UTIL_INCLUDE_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/** ParallelSubmit
+ *
+ *  Queue copies of a task on the pooled worker threads, starting workers until there are at least as many
+ *  workers as copies. Workers are kept for the life of the process, so callers don't pay for creating and
+ *  joining threads on every parallel section.
+ *
+ *  @param[in] fnTask The task to run.
+ *  @param[in] nCopies The number of times to run the task, each on a worker.
+ *
+ **/
+void ParallelSubmit(const std::function<void()>& fnTask, const uint32_t nCopies);
+
+
+/** ParallelFor
+ *
+ *  Run a function for every index in [0, nTotal) over a number of threads.
+ *  Indexes are handed out dynamically so uneven work is balanced, and the calling thread takes part.
+ *  Returns once every index has been processed.
+ *
+ *  The helpers come from the pool behind ParallelSubmit. The calling thread never waits for a helper to
+ *  start, only for helpers that took an index to finish, so a busy pool or a nested call runs on the
+ *  calling thread rather than deadlocking.
+ *
+ *  @param[in] nTotal The number of indexes to process.
+ *  @param[in] nThreads The maximum number of threads to use, including the calling thread.
+ *  @param[in] fnWork The function to run, called with the index.
+ *
+ **/
+template<typename Function>
+void ParallelFor(const uint32_t nTotal, const uint32_t nThreads, const Function& fnWork)
+{
+    /* Don't use threads that would have nothing to do. */
+    const uint32_t nWorkers = std::min(nThreads, nTotal);
+    if(nWorkers <= 1)
+    {
+        for(uint32_t n = 0; n < nTotal; ++n)
+            fnWork(n);
+
+        return;
+    }
+
+    /* State shared with the helpers, which can start after this call has returned. */
+    struct State
+    {
+        /* The next index to hand out. */
+        std::atomic<uint32_t> nNext;
+
+        /* The number of helpers running. */
+        std::atomic<uint32_t> nActive;
+
+        /* Wakes the calling thread when the last helper finishes. */
+        std::mutex MUTEX;
+        std::condition_variable CONDITION;
+
+        State()
+        : nNext     (0)
+        , nActive   (0)
+        , MUTEX     ( )
+        , CONDITION ( )
+        {
+        }
+    };
+    const std::shared_ptr<State> pState = std::make_shared<State>();
+
+    /* A helper that starts late only sees indexes past the end, so it never touches fnWork. */
+    const Function* pWork = &fnWork;
+    ParallelSubmit([pState, pWork, nTotal]()
+    {
+        ++pState->nActive;
+        for(uint32_t n = pState->nNext++; n < nTotal; n = pState->nNext++)
+            (*pWork)(n);
+
+        if(--pState->nActive == 0)
+        {
+            std::unique_lock<std::mutex> lock(pState->MUTEX);
+            pState->CONDITION.notify_all();
+        }
+    }, nWorkers - 1);
+
+    /* Work on the calling thread too. */
+    for(uint32_t n = pState->nNext++; n < nTotal; n = pState->nNext++)
+        fnWork(n);
+
+    /* Wait for the helpers still working on an index. */
+    std::unique_lock<std::mutex> lock(pState->MUTEX);
+    pState->CONDITION.wait(lock, [&pState]() { return pState->nActive.load() == 0; });
+}
+
+
+/** ParallelThreads
+ *
+ *  Get the default number of worker threads for a configured value, where 0 means one per core.
+ *
+ *  @param[in] nConfigured The configured thread count.
+ *
+ *  @return The number of threads, always at least 1.
+ *
+ **/
+inline uint32_t ParallelThreads(const int64_t nConfigured)
+{
+    if(nConfigured > 0)
+        return static_cast<uint32_t>(nConfigured);
+
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+#endif
@@ -0,0 +1,152 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_UTIL_INCLUDE_TRACE_H
+#define NEXUS_UTIL_INCLUDE_TRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+
+/* Scoped timing spans kept in memory on every thread and dumped as Chrome trace events on demand. */
+namespace trace
+{
+
+    /** Flag to tell if spans are being recorded. **/
+    extern std::atomic<bool> fEnabled;
+
+
+    /** Initialize
+     *
+     *  Read the trace configuration and enable tracing if -trace is set.
+     *
+     **/
+    void Initialize();
+
+
+    /** Enable
+     *
+     *  Start or stop recording spans. Spans already open when tracing stops are still recorded.
+     *
+     *  @param[in] fEnable Flag to start recording.
+     *
+     **/
+    void Enable(const bool fEnable);
+
+
+    /** Dump
+     *
+     *  Get the spans that ended in a recent window in the Chrome trace event format, for chrome://tracing
+     *  or Perfetto.
+     *
+     *  @param[in] nSeconds The length of the window in seconds.
+     *
+     *  @return The trace events as JSON.
+     *
+     **/
+    std::string Dump(const uint64_t nSeconds);
+
+
+    /** Span
+     *
+     *  Times the scope it is declared in, as a child of the span open on the same thread when it started.
+     *  When tracing is disabled construction is a single relaxed atomic load.
+     *
+     **/
+    class Span
+    {
+        /** The name of the span, a string literal. **/
+        const char* pName;
+
+
+        /** The detail added to the name, such as an API method. **/
+        const std::string* pDetail;
+
+
+        /** The ID of the span, 0 if not being recorded. **/
+        uint64_t nID;
+
+
+        /** The ID of the span this span is inside of, 0 for none. **/
+        uint64_t nParent;
+
+
+        /** The time the span started in microseconds. **/
+        uint64_t nStart;
+
+
+        /** Start recording the span. **/
+        void start();
+
+
+        /** Finish recording the span. **/
+        void finish();
+
+
+    public:
+
+        /** Name Constructor
+         *
+         *  @param[in] pNameIn The name of the span, which must be a string literal.
+         *
+         **/
+        explicit Span(const char* pNameIn)
+        : pName   (pNameIn)
+        , pDetail (nullptr)
+        , nID     (0)
+        , nParent (0)
+        , nStart  (0)
+        {
+            if(fEnabled.load(std::memory_order_relaxed))
+                start();
+        }
+
+
+        /** Detail Constructor
+         *
+         *  @param[in] pNameIn The name of the span, which must be a string literal.
+         *  @param[in] strDetail The detail to add to the name, which must outlive the span.
+         *
+         **/
+        Span(const char* pNameIn, const std::string& strDetail)
+        : pName   (pNameIn)
+        , pDetail (&strDetail)
+        , nID     (0)
+        , nParent (0)
+        , nStart  (0)
+        {
+            if(fEnabled.load(std::memory_order_relaxed))
+                start();
+        }
+
+
+        /** Copy Constructor. **/
+        Span(const Span& span)            = delete;
+
+
+        /** Copy assignment. **/
+        Span& operator=(const Span& span) = delete;
+
+
+        /** Default Destructor. **/
+        ~Span()
+        {
+            if(nID != 0)
+                finish();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,331 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Util/include/metrics.h>
+#include <Util/include/mutex.h>
+
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <thread>
+
+namespace metrics
+{
+
+    /* A set of metrics of one type sharing a name, by their labels. */
+    template<typename MetricType>
+    struct Family
+    {
+        /* The description of the metrics. */
+        std::string strHelp;
+
+        /* The metrics by their labels. */
+        std::map<std::string, MetricType> mapMetrics;
+    };
+
+
+    /* A value read when the metrics are exported. */
+    struct Gauge
+    {
+        /* The function to read the value with. */
+        std::function<double()> fnValue;
+
+        /* Flag to export the value as a counter. */
+        bool fCounter;
+    };
+
+
+    /* The registered metrics. */
+    struct Registry
+    {
+        /* Mutex to protect the registry. */
+        std::mutex MUTEX;
+
+        /* The counters by name. */
+        std::map<std::string, Family<std::unique_ptr<Counter>>> mapCounters;
+
+        /* The histograms by name. */
+        std::map<std::string, Family<std::unique_ptr<Histogram>>> mapHistograms;
+
+        /* The gauges by name. */
+        std::map<std::string, Family<Gauge>> mapGauges;
+    };
+
+
+    /* Get the registry, created on first use so metrics can be added during static initialization. */
+    static Registry& registry()
+    {
+        static Registry* pRegistry = new Registry();
+
+        return *pRegistry;
+    }
+
+
+    /* Join two sets of labels. */
+    static std::string join(const std::string& strLabels, const std::string& strExtra)
+    {
+        if(strLabels.empty() || strExtra.empty())
+            return strLabels + strExtra;
+
+        return strLabels + "," + strExtra;
+    }
+
+
+    /* Get a metric name with its labels and an extra label. */
+    static std::string series(const std::string& strName, const std::string& strLabels, const std::string& strExtra = "")
+    {
+        const std::string strJoined = join(strLabels, strExtra);
+        if(strJoined.empty())
+            return strName;
+
+        return strName + "{" + strJoined + "}";
+    }
+
+
+    /* Format a value for the exposition format. */
+    static std::string number(const double dValue)
+    {
+        char chValue[32];
+        std::snprintf(chValue, sizeof(chValue), "%.9g", dValue);
+
+        return std::string(chValue);
+    }
+
+
+    /* Get the stripe for the calling thread. */
+    uint32_t stripe()
+    {
+        static std::atomic<uint32_t> nNext(0);
+        static thread_local uint32_t nStripe = (nNext++) % STRIPES;
+
+        return nStripe;
+    }
+
+
+    /* Default Constructor. */
+    Counter::Counter()
+    : vStripes ( )
+    {
+        for(auto& stats : vStripes)
+            stats.nValue.store(0);
+    }
+
+
+    /* Get the total of the counter. */
+    uint64_t Counter::Value() const
+    {
+        uint64_t nTotal = 0;
+        for(const auto& stats : vStripes)
+            nTotal += stats.nValue.load(std::memory_order_relaxed);
+
+        return nTotal;
+    }
+
+
+    /* Default Constructor. */
+    Histogram::Histogram()
+    : vStripes ( )
+    {
+        for(auto& stats : vStripes)
+        {
+            for(uint32_t n = 0; n < BUCKET_COUNT; ++n)
+                stats.vBuckets[n].store(0);
+
+            stats.nSum.store(0);
+        }
+    }
+
+
+    /* Get the number of observations in each bucket. */
+    void Histogram::Buckets(std::array<uint64_t, BUCKET_COUNT> &vCounts, uint64_t &nSum) const
+    {
+        vCounts.fill(0);
+        nSum = 0;
+
+        for(const auto& stats : vStripes)
+        {
+            for(uint32_t n = 0; n < BUCKET_COUNT; ++n)
+                vCounts[n] += stats.vBuckets[n].load(std::memory_order_relaxed);
+
+            nSum += stats.nSum.load(std::memory_order_relaxed);
+        }
+    }
+
+
+    /* Get the number of observations. */
+    uint64_t Histogram::Count() const
+    {
+        std::array<uint64_t, BUCKET_COUNT> vCounts;
+        uint64_t nSum = 0;
+        Buckets(vCounts, nSum);
+
+        uint64_t nCount = 0;
+        for(const auto& nBucket : vCounts)
+            nCount += nBucket;
+
+        return nCount;
+    }
+
+
+    /* Get a counter from the registry, adding it if it doesn't exist. */
+    Counter& GetCounter(const std::string& strName, const std::string& strHelp, const std::string& strLabels)
+    {
+        Registry& metrics = registry();
+        LOCK(metrics.MUTEX);
+
+        Family<std::unique_ptr<Counter>>& family = metrics.mapCounters[strName];
+        if(family.strHelp.empty())
+            family.strHelp = strHelp;
+
+        std::unique_ptr<Counter>& pCounter = family.mapMetrics[strLabels];
+        if(!pCounter)
+            pCounter.reset(new Counter());
+
+        return *pCounter;
+    }
+
+
+    /* Get a latency histogram from the registry, adding it if it doesn't exist. */
+    Histogram& GetHistogram(const std::string& strName, const std::string& strHelp, const std::string& strLabels)
+    {
+        Registry& metrics = registry();
+        LOCK(metrics.MUTEX);
+
+        Family<std::unique_ptr<Histogram>>& family = metrics.mapHistograms[strName];
+        if(family.strHelp.empty())
+            family.strHelp = strHelp;
+
+        std::unique_ptr<Histogram>& pHistogram = family.mapMetrics[strLabels];
+        if(!pHistogram)
+            pHistogram.reset(new Histogram());
+
+        return *pHistogram;
+    }
+
+
+    /* Add a value that is read when the metrics are exported. */
+    void AddGauge(const std::string& strName, const std::string& strHelp, const std::string& strLabels,
+                  const std::function<double()>& fnValue, const bool fCounter)
+    {
+        Registry& metrics = registry();
+        LOCK(metrics.MUTEX);
+
+        Family<Gauge>& family = metrics.mapGauges[strName];
+        if(family.strHelp.empty())
+            family.strHelp = strHelp;
+
+        Gauge& gauge = family.mapMetrics[strLabels];
+        gauge.fnValue  = fnValue;
+        gauge.fCounter = fCounter;
+    }
+
+
+    /* Get every metric in the Prometheus text exposition format. */
+    std::string Prometheus()
+    {
+        Registry& metrics = registry();
+        LOCK(metrics.MUTEX);
+
+        std::string strOut;
+
+        /* Counters. */
+        for(const auto& family : metrics.mapCounters)
+        {
+            strOut += "# HELP " + family.first + " " + family.second.strHelp + "\n";
+            strOut += "# TYPE " + family.first + " counter\n";
+
+            for(const auto& counter : family.second.mapMetrics)
+                strOut += series(family.first, counter.first) + " " + std::to_string(counter.second->Value()) + "\n";
+        }
+
+        /* Histograms, exported in seconds with cumulative buckets. */
+        for(const auto& family : metrics.mapHistograms)
+        {
+            strOut += "# HELP " + family.first + " " + family.second.strHelp + "\n";
+            strOut += "# TYPE " + family.first + " histogram\n";
+
+            for(const auto& histogram : family.second.mapMetrics)
+            {
+                std::array<uint64_t, BUCKET_COUNT> vCounts;
+                uint64_t nSum = 0;
+                histogram.second->Buckets(vCounts, nSum);
+
+                uint64_t nCount = 0;
+                for(uint32_t n = 0; n < BUCKET_COUNT; ++n)
+                {
+                    nCount += vCounts[n];
+
+                    const std::string strBound = (n + 1 < BUCKET_COUNT) ? number(BUCKETS[n] / 1000000.0) : "+Inf";
+                    strOut += series(family.first + "_bucket", histogram.first, "le=\"" + strBound + "\"")
+                            + " " + std::to_string(nCount) + "\n";
+                }
+
+                strOut += series(family.first + "_sum", histogram.first) + " " + number(nSum / 1000000.0) + "\n";
+                strOut += series(family.first + "_count", histogram.first) + " " + std::to_string(nCount) + "\n";
+            }
+        }
+
+        /* Gauges. */
+        for(const auto& family : metrics.mapGauges)
+        {
+            /* A family is a counter if its first value is. */
+            const bool fCounter = !family.second.mapMetrics.empty() && family.second.mapMetrics.begin()->second.fCounter;
+
+            strOut += "# HELP " + family.first + " " + family.second.strHelp + "\n";
+            strOut += "# TYPE " + family.first + (fCounter ? " counter\n" : " gauge\n");
+
+            for(const auto& gauge : family.second.mapMetrics)
+                strOut += series(family.first, gauge.first) + " " + number(gauge.second.fnValue()) + "\n";
+        }
+
+        return strOut;
+    }
+
+
+    /* Constructor */
+    CounterIndex::CounterIndex(const std::string& strNameIn, const std::string& strHelpIn,
+                               const std::string& strLabelsIn, const std::string& strKeyIn)
+    : strName      (strNameIn)
+    , strHelp      (strHelpIn)
+    , strLabels    (strLabelsIn)
+    , strKey       (strKeyIn)
+    , vCounters    ( )
+    , counterOther (GetCounter(strNameIn, strHelpIn, join(strLabelsIn, strKeyIn + "=\"other\"")))
+    {
+        for(auto& pCounter : vCounters)
+            pCounter.store(nullptr);
+    }
+
+
+    /* Get the counter for a code. */
+    Counter& CounterIndex::Get(const uint32_t nCode)
+    {
+        if(nCode >= SIZE)
+            return counterOther;
+
+        /* Look the counter up the first time the code is seen, the registry gives every thread the same one. */
+        Counter* pCounter = vCounters[nCode].load(std::memory_order_acquire);
+        if(pCounter == nullptr)
+        {
+            char chCode[16];
+            std::snprintf(chCode, sizeof(chCode), "0x%02x", nCode);
+
+            const std::string strCode = strKey + "=\"" + chCode + "\"";
+            pCounter = &GetCounter(strName, strHelp, join(strLabels, strCode));
+
+            vCounters[nCode].store(pCounter, std::memory_order_release);
+        }
+
+        return *pCounter;
+    }
+}
@@ -0,0 +1,124 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#include <Util/include/parallel.h>
+
+#include <deque>
+
+
+namespace
+{
+
+    /* The worker threads behind ParallelFor, kept until the process exits. */
+    class WorkerPool
+    {
+        /* Mutex to protect the queue and the workers. */
+        std::mutex MUTEX;
+
+        /* Wakes the workers when tasks are queued or the pool stops. */
+        std::condition_variable CONDITION;
+
+        /* The tasks waiting for a worker. */
+        std::deque<std::function<void()>> queTasks;
+
+        /* The worker threads. */
+        std::vector<std::thread> vWorkers;
+
+        /* Flag to stop the workers once the queue is empty. */
+        bool fStop;
+
+
+        /* Run tasks until the pool stops. */
+        void worker()
+        {
+            while(true)
+            {
+                std::function<void()> fnTask;
+                {
+                    std::unique_lock<std::mutex> lock(MUTEX);
+                    CONDITION.wait(lock, [this]() { return fStop || !queTasks.empty(); });
+
+                    if(queTasks.empty())
+                        return;
+
+                    fnTask = std::move(queTasks.front());
+                    queTasks.pop_front();
+                }
+
+                fnTask();
+            }
+        }
+
+
+    public:
+
+        WorkerPool()
+        : MUTEX     ( )
+        , CONDITION ( )
+        , queTasks  ( )
+        , vWorkers  ( )
+        , fStop     (false)
+        {
+        }
+
+
+        /* Join the workers so none outlive the pool. */
+        ~WorkerPool()
+        {
+            {
+                std::unique_lock<std::mutex> lock(MUTEX);
+                fStop = true;
+            }
+            CONDITION.notify_all();
+
+            for(auto& thread : vWorkers)
+                thread.join();
+        }
+
+
+        /* Queue copies of a task, starting workers until there is one for each copy. */
+        void Submit(const std::function<void()>& fnTask, const uint32_t nCopies)
+        {
+            {
+                std::unique_lock<std::mutex> lock(MUTEX);
+                while(vWorkers.size() < nCopies)
+                    vWorkers.emplace_back(&WorkerPool::worker, this);
+
+                for(uint32_t n = 0; n < nCopies; ++n)
+                    queTasks.push_back(fnTask);
+            }
+
+            if(nCopies == 1)
+                CONDITION.notify_one();
+            else
+                CONDITION.notify_all();
+        }
+    };
+
+
+    /* Get the pool, created on first use. */
+    WorkerPool& pool()
+    {
+        static WorkerPool workerPool;
+        return workerPool;
+    }
+}
+
+
+/* Queue copies of a task on the pooled worker threads. */
+void ParallelSubmit(const std::function<void()>& fnTask, const uint32_t nCopies)
+{
+    if(nCopies > 0)
+        pool().Submit(fnTask, nCopies);
+}
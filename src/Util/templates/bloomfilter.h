@@ -0,0 +1,142 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_UTIL_TEMPLATES_BLOOMFILTER_H
+#define NEXUS_UTIL_TEMPLATES_BLOOMFILTER_H
+
+#include <LLD/hash/xxh3.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+
+/** BloomFilter
+ *
+ *  Fixed size set of byte strings that can have false positives but never false negatives.
+ *  Used to reject most lookups cheaply before checking a slower exact set.
+ *
+ *  Bits are selected by double hashing the two halves of the XXH3 128-bit hash of the data.
+ *  Reads are safe from any number of threads once all inserts are done.
+ *
+ **/
+class BloomFilter
+{
+    /** The bits of the filter. **/
+    std::vector<uint64_t> vBits;
+
+
+    /** Mask to select a bit from a hash. **/
+    uint64_t nMask;
+
+
+    /** The number of bits set per element. **/
+    uint32_t nHashes;
+
+
+public:
+
+    /** Elements Constructor
+     *
+     *  @param[in] nElements The expected number of elements.
+     *  @param[in] nBitsPerElement The number of bits per element, 16 gives about one false positive in two thousand.
+     *
+     **/
+    BloomFilter(const uint64_t nElements, const uint32_t nBitsPerElement = 16)
+    : vBits   ( )
+    , nMask   (0)
+    , nHashes (std::max(1u, (nBitsPerElement * 69) / 100))
+    {
+        /* Round the number of bits up to a power of two. */
+        uint64_t nBits = 64;
+        while(nBits < nElements * nBitsPerElement)
+            nBits <<= 1;
+
+        vBits.assign(nBits / 64, 0);
+        nMask = nBits - 1;
+    }
+
+
+    /** Insert
+     *
+     *  Add an element to the filter.
+     *
+     *  @param[in] pData The element bytes.
+     *  @param[in] nSize The number of bytes.
+     *
+     **/
+    void Insert(const uint8_t* pData, const uint64_t nSize)
+    {
+        const XXH128_hash_t hash = XXH3_128bits(pData, nSize);
+        for(uint32_t n = 0; n < nHashes; ++n)
+        {
+            const uint64_t nBit = (hash.low64 + n * hash.high64) & nMask;
+            vBits[nBit >> 6] |= (uint64_t(1) << (nBit & 63));
+        }
+    }
+
+
+    /** Insert
+     *
+     *  Add an element to the filter.
+     *
+     *  @param[in] vData The element bytes.
+     *
+     **/
+    void Insert(const std::vector<uint8_t>& vData)
+    {
+        Insert(vData.data(), vData.size());
+    }
+
+
+    /** Contains
+     *
+     *  Check if an element may be in the filter.
+     *
+     *  @param[in] pData The element bytes.
+     *  @param[in] nSize The number of bytes.
+     *
+     *  @return false if the element was never inserted, true if it probably was.
+     *
+     **/
+    bool Contains(const uint8_t* pData, const uint64_t nSize) const
+    {
+        const XXH128_hash_t hash = XXH3_128bits(pData, nSize);
+        for(uint32_t n = 0; n < nHashes; ++n)
+        {
+            const uint64_t nBit = (hash.low64 + n * hash.high64) & nMask;
+            if(!(vBits[nBit >> 6] & (uint64_t(1) << (nBit & 63))))
+                return false;
+        }
+
+        return true;
+    }
+
+
+    /** Contains
+     *
+     *  Check if an element may be in the filter.
+     *
+     *  @param[in] vData The element bytes.
+     *
+     *  @return false if the element was never inserted, true if it probably was.
+     *
+     **/
+    bool Contains(const std::vector<uint8_t>& vData) const
+    {
+        return Contains(vData.data(), vData.size());
+    }
+};
+
+#endif
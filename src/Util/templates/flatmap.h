@@ -0,0 +1,434 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#pragma once
+#ifndef NEXUS_UTIL_TEMPLATES_FLATMAP_H
+#define NEXUS_UTIL_TEMPLATES_FLATMAP_H
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+
+/** FlatMap
+ *
+ *  Hash map for keys that are already uniformly distributed, such as transaction and register hashes.
+ *
+ *  The entries are kept contiguous in a vector, so iterating is a linear scan, and found through an open
+ *  addressing index of linear probed slots. Each slot holds the low 32 bits of the key's hash, so probing
+ *  rarely touches a key and growing the index never hashes a key again. The hash is used directly to pick
+ *  the slot, so keys that are not well distributed need a hash function that mixes them.
+ *
+ *  Erasing moves the last entry into the erased position. Any insert may invalidate every iterator and
+ *  reference, and an erase invalidates those to the erased and the last entry. Iteration order is arbitrary.
+ *
+ **/
+template<typename KeyType, typename ValueType, typename Hash = std::hash<KeyType>>
+class FlatMap
+{
+public:
+
+    /** The types of the map, matching the standard containers. **/
+    typedef KeyType                                          key_type;
+    typedef ValueType                                        mapped_type;
+    typedef std::pair<KeyType, ValueType>                    value_type;
+    typedef typename std::vector<value_type>::iterator       iterator;
+    typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+
+private:
+
+    /** A slot of the index, with a zero index marking it empty. **/
+    struct Slot
+    {
+        /** The position of the entry plus one. **/
+        uint32_t nIndex;
+
+        /** The low bits of the hash of the entry's key. **/
+        uint32_t nHash;
+    };
+
+
+    /** The smallest number of slots allocated. **/
+    static const uint32_t MIN_SLOTS = 16;
+
+
+    /** The entries of the map. **/
+    std::vector<value_type> vEntries;
+
+
+    /** The index into the entries, a power of two in size. **/
+    std::vector<Slot> vSlots;
+
+
+    /** Mask to wrap a position into a slot. **/
+    uint64_t nMask;
+
+
+    /** Get the hash of a key as stored in the slots. **/
+    static uint32_t hash(const KeyType& key)
+    {
+        return static_cast<uint32_t>(Hash()(key));
+    }
+
+
+    /** Find the slot holding a key, or the empty slot it would go in. **/
+    uint64_t locate(const KeyType& key, const uint32_t nHash) const
+    {
+        uint64_t nSlot = nHash & nMask;
+        while(true)
+        {
+            const Slot& slot = vSlots[nSlot];
+            if(slot.nIndex == 0 || (slot.nHash == nHash && vEntries[slot.nIndex - 1].first == key))
+                return nSlot;
+
+            nSlot = (nSlot + 1) & nMask;
+        }
+    }
+
+
+    /** Find the slot pointing to the entry at a position. **/
+    uint64_t locate(const uint32_t nIndex) const
+    {
+        uint64_t nSlot = hash(vEntries[nIndex].first) & nMask;
+        while(vSlots[nSlot].nIndex != nIndex + 1)
+            nSlot = (nSlot + 1) & nMask;
+
+        return nSlot;
+    }
+
+
+    /** Build the index with a number of slots, from the hashes already in it. **/
+    void rehash(const uint64_t nSlots)
+    {
+        std::vector<Slot> vOld(nSlots, Slot{0, 0});
+        vOld.swap(vSlots);
+        nMask = nSlots - 1;
+
+        for(const Slot& slot : vOld)
+        {
+            if(slot.nIndex == 0)
+                continue;
+
+            uint64_t nSlot = slot.nHash & nMask;
+            while(vSlots[nSlot].nIndex != 0)
+                nSlot = (nSlot + 1) & nMask;
+
+            vSlots[nSlot] = slot;
+        }
+    }
+
+
+    /** Grow the index if needed to hold a number of entries, keeping it at most three quarters full. **/
+    void grow(const size_t nSize)
+    {
+        if(nSize * 4 <= vSlots.size() * 3)
+            return;
+
+        uint64_t nSlots = MIN_SLOTS;
+        while(nSize * 4 > nSlots * 3)
+            nSlots <<= 1;
+
+        rehash(nSlots);
+    }
+
+
+    /** Add a new entry at an empty slot. **/
+    template<typename... Args>
+    iterator place(const uint64_t nSlot, const uint32_t nHash, Args&&... args)
+    {
+        vEntries.emplace_back(std::forward<Args>(args)...);
+        vSlots[nSlot] = Slot{static_cast<uint32_t>(vEntries.size()), nHash};
+
+        return vEntries.end() - 1;
+    }
+
+
+    /** Remove the entry a slot points to. **/
+    void remove(uint64_t nSlot)
+    {
+        const uint32_t nIndex = vSlots[nSlot].nIndex - 1;
+
+        /* Shift the rest of the probe run back over the hole, so lookups never need tombstones. */
+        uint64_t nNext = (nSlot + 1) & nMask;
+        while(vSlots[nNext].nIndex != 0)
+        {
+            const uint64_t nHome = vSlots[nNext].nHash & nMask;
+            if(((nNext - nHome) & nMask) >= ((nNext - nSlot) & nMask))
+            {
+                vSlots[nSlot] = vSlots[nNext];
+                nSlot = nNext;
+            }
+
+            nNext = (nNext + 1) & nMask;
+        }
+        vSlots[nSlot] = Slot{0, 0};
+
+        /* Move the last entry into the gap. */
+        const uint32_t nLast = static_cast<uint32_t>(vEntries.size() - 1);
+        if(nIndex != nLast)
+        {
+            vSlots[locate(nLast)].nIndex = nIndex + 1;
+            vEntries[nIndex] = std::move(vEntries[nLast]);
+        }
+        vEntries.pop_back();
+    }
+
+
+public:
+
+    /** Default Constructor. **/
+    FlatMap()
+    : vEntries ( )
+    , vSlots   ( )
+    , nMask    (0)
+    {
+    }
+
+
+    /** Iterators over the entries. **/
+    iterator begin()              { return vEntries.begin(); }
+    iterator end()                { return vEntries.end();   }
+    const_iterator begin()  const { return vEntries.begin(); }
+    const_iterator end()    const { return vEntries.end();   }
+
+
+    /** size
+     *
+     *  @return The number of entries.
+     *
+     **/
+    size_t size() const
+    {
+        return vEntries.size();
+    }
+
+
+    /** empty
+     *
+     *  @return True if there are no entries.
+     *
+     **/
+    bool empty() const
+    {
+        return vEntries.empty();
+    }
+
+
+    /** clear
+     *
+     *  Remove every entry, keeping the memory allocated.
+     *
+     **/
+    void clear()
+    {
+        vEntries.clear();
+        vSlots.assign(vSlots.size(), Slot{0, 0});
+    }
+
+
+    /** reserve
+     *
+     *  Allocate enough for a number of entries without growing.
+     *
+     *  @param[in] nSize The number of entries.
+     *
+     **/
+    void reserve(const size_t nSize)
+    {
+        vEntries.reserve(nSize);
+        grow(nSize);
+    }
+
+
+    /** find
+     *
+     *  @param[in] key The key to find.
+     *
+     *  @return The entry with the key, or end() if there is none.
+     *
+     **/
+    iterator find(const KeyType& key)
+    {
+        if(vEntries.empty())
+            return vEntries.end();
+
+        const uint32_t nIndex = vSlots[locate(key, hash(key))].nIndex;
+        return nIndex ? vEntries.begin() + (nIndex - 1) : vEntries.end();
+    }
+
+
+    /** find
+     *
+     *  @param[in] key The key to find.
+     *
+     *  @return The entry with the key, or end() if there is none.
+     *
+     **/
+    const_iterator find(const KeyType& key) const
+    {
+        if(vEntries.empty())
+            return vEntries.end();
+
+        const uint32_t nIndex = vSlots[locate(key, hash(key))].nIndex;
+        return nIndex ? vEntries.begin() + (nIndex - 1) : vEntries.end();
+    }
+
+
+    /** count
+     *
+     *  @param[in] key The key to find.
+     *
+     *  @return One if the key is in the map, otherwise zero.
+     *
+     **/
+    size_t count(const KeyType& key) const
+    {
+        return find(key) != vEntries.end() ? 1 : 0;
+    }
+
+
+    /** at
+     *
+     *  @param[in] key The key to find.
+     *
+     *  @return The value of the key, throwing std::out_of_range if there is none.
+     *
+     **/
+    ValueType& at(const KeyType& key)
+    {
+        const iterator it = find(key);
+        if(it == vEntries.end())
+            throw std::out_of_range("FlatMap::at");
+
+        return it->second;
+    }
+
+
+    /** at
+     *
+     *  @param[in] key The key to find.
+     *
+     *  @return The value of the key, throwing std::out_of_range if there is none.
+     *
+     **/
+    const ValueType& at(const KeyType& key) const
+    {
+        const const_iterator it = find(key);
+        if(it == vEntries.end())
+            throw std::out_of_range("FlatMap::at");
+
+        return it->second;
+    }
+
+
+    /** operator[]
+     *
+     *  @param[in] key The key to find.
+     *
+     *  @return The value of the key, default constructed if it was not in the map.
+     *
+     **/
+    ValueType& operator[](const KeyType& key)
+    {
+        grow(vEntries.size() + 1);
+
+        const uint32_t nHash = hash(key);
+        const uint64_t nSlot = locate(key, nHash);
+        if(vSlots[nSlot].nIndex != 0)
+            return vEntries[vSlots[nSlot].nIndex - 1].second;
+
+        return place(nSlot, nHash, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple())->second;
+    }
+
+
+    /** insert
+     *
+     *  Add an entry if its key is not already in the map.
+     *
+     *  @param[in] value The entry to add.
+     *
+     *  @return The entry with the key, and true if it was added.
+     *
+     **/
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        grow(vEntries.size() + 1);
+
+        const uint32_t nHash = hash(value.first);
+        const uint64_t nSlot = locate(value.first, nHash);
+        if(vSlots[nSlot].nIndex != 0)
+            return std::make_pair(vEntries.begin() + (vSlots[nSlot].nIndex - 1), false);
+
+        return std::make_pair(place(nSlot, nHash, std::move(value)), true);
+    }
+
+
+    /** insert
+     *
+     *  Add an entry if its key is not already in the map.
+     *
+     *  @param[in] value The entry to add.
+     *
+     *  @return The entry with the key, and true if it was added.
+     *
+     **/
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return insert(value_type(value));
+    }
+
+
+    /** erase
+     *
+     *  @param[in] key The key to remove.
+     *
+     *  @return The number of entries removed.
+     *
+     **/
+    size_t erase(const KeyType& key)
+    {
+        if(vEntries.empty())
+            return 0;
+
+        const uint64_t nSlot = locate(key, hash(key));
+        if(vSlots[nSlot].nIndex == 0)
+            return 0;
+
+        remove(nSlot);
+        return 1;
+    }
+
+
+    /** erase
+     *
+     *  @param[in] it The entry to remove.
+     *
+     *  @return The entry now at its position, which was the last entry, so erasing while iterating
+     *          visits every entry once.
+     *
+     **/
+    iterator erase(const_iterator it)
+    {
+        const uint32_t nIndex = static_cast<uint32_t>(it - vEntries.begin());
+        remove(locate(nIndex));
+
+        return vEntries.begin() + nIndex;
+    }
+};
+
+#endif
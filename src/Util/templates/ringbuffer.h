@@ -0,0 +1,149 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_UTIL_TEMPLATES_RINGBUFFER_H
+#define NEXUS_UTIL_TEMPLATES_RINGBUFFER_H
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+/** RingBuffer
+ *
+ *  Fixed size lock-free queue for exactly one producer thread and one consumer thread.
+ *
+ *  The producer only writes the tail and the consumer only writes the head, so neither side ever waits on the
+ *  other. A full buffer rejects the push rather than blocking, leaving the caller to decide what to drop.
+ *
+ **/
+template<typename Type>
+class RingBuffer
+{
+    /** The slots of the buffer. **/
+    std::vector<Type> vSlots;
+
+
+    /** Mask to wrap a position into a slot index. **/
+    const uint64_t nMask;
+
+
+    /** The position of the next slot to pop, written by the consumer. **/
+    std::atomic<uint64_t> nHead;
+
+
+    /** Keeps the head and tail on separate cache lines so the two threads don't invalidate each other. **/
+    uint8_t vPadding[64];
+
+
+    /** The position of the next slot to push, written by the producer. **/
+    std::atomic<uint64_t> nTail;
+
+
+    /** Round a capacity up to a power of two. **/
+    static uint64_t round(const uint64_t nCapacity)
+    {
+        uint64_t nSize = 2;
+        while(nSize < nCapacity)
+            nSize <<= 1;
+
+        return nSize;
+    }
+
+
+public:
+
+    /** Capacity Constructor
+     *
+     *  @param[in] nCapacity The number of elements the buffer can hold, rounded up to a power of two.
+     *
+     **/
+    RingBuffer(const uint64_t nCapacity)
+    : vSlots   (round(nCapacity))
+    , nMask    (vSlots.size() - 1)
+    , nHead    (0)
+    , vPadding ( )
+    , nTail    (0)
+    {
+    }
+
+
+    /** Push
+     *
+     *  Add an element to the back of the buffer. Only called from the producer thread.
+     *
+     *  @param[in] value The element to move in.
+     *
+     *  @return false if the buffer is full, leaving value untouched.
+     *
+     **/
+    bool Push(Type&& value)
+    {
+        const uint64_t nPosition = nTail.load(std::memory_order_relaxed);
+        if(nPosition - nHead.load(std::memory_order_acquire) > nMask)
+            return false;
+
+        vSlots[nPosition & nMask] = std::move(value);
+        nTail.store(nPosition + 1, std::memory_order_release);
+
+        return true;
+    }
+
+
+    /** Pop
+     *
+     *  Take the element from the front of the buffer. Only called from the consumer thread.
+     *
+     *  @param[out] value The element moved out.
+     *
+     *  @return false if the buffer is empty.
+     *
+     **/
+    bool Pop(Type &value)
+    {
+        const uint64_t nPosition = nHead.load(std::memory_order_relaxed);
+        if(nPosition == nTail.load(std::memory_order_acquire))
+            return false;
+
+        value = std::move(vSlots[nPosition & nMask]);
+        nHead.store(nPosition + 1, std::memory_order_release);
+
+        return true;
+    }
+
+
+    /** Size
+     *
+     *  @return The number of elements in the buffer, exact only from the producer or consumer thread.
+     *
+     **/
+    uint64_t Size() const
+    {
+        return nTail.load(std::memory_order_acquire) - nHead.load(std::memory_order_acquire);
+    }
+
+
+    /** Capacity
+     *
+     *  @return The number of elements the buffer can hold.
+     *
+     **/
+    uint64_t Capacity() const
+    {
+        return vSlots.size();
+    }
+};
+
+#endif
@@ -0,0 +1,183 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#pragma once
+#ifndef NEXUS_UTIL_TEMPLATES_VIEWSTREAM_H
+#define NEXUS_UTIL_TEMPLATES_VIEWSTREAM_H
+
+#include <Util/templates/serialize.h>
+
+#include <cstdint>
+#include <vector>
+
+
+/** ViewStream
+ *
+ *  Read only stream over bytes it doesn't own, to deserialize from a buffer without copying it into a
+ *  DataStream. The bytes must outlive the stream and not change while it is read.
+ *
+ **/
+class ViewStream
+{
+    /** The start of the bytes. **/
+    const uint8_t* pBegin;
+
+
+    /** The end of the bytes. **/
+    const uint8_t* pEnd;
+
+
+    /** The current reading position. **/
+    mutable uint64_t nReadPos;
+
+
+    /** The serialization type. **/
+    uint32_t nSerType;
+
+
+    /** The serializtion version **/
+    uint32_t nSerVersion;
+
+
+public:
+
+    /** ViewStream
+     *
+     *  Constructs the stream over a range of bytes.
+     *
+     *  @param[in] pBeginIn The start of the bytes.
+     *  @param[in] pEndIn The end of the bytes.
+     *  @param[in] nSerTypeIn The serialize type.
+     *  @param[in] nSerVersionIn The serialize version.
+     *
+     **/
+    ViewStream(const uint8_t* pBeginIn, const uint8_t* pEndIn, const uint32_t nSerTypeIn, const uint32_t nSerVersionIn);
+
+
+    /** ViewStream
+     *
+     *  Constructs the stream over a byte vector.
+     *
+     *  @param[in] vData The byte vector to read, which must outlive the stream.
+     *  @param[in] nSerTypeIn The serialize type.
+     *  @param[in] nSerVersionIn The serialize version.
+     *
+     **/
+    ViewStream(const std::vector<uint8_t>& vData, const uint32_t nSerTypeIn, const uint32_t nSerVersionIn);
+
+
+    /** A temporary vector would be destroyed before the stream is read. **/
+    ViewStream(std::vector<uint8_t>&& vData, const uint32_t nSerTypeIn, const uint32_t nSerVersionIn) = delete;
+
+
+    /** SetType
+     *
+     *  Sets the type of stream.
+     *
+     *  @param[in] nSerTypeIn The serialize type to set.
+     *
+     **/
+    void SetType(uint8_t nSerTypeIn);
+
+
+    /** SetPos
+     *
+     *  Sets the position in the stream.
+     *
+     *  @param[in] nNewPos The position to set to in the stream.
+     *
+     **/
+    void SetPos(uint64_t nNewPos) const;
+
+
+    /** GetPos
+     *
+     *  Gets the position in the stream.
+     *
+     *  @return the current read position in the stream.
+     *
+     **/
+    uint64_t GetPos() const;
+
+
+    /** Reset
+     *
+     *  Resets the internal read pointer.
+     *
+     **/
+    void Reset() const;
+
+
+    /** End
+     *
+     *  Returns if end of stream is found.
+     *
+     **/
+    bool End() const;
+
+
+    /** read
+     *
+     *  Reads raw data from the stream.
+     *
+     *  @param[in] pch The pointer to beginning of memory to write.
+     *  @param[in] nSize The total number of bytes to read.
+     *
+     *  @return Returns a reference to the ViewStream object.
+     *
+     **/
+    const ViewStream& read(char* pch, uint64_t nSize) const;
+
+
+    /** begin
+     *
+     *  Get the start of the bytes.
+     *
+     **/
+    const uint8_t* begin() const;
+
+
+    /** end
+     *
+     *  Get the end of the bytes.
+     *
+     **/
+    const uint8_t* end() const;
+
+
+    /** size
+     *
+     *  Get the size of the stream.
+     *
+     **/
+    uint64_t size() const;
+
+
+    /** Operator Overload >>
+     *
+     *  Deserializes an object from the stream.
+     *
+     *  @param[out] obj The object to de-serialize.
+     *
+     **/
+    template<typename Type>
+    const ViewStream& operator>>(Type& obj) const
+    {
+        /* Unserialize from the stream. */
+        ::Unserialize(*this, obj, nSerType, nSerVersion);
+        return (*this);
+    }
+};
+
+#endif
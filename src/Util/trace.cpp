@@ -0,0 +1,250 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Util/include/trace.h>
+
+#include <Util/include/args.h>
+#include <Util/include/debug.h>
+#include <Util/include/json.h>
+#include <Util/include/mutex.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace trace
+{
+
+    /* Flag to tell if spans are being recorded. */
+    std::atomic<bool> fEnabled(false);
+
+
+    /* How long the spans of exited threads are kept for, in microseconds. */
+    const uint64_t RETAIN_EXITED = 300000000;
+
+
+    /* A finished span. */
+    struct Event
+    {
+        /* The name of the span with its detail. */
+        std::string strName;
+
+        /* The ID of the span. */
+        uint64_t nID;
+
+        /* The ID of the parent span, 0 for none. */
+        uint64_t nParent;
+
+        /* The start and end of the span in microseconds. */
+        uint64_t nStart;
+        uint64_t nEnd;
+    };
+
+
+    /* The most recent spans of a thread, overwriting the oldest when full. */
+    struct Buffer
+    {
+        /* Mutex to protect the buffer, only contended while dumping. */
+        std::mutex MUTEX;
+
+        /* The spans, used as a circular buffer once full. */
+        std::vector<Event> vEvents;
+
+        /* The number of spans the buffer holds. */
+        uint32_t nCapacity;
+
+        /* The number of spans written. */
+        uint64_t nWritten;
+
+        /* The end of the newest span. */
+        uint64_t nLast;
+
+        /* The number of the thread for the trace viewer. */
+        uint32_t nThread;
+    };
+
+
+    /* Mutex to protect the list of buffers. */
+    static std::mutex BUFFERS_MUTEX;
+
+    /* The buffers of every thread that has recorded a span. */
+    static std::vector<std::shared_ptr<Buffer>> vBuffers;
+
+    /* The calling thread's buffer, created with its first span. */
+    static thread_local std::shared_ptr<Buffer> pThreadBuffer;
+
+    /* The span open on the calling thread. */
+    static thread_local uint64_t nCurrent = 0;
+
+    /* The last span ID handed out. */
+    static std::atomic<uint64_t> nSpans(0);
+
+    /* The last thread number handed out. */
+    static std::atomic<uint32_t> nThreads(0);
+
+    /* The number of spans each thread keeps. */
+    static std::atomic<uint32_t> nBufferSize(8192);
+
+
+    /* Get the time in microseconds. */
+    static uint64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+
+    /* Forget the buffers of exited threads with nothing newer than a time. Requires BUFFERS_MUTEX. */
+    static void prune(const uint64_t nOldest)
+    {
+        vBuffers.erase(std::remove_if(vBuffers.begin(), vBuffers.end(),
+            [nOldest](const std::shared_ptr<Buffer>& pBuffer)
+            {
+                if(pBuffer.use_count() > 1)
+                    return false;
+
+                LOCK(pBuffer->MUTEX);
+                return pBuffer->nLast < nOldest;
+            }), vBuffers.end());
+    }
+
+
+    /* Get the calling thread's buffer. */
+    static Buffer& thread_buffer()
+    {
+        if(!pThreadBuffer)
+        {
+            pThreadBuffer = std::make_shared<Buffer>();
+            pThreadBuffer->nCapacity = nBufferSize.load();
+            pThreadBuffer->nWritten  = 0;
+            pThreadBuffer->nLast     = 0;
+            pThreadBuffer->nThread   = ++nThreads;
+
+            LOCK(BUFFERS_MUTEX);
+
+            const uint64_t nNow = now();
+            prune(nNow > RETAIN_EXITED ? nNow - RETAIN_EXITED : 0);
+
+            vBuffers.push_back(pThreadBuffer);
+        }
+
+        return *pThreadBuffer;
+    }
+
+
+    /* Read the trace configuration. */
+    void Initialize()
+    {
+        nBufferSize.store(std::max(int64_t(64), config::GetArg("-tracebuffer", 8192)));
+
+        if(config::GetBoolArg("-trace", false))
+            Enable(true);
+    }
+
+
+    /* Start or stop recording spans. */
+    void Enable(const bool fEnable)
+    {
+        if(fEnabled.exchange(fEnable) != fEnable)
+            debug::log(0, FUNCTION, "tracing ", fEnable ? "enabled" : "disabled");
+    }
+
+
+    /* Get the spans that ended in a recent window in the Chrome trace event format. */
+    std::string Dump(const uint64_t nSeconds)
+    {
+        const uint64_t nNow    = now();
+        const uint64_t nWindow = nSeconds * 1000000;
+        const uint64_t nOldest = nNow > nWindow ? nNow - nWindow : 0;
+
+        /* Get the buffers. */
+        std::vector<std::shared_ptr<Buffer>> vSnapshot;
+        {
+            LOCK(BUFFERS_MUTEX);
+
+            prune(nNow > RETAIN_EXITED ? nNow - RETAIN_EXITED : 0);
+            vSnapshot = vBuffers;
+        }
+
+        /* Build complete events, ts and dur are in microseconds. */
+        json::json jsonEvents = json::json::array();
+        for(const auto& pBuffer : vSnapshot)
+        {
+            LOCK(pBuffer->MUTEX);
+
+            for(const auto& event : pBuffer->vEvents)
+            {
+                if(event.nEnd < nOldest)
+                    continue;
+
+                json::json jsonEvent;
+                jsonEvent["name"] = event.strName;
+                jsonEvent["cat"]  = "nexus";
+                jsonEvent["ph"]   = "X";
+                jsonEvent["ts"]   = event.nStart;
+                jsonEvent["dur"]  = event.nEnd - event.nStart;
+                jsonEvent["pid"]  = 1;
+                jsonEvent["tid"]  = pBuffer->nThread;
+                jsonEvent["args"] = { {"id", event.nID}, {"parent", event.nParent} };
+
+                jsonEvents.push_back(jsonEvent);
+            }
+        }
+
+        json::json jsonTrace;
+        jsonTrace["traceEvents"]     = jsonEvents;
+        jsonTrace["displayTimeUnit"] = "ms";
+
+        return jsonTrace.dump();
+    }
+
+
+    /* Start recording the span. */
+    void Span::start()
+    {
+        nID     = ++nSpans;
+        nParent = nCurrent;
+        nStart  = now();
+
+        nCurrent = nID;
+    }
+
+
+    /* Finish recording the span. */
+    void Span::finish()
+    {
+        const uint64_t nEnd = now();
+        nCurrent = nParent;
+
+        Buffer& buffer = thread_buffer();
+        LOCK(buffer.MUTEX);
+
+        /* Add until full, then overwrite the oldest. */
+        if(buffer.vEvents.size() < buffer.nCapacity)
+            buffer.vEvents.emplace_back();
+
+        Event& event = buffer.vEvents[buffer.nWritten % buffer.vEvents.size()];
+        event.strName = pName;
+        if(pDetail)
+            event.strName += " " + *pDetail;
+
+        event.nID     = nID;
+        event.nParent = nParent;
+        event.nStart  = nStart;
+        event.nEnd    = nEnd;
+
+        ++buffer.nWritten;
+        buffer.nLast = nEnd;
+    }
+}
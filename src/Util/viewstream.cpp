@@ -0,0 +1,119 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#include <Util/templates/viewstream.h>
+
+#include <algorithm>
+#include <cstring>
+
+
+/*  Constructs the stream over a range of bytes. */
+ViewStream::ViewStream(const uint8_t* pBeginIn, const uint8_t* pEndIn, const uint32_t nSerTypeIn, const uint32_t nSerVersionIn)
+: pBegin(pBeginIn)
+, pEnd(pEndIn)
+, nReadPos(0)
+, nSerType(nSerTypeIn)
+, nSerVersion(nSerVersionIn)
+{
+}
+
+
+/*  Constructs the stream over a byte vector. */
+ViewStream::ViewStream(const std::vector<uint8_t>& vData, const uint32_t nSerTypeIn, const uint32_t nSerVersionIn)
+: pBegin(vData.data())
+, pEnd(vData.data() + vData.size())
+, nReadPos(0)
+, nSerType(nSerTypeIn)
+, nSerVersion(nSerVersionIn)
+{
+}
+
+
+/*  Sets the type of stream. */
+void ViewStream::SetType(uint8_t nSerTypeIn)
+{
+    nSerType = nSerTypeIn;
+}
+
+
+/*  Sets the position in the stream. */
+void ViewStream::SetPos(uint64_t nNewPos) const
+{
+    /* Check size constraints. */
+    if(nNewPos > size())
+        throw std::runtime_error(debug::safe_printstr(FUNCTION, "cannot set at end of stream ", nNewPos));
+
+    /* Set the new read pos. */
+    nReadPos = nNewPos;
+}
+
+
+/*  Gets the position in the stream. */
+uint64_t ViewStream::GetPos() const
+{
+    return nReadPos;
+}
+
+
+/*  Resets the internal read pointer. */
+void ViewStream::Reset() const
+{
+    nReadPos = 0;
+}
+
+
+/*  Returns if end of stream is found. */
+bool ViewStream::End() const
+{
+    return nReadPos >= size();
+}
+
+
+/*  Reads raw data from the stream. */
+const ViewStream& ViewStream::read(char* pch, uint64_t nSize) const
+{
+    /* Check size constraints. */
+    if(nSize > size() - std::min(nReadPos, size()))
+        throw std::runtime_error(debug::safe_printstr(FUNCTION, "reached end of stream ", nReadPos));
+
+    /* Copy the bytes into tmp object. */
+    if(nSize > 0)
+        std::memcpy(pch, pBegin + nReadPos, nSize);
+
+    /* Iterate the read position. */
+    nReadPos += nSize;
+
+    return *this;
+}
+
+
+/*  Get the start of the bytes. */
+const uint8_t* ViewStream::begin() const
+{
+    return pBegin;
+}
+
+
+/*  Get the end of the bytes. */
+const uint8_t* ViewStream::end() const
+{
+    return pEnd;
+}
+
+
+/*  Get the size of the stream. */
+uint64_t ViewStream::size() const
+{
+    return pEnd - pBegin;
+}
@@ -28,11 +28,13 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/chainstate.h>
 #include <TAO/Ledger/types/tritium_minter.h>
 #include <TAO/Ledger/include/timelocks.h>
+#include <TAO/Ledger/include/replay.h>
 
 #include <Util/include/convert.h>
 #include <Util/include/filesystem.h>
 #include <Util/include/signals.h>
 #include <Util/include/daemon.h>
+#include <Util/include/trace.h>
 
 #include <Legacy/include/ambassador.h>
 #include <Legacy/wallet/wallet.h>
@@ -68,6 +70,10 @@ int main(int argc, char** argv)
     debug::Initialize();
 
 
+    /* Initialize tracing, enabled with -trace. */
+    trace::Initialize();
+
+
     /* Initialize network resources. (Need before RPC/API for WSAStartup call in Windows) */
     LLP::Initialize();
 
@@ -209,6 +215,20 @@ int main(int argc, char** argv)
             Legacy::Wallet::GetInstance().ScanForWalletTransactions(TAO::Ledger::ChainState::stateGenesis, true);
 
 
+        /* Replay blocks from another data directory without starting the servers. */
+        if(config::mapArgs.count("-replay"))
+        {
+            if(!TAO::Ledger::Replay(config::GetArg("-replay", ""), config::GetArg("-replayheight", 0)))
+                debug::error("Failed replaying blocks");
+
+            config::fShutdown = true;
+        }
+    }
+
+
+    /* Start the servers unless shutting down. */
+    if(!fFailed && !config::fShutdown.load())
+    {
         /* Relay transactions. */
         Legacy::Wallet::GetInstance().ResendWalletTransactions();
 
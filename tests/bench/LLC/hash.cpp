@@ -0,0 +1,88 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#include <bench/harness.h>
+
+#include <LLC/hash/SK.h>
+#include <LLC/include/random.h>
+
+#include <Util/include/debug.h>
+
+#include <unit/catch2/catch.hpp>
+
+TEST_CASE( "SK Hash Benchmarks", "[LLC]")
+{
+    debug::log(0, "===== Begin SK Hash Benchmarks =====");
+
+    /* Hash different data each time so the SK caches miss as they would on new transactions. */
+    for(const uint32_t nSize : { 64u, 1024u, 16384u })
+    {
+        const uint32_t nHashes = 2000;
+
+        std::vector<uint8_t> vData = LLC::GetRand256().GetBytes();
+        vData.resize(nSize, 0x55);
+
+        uint64_t nCounter = 0;
+        uint64_t nSink    = 0;
+
+        bench::Run("LLC/SK64/" + std::to_string(nSize), nHashes, [&]()
+        {
+            for(uint32_t n = 0; n < nHashes; ++n)
+            {
+                ++nCounter;
+                std::copy((uint8_t*)&nCounter, (uint8_t*)&nCounter + 8, vData.begin());
+
+                nSink += LLC::SK64(vData);
+            }
+        });
+
+        bench::Run("LLC/SK256/" + std::to_string(nSize), nHashes, [&]()
+        {
+            for(uint32_t n = 0; n < nHashes; ++n)
+            {
+                ++nCounter;
+                std::copy((uint8_t*)&nCounter, (uint8_t*)&nCounter + 8, vData.begin());
+
+                nSink += LLC::SK256(vData).Get64();
+            }
+        });
+
+        bench::Run("LLC/SK512/" + std::to_string(nSize), nHashes, [&]()
+        {
+            for(uint32_t n = 0; n < nHashes; ++n)
+            {
+                ++nCounter;
+                std::copy((uint8_t*)&nCounter, (uint8_t*)&nCounter + 8, vData.begin());
+
+                nSink += LLC::SK512(vData).Get64();
+            }
+        });
+
+        bench::Run("LLC/SK1024/" + std::to_string(nSize), nHashes, [&]()
+        {
+            for(uint32_t n = 0; n < nHashes; ++n)
+            {
+                ++nCounter;
+                std::copy((uint8_t*)&nCounter, (uint8_t*)&nCounter + 8, vData.begin());
+
+                nSink += LLC::SK1024(vData.begin(), vData.end()).Get64();
+            }
+        });
+
+        /* Keep the hashes from being optimized away. */
+        REQUIRE(nSink != 0);
+    }
+
+    debug::log(0, "===== End SK Hash Benchmarks =====\n");
+}
@@ -0,0 +1,92 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#include <bench/harness.h>
+
+#include <LLC/include/eckey.h>
+#include <LLC/include/flkey.h>
+#include <LLC/include/random.h>
+
+#include <Util/include/debug.h>
+
+#include <unit/catch2/catch.hpp>
+
+TEST_CASE( "Signature Benchmarks", "[LLC]")
+{
+    debug::log(0, "===== Begin Signature Benchmarks =====");
+
+    /* The data signed by sigchain transactions is a 512-bit hash. */
+    const std::vector<uint8_t> vData = LLC::GetRand512().GetBytes();
+
+    /* Brainpool as used by tritium sigchains. */
+    {
+        LLC::ECKey key = LLC::ECKey(LLC::BRAINPOOL_P512_T1, 64);
+        key.MakeNewKey(true);
+
+        std::vector<uint8_t> vchSig;
+        bench::Run("LLC/ECDSA/brainpool/Sign", 50, [&]()
+        {
+            for(uint32_t n = 0; n < 50; ++n)
+                REQUIRE(key.Sign(vData, vchSig));
+        });
+
+        bench::Run("LLC/ECDSA/brainpool/Verify", 50, [&]()
+        {
+            for(uint32_t n = 0; n < 50; ++n)
+                REQUIRE(key.Verify(vData, vchSig));
+        });
+    }
+
+    /* secp256k1 as used by legacy scripts. */
+    {
+        LLC::ECKey key;
+        key.MakeNewKey(true);
+
+        const uint1024_t hash = LLC::GetRand1024();
+
+        std::vector<uint8_t> vchSig;
+        bench::Run("LLC/ECDSA/secp256k1/Sign", 100, [&]()
+        {
+            for(uint32_t n = 0; n < 100; ++n)
+                REQUIRE(key.Sign(hash, vchSig, 256));
+        });
+
+        bench::Run("LLC/ECDSA/secp256k1/Verify", 100, [&]()
+        {
+            for(uint32_t n = 0; n < 100; ++n)
+                REQUIRE(key.Verify(hash, vchSig, 256));
+        });
+    }
+
+    /* Falcon-512. */
+    {
+        LLC::FLKey key;
+        key.MakeNewKey();
+
+        std::vector<uint8_t> vchSig;
+        bench::Run("LLC/Falcon/Sign", 50, [&]()
+        {
+            for(uint32_t n = 0; n < 50; ++n)
+                REQUIRE(key.Sign(vData, vchSig));
+        });
+
+        bench::Run("LLC/Falcon/Verify", 100, [&]()
+        {
+            for(uint32_t n = 0; n < 100; ++n)
+                REQUIRE(key.Verify(vData, vchSig));
+        });
+    }
+
+    debug::log(0, "===== End Signature Benchmarks =====\n");
+}
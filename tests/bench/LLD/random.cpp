@@ -0,0 +1,84 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#include <bench/harness.h>
+
+#include <LLC/include/random.h>
+
+#include <LLD/templates/sector.h>
+#include <LLD/cache/binary_lru.h>
+#include <LLD/keychain/hashmap.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/parallel.h>
+
+#include <unit/catch2/catch.hpp>
+
+TEST_CASE( "LLD Random Access Benchmarks", "[LLD]")
+{
+    debug::log(0, "===== Begin LLD Random Access Benchmarks =====");
+
+    /* The value size of a typical register. */
+    const std::vector<uint8_t> vValue(256, 0xaa);
+
+    /* Databases of increasing size with a 1MB cache, so larger ones are read mostly from disk. */
+    for(const uint32_t nRecords : { 10000u, 100000u })
+    {
+        const std::string strSize = std::to_string(nRecords);
+
+        LLD::SectorDatabase<LLD::BinaryHashMap, LLD::BinaryLRU> db("_BENCH_" + strSize,
+            LLD::FLAGS::CREATE | LLD::FLAGS::WRITE, nRecords / 4, 1024 * 1024);
+
+        /* Write every record once, timing each tenth as a sample. */
+        uint32_t nWritten = 0;
+        bench::Run("LLD/Write/" + strSize, nRecords / 10, [&]()
+        {
+            for(uint32_t n = 0; n < nRecords / 10; ++n, ++nWritten)
+                REQUIRE(db.Write(std::make_pair(std::string("bench"), uint64_t(nWritten % nRecords)), vValue));
+        }, 10, 0);
+
+        /* Random keys to read, the same for every thread count. */
+        const uint32_t nReads = 20000;
+
+        std::vector<uint64_t> vKeys(nReads);
+        for(auto& nKey : vKeys)
+            nKey = LLC::GetRand(nRecords);
+
+        for(const uint32_t nThreads : { 1u, 2u, 4u, 8u })
+        {
+            bench::Run("LLD/Read/" + strSize + "/threads/" + std::to_string(nThreads), nReads, [&]()
+            {
+                ParallelFor(nReads, nThreads, [&](const uint32_t n)
+                {
+                    std::vector<uint8_t> vRead;
+                    db.Read(std::make_pair(std::string("bench"), vKeys[n]), vRead);
+                });
+            }, 5);
+        }
+
+        /* Overwrite random records from several threads. */
+        for(const uint32_t nThreads : { 1u, 4u })
+        {
+            bench::Run("LLD/Overwrite/" + strSize + "/threads/" + std::to_string(nThreads), nReads, [&]()
+            {
+                ParallelFor(nReads, nThreads, [&](const uint32_t n)
+                {
+                    db.Write(std::make_pair(std::string("bench"), vKeys[n]), vValue);
+                });
+            }, 5);
+        }
+    }
+
+    debug::log(0, "===== End LLD Random Access Benchmarks =====\n");
+}
@@ -0,0 +1,110 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#include <bench/harness.h>
+
+#include <LLP/types/apinode.h>
+
+#include <TAO/API/include/global.h>
+
+#include <Util/include/args.h>
+#include <Util/include/debug.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+/* Read one HTTP response from a socket, returning its status line. */
+static std::string read_response(LLP::Socket& socket)
+{
+    std::string strResponse;
+    std::string::size_type nHeader = std::string::npos;
+    uint64_t nLength = 0;
+
+    while(true)
+    {
+        const int32_t nAvailable = socket.Available();
+        if(nAvailable > 0)
+        {
+            std::vector<uint8_t> vData(nAvailable);
+            const int32_t nRead = socket.Read(vData, nAvailable);
+            if(nRead > 0)
+                strResponse.append(vData.begin(), vData.begin() + nRead);
+        }
+
+        /* Find the end of the header and the length of the content. */
+        if(nHeader == std::string::npos)
+        {
+            nHeader = strResponse.find("\r\n\r\n");
+            if(nHeader == std::string::npos)
+                continue;
+
+            const std::string::size_type nPos = strResponse.find("Content-Length: ");
+            if(nPos != std::string::npos && nPos < nHeader)
+                nLength = std::stoull(strResponse.substr(nPos + 16));
+        }
+
+        if(strResponse.size() >= nHeader + 4 + nLength)
+            return strResponse.substr(0, strResponse.find("\r\n"));
+    }
+}
+
+
+TEST_CASE( "API Request Benchmarks", "[API]")
+{
+    debug::log(0, "===== Begin API Request Benchmarks =====");
+
+    /* Requests are timed without authorization, which is a base64 compare. */
+    config::mapArgs["-apiauth"] = "0";
+
+    if(!TAO::API::system)
+        TAO::API::system = new TAO::API::System();
+
+    LLP::Socket client;
+    LLP::APINode node(bench::Loopback(client), nullptr);
+    REQUIRE_FALSE(node.IsNull());
+
+    /* Round trip requests one at a time, answering them on the same thread as a data thread would. */
+    for(const std::string& strRequest : { std::string("/metrics"), std::string("/system/get/trace?seconds=1") })
+    {
+        const std::string strHTTP = "GET " + strRequest + " HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n";
+        const std::vector<uint8_t> vRequest(strHTTP.begin(), strHTTP.end());
+
+        const uint32_t nRequests = 1000;
+        bench::Run("API/Request" + strRequest.substr(0, strRequest.find('?')), nRequests, [&]()
+        {
+            for(uint32_t n = 0; n < nRequests; ++n)
+            {
+                client.Write(vRequest, vRequest.size());
+                while(client.Buffered())
+                    client.Flush();
+
+                while(!node.PacketComplete())
+                    node.ReadPacket();
+
+                node.ProcessPacket();
+                node.ResetPacket();
+
+                while(node.Buffered())
+                    node.Flush();
+
+                REQUIRE(read_response(client) == "HTTP/1.1 200 OK");
+            }
+        });
+    }
+
+    client.Close();
+    node.Close();
+
+    debug::log(0, "===== End API Request Benchmarks =====\n");
+}
@@ -0,0 +1,99 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#include <bench/harness.h>
+
+#include <LLP/templates/connection.h>
+
+#include <Util/include/debug.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <thread>
+
+
+/* Connection that only reads packets, so they can be timed without a server. */
+class BenchConnection : public LLP::Connection
+{
+public:
+
+    BenchConnection()
+    : LLP::Connection()
+    {
+    }
+
+    BenchConnection(const LLP::Socket& SOCKET_IN)
+    : LLP::Connection(SOCKET_IN, nullptr)
+    {
+    }
+
+    void Event(uint8_t EVENT, uint32_t LENGTH = 0) final
+    {
+    }
+
+    bool ProcessPacket() final
+    {
+        return true;
+    }
+};
+
+
+TEST_CASE( "LLP Loopback Benchmarks", "[LLP]")
+{
+    debug::log(0, "===== Begin LLP Loopback Benchmarks =====");
+
+    BenchConnection client;
+    BenchConnection server(bench::Loopback(client));
+    REQUIRE_FALSE(server.IsNull());
+
+    /* Stream packets from one thread and build them on the other, as a data thread would. */
+    for(const uint32_t nSize : { 64u, 1024u, 65536u })
+    {
+        LLP::Packet packet(0x10);
+        packet.LENGTH = nSize;
+        packet.DATA   = std::vector<uint8_t>(nSize, 0x77);
+
+        const uint32_t nPackets = std::max(100u, 1000000u / nSize);
+        bench::Run("LLP/Loopback/" + std::to_string(nSize), nPackets, [&]()
+        {
+            std::thread thread([&]()
+            {
+                for(uint32_t n = 0; n < nPackets; ++n)
+                {
+                    client.WritePacket(packet);
+                    while(client.Buffered())
+                        client.Flush();
+                }
+            });
+
+            uint32_t nReceived = 0;
+            while(nReceived < nPackets)
+            {
+                server.ReadPacket();
+                if(server.PacketComplete())
+                {
+                    server.ResetPacket();
+                    ++nReceived;
+                }
+            }
+
+            thread.join();
+        });
+    }
+
+    client.Close();
+    server.Close();
+
+    debug::log(0, "===== End LLP Loopback Benchmarks =====\n");
+}
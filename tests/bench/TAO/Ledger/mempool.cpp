@@ -0,0 +1,140 @@
+#include <Util/include/runtime.h>
+
+#include <bench/harness.h>
+
+#include <LLC/include/random.h>
+
+#include <LLD/cache/template_lru.h>
+
+#include <LLD/include/version.h>
+
+#include <Util/templates/datastream.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+#include <LLC/include/random.h>
+
+#include <TAO/Ledger/types/mempool.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/runtime.h>
+
+#include <unit/catch2/catch.hpp>
+
+TEST_CASE( "Mempool Benchmarks", "[ledger]")
+{
+    debug::log(0, "===== Begin Mempool Benchmarks =====");
+
+    /* Sigchains with a queue of pending transactions each. */
+    const uint32_t nChains = 5000;
+    const uint32_t nQueue  = 8;
+
+    TAO::Ledger::Mempool pool;
+
+    std::vector<uint256_t> vGenesis;
+    std::vector<uint512_t> vHashes;
+    {
+        /* Build the transactions first so only the pool is timed. */
+        std::vector<TAO::Ledger::Transaction> vtx;
+        for(uint32_t n = 0; n < nChains; ++n)
+        {
+            vGenesis.push_back(LLC::GetRand256());
+
+            uint512_t hashPrev = 0;
+            for(uint32_t i = 0; i < nQueue; ++i)
+            {
+                TAO::Ledger::Transaction tx;
+                tx.hashGenesis = vGenesis.back();
+                tx.nSequence   = i;
+                tx.hashPrevTx  = hashPrev;
+                tx.nTimestamp  = runtime::unifiedtimestamp() + i;
+
+                hashPrev = tx.GetHash();
+                vHashes.push_back(hashPrev);
+                vtx.push_back(tx);
+            }
+        }
+
+        runtime::timer timer;
+        timer.Start();
+
+        for(const auto& tx : vtx)
+            pool.AddUnchecked(tx);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "AddUnchecked::", ANSI_COLOR_RESET, vtx.size() * 1.0 / nTime, " million tx / second");
+
+        /* Repeat into empty pools for the spread across samples. */
+        bench::Run("TAO/Mempool/AddUnchecked", vtx.size(), [&]()
+        {
+            TAO::Ledger::Mempool poolSample;
+            for(const auto& tx : vtx)
+                poolSample.AddUnchecked(tx);
+
+            REQUIRE(poolSample.Size() == vtx.size());
+        });
+    }
+
+    REQUIRE(pool.Size() == nChains * nQueue);
+
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(const auto& hash : vHashes)
+        {
+            TAO::Ledger::Transaction tx;
+            REQUIRE(pool.Get(hash, tx));
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Get(txid)::", ANSI_COLOR_RESET, vHashes.size() * 1.0 / nTime, " million lookups / second");
+    }
+
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(const auto& hashGenesis : vGenesis)
+        {
+            TAO::Ledger::Transaction tx;
+            REQUIRE(pool.Has(hashGenesis));
+            REQUIRE(pool.Get(hashGenesis, tx));
+            REQUIRE(tx.nSequence == nQueue - 1);
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Get(genesis)::", ANSI_COLOR_RESET, vGenesis.size() * 1000.0 / nTime, " thousand lookups / second");
+    }
+
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        std::vector<uint512_t> vList;
+        REQUIRE(pool.List(vList));
+        REQUIRE(vList.size() == vHashes.size());
+
+        uint64_t nTime = timer.ElapsedMilliseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "List::", ANSI_COLOR_RESET, vList.size(), " tx in ", nTime, " ms");
+    }
+
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(const auto& hash : vHashes)
+        {
+            REQUIRE(pool.Remove(hash));
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Remove::", ANSI_COLOR_RESET, vHashes.size() * 1.0 / nTime, " million tx / second");
+    }
+
+    REQUIRE(pool.Size() == 0);
+    REQUIRE_FALSE(pool.Has(vGenesis[0]));
+
+    debug::log(0, "===== End Mempool Benchmarks =====\n");
+}
@@ -31,6 +31,9 @@
 #include <Legacy/include/evaluate.h>
 
 #include <TAO/Register/types/address.h>
+#include <TAO/Register/include/enum.h>
+
+#include <bench/harness.h>
 
 
 TEST_CASE( "Validation Script Benchmarks", "[operation]")
@@ -66,7 +69,7 @@ TEST_CASE( "Validation Script Benchmarks", "[operation]")
             for(int i = 0; i < 1000000; i++)
             {
                 REQUIRE(script.Execute());
-                script.Reset();
+                script.reset();
             }
         }
 
@@ -91,7 +94,7 @@ TEST_CASE( "Validation Script Benchmarks", "[operation]")
             for(int i = 0; i < 1000000; i++)
             {
                 REQUIRE(script.Execute());
-                script.Reset();
+                script.reset();
             }
         }
 
@@ -117,7 +120,7 @@ TEST_CASE( "Validation Script Benchmarks", "[operation]")
             for(int i = 0; i < 1000000; i++)
             {
                 REQUIRE(script.Execute());
-                script.Reset();
+                script.reset();
             }
         }
 
@@ -143,7 +146,7 @@ TEST_CASE( "Validation Script Benchmarks", "[operation]")
             for(int i = 0; i < 1000000; i++)
             {
                 REQUIRE(script.Execute());
-                script.Reset();
+                script.reset();
             }
         }
 
@@ -169,7 +172,7 @@ TEST_CASE( "Validation Script Benchmarks", "[operation]")
             for(int i = 0; i < 1000000; i++)
             {
                 REQUIRE(script.Execute());
-                script.Reset();
+                script.reset();
             }
         }
 
@@ -195,7 +198,7 @@ TEST_CASE( "Validation Script Benchmarks", "[operation]")
             for(int i = 0; i < 1000000; i++)
             {
                 REQUIRE(script.Execute());
-                script.Reset();
+                script.reset();
             }
         }
 
@@ -221,7 +224,7 @@ TEST_CASE( "Validation Script Benchmarks", "[operation]")
             for(int i = 0; i < 1000000; i++)
             {
                 REQUIRE(script.Execute());
-                script.Reset();
+                script.reset();
             }
         }
 
@@ -247,7 +250,7 @@ TEST_CASE( "Validation Script Benchmarks", "[operation]")
             for(int i = 0; i < 1000000; i++)
             {
                 REQUIRE(script.Execute());
-                script.Reset();
+                script.reset();
             }
         }
 
@@ -274,7 +277,7 @@ TEST_CASE( "Validation Script Benchmarks", "[operation]")
             for(int i = 0; i < 1000000; i++)
             {
                 REQUIRE(script.Execute());
-                script.Reset();
+                script.reset();
             }
         }
 
@@ -288,3 +291,117 @@ TEST_CASE( "Validation Script Benchmarks", "[operation]")
     debug::log(0, "===== End Validation Script Benchmarks =====\n");
 
 }
+
+
+TEST_CASE( "Condition Decode Benchmarks", "[operation]")
+{
+    using namespace TAO::Operation;
+
+    debug::log(0, "===== Begin Condition Decode Benchmarks =====");
+
+    /* A register for the condition to read, kept in the LLD cache. */
+    const uint256_t hashRegister = TAO::Register::Address(TAO::Register::Address::ACCOUNT);
+    const uint256_t hashCaller   = LLC::GetRand256();
+    {
+        TAO::Register::State state(std::vector<uint8_t>(64, 0xab), TAO::Register::REGISTER::READONLY, hashCaller);
+        REQUIRE(LLD::Register->WriteState(hashRegister, state));
+    }
+
+    TAO::Ledger::Transaction txCaller;
+    txCaller.nTimestamp  = 2000;
+    txCaller.hashGenesis = hashCaller;
+    txCaller[0] << uint8_t(OP::CLAIM) << LLC::GetRand512() << uint32_t(0) << hashRegister;
+    txCaller[0].Bind(&txCaller);
+
+    const Contract& caller = txCaller[0];
+
+    /* The expiration condition the API adds to debits and transfers, with a literal in place of the ledger time. */
+    TAO::Ledger::Transaction tx;
+    tx.nTimestamp  = 1000;
+    tx.hashGenesis = LLC::GetRand256();
+    tx[0] << uint8_t(OP::TRANSFER) << hashRegister << hashCaller << uint8_t(TRANSFER::CLAIM);
+
+    Contract& contract = tx[0];
+    contract <= uint8_t(OP::GROUP);
+    contract <= uint8_t(OP::CALLER::GENESIS) <= uint8_t(OP::NOTEQUALS) <= uint8_t(OP::TYPES::UINT256_T) <= hashCaller;
+    contract <= uint8_t(OP::AND);
+    contract <= uint8_t(OP::CONTRACT::TIMESTAMP) <= uint8_t(OP::ADD) <= uint8_t(OP::TYPES::UINT64_T) <= uint64_t(86400);
+    contract <= uint8_t(OP::GREATERTHAN) <= uint8_t(OP::TYPES::UINT64_T) <= uint64_t(5000);
+    contract <= uint8_t(OP::UNGROUP);
+    contract <= uint8_t(OP::OR);
+    contract <= uint8_t(OP::GROUP);
+    contract <= uint8_t(OP::CALLER::GENESIS) <= uint8_t(OP::EQUALS) <= uint8_t(OP::TYPES::UINT256_T) <= hashCaller;
+    contract <= uint8_t(OP::AND);
+    contract <= uint8_t(OP::CONTRACT::TIMESTAMP) <= uint8_t(OP::ADD) <= uint8_t(OP::TYPES::UINT64_T) <= uint64_t(86400);
+    contract <= uint8_t(OP::GREATERTHAN) <= uint8_t(OP::TYPES::UINT64_T) <= uint64_t(5000);
+    contract <= uint8_t(OP::UNGROUP);
+    contract.Bind(&tx);
+
+    /* Walking the condition stream the way the VM reads it, which is all a pre-decoded op cache would save. */
+    bench::Run("TAO/Condition/Decode", 10000, [&]()
+    {
+        uint64_t nOps = 0;
+        for(uint32_t n = 0; n < 10000; ++n)
+        {
+            contract.Reset(Contract::CONDITIONS);
+            while(!contract.End(Contract::CONDITIONS))
+            {
+                uint8_t OPERATION = 0;
+                contract >= OPERATION;
+
+                if(OPERATION == OP::TYPES::UINT256_T)
+                {
+                    uint256_t hashValue;
+                    contract >= hashValue;
+                }
+                else if(OPERATION == OP::TYPES::UINT64_T)
+                {
+                    uint64_t nValue = 0;
+                    contract >= nValue;
+                }
+
+                ++nOps;
+            }
+        }
+
+        REQUIRE(nOps > 0);
+    });
+
+    bench::Run("TAO/Condition/Expiration", 10000, [&]()
+    {
+        for(uint32_t n = 0; n < 10000; ++n)
+        {
+            Condition condition = Condition(contract, caller);
+            REQUIRE(condition.Execute());
+        }
+    });
+
+    /* One register read next to the same comparison on a literal. */
+    Contract contractLiteral;
+    contractLiteral <= uint8_t(OP::TYPES::UINT256_T) <= hashCaller;
+    contractLiteral <= uint8_t(OP::EQUALS) <= uint8_t(OP::TYPES::UINT256_T) <= hashCaller;
+
+    bench::Run("TAO/Condition/Literal", 10000, [&]()
+    {
+        for(uint32_t n = 0; n < 10000; ++n)
+        {
+            Condition condition = Condition(contractLiteral, caller);
+            REQUIRE(condition.Execute());
+        }
+    });
+
+    Contract contractRegister;
+    contractRegister <= uint8_t(OP::TYPES::UINT256_T) <= hashRegister <= uint8_t(OP::REGISTER::OWNER);
+    contractRegister <= uint8_t(OP::EQUALS) <= uint8_t(OP::TYPES::UINT256_T) <= hashCaller;
+
+    bench::Run("TAO/Condition/RegisterOwner", 10000, [&]()
+    {
+        for(uint32_t n = 0; n < 10000; ++n)
+        {
+            Condition condition = Condition(contractRegister, caller);
+            REQUIRE(condition.Execute());
+        }
+    });
+
+    debug::log(0, "===== End Condition Decode Benchmarks =====\n");
+}
@@ -1,3 +1,5 @@
+#include <bench/harness.h>
+
 #include <Util/include/runtime.h>
 
 #include <TAO/Register/types/object.h>
@@ -19,21 +21,17 @@ TEST_CASE( "Object Register Benchmarks", "[register]")
     debug::log(0, "===== Begin Object Register Benchmarks =====");
 
     //benchmarks
+    bench::Run("TAO/Object/Parse", 100000, [&]()
     {
-        runtime::timer timer;
-        timer.Start();
-
-        for(int i = 0; i < 1000000; i++)
+        bool fParsed = true;
+        for(int i = 0; i < 100000; i++)
         {
-            object.mapData.clear();
-            REQUIRE(object.Parse());
+            object.pLayout.reset();
+            fParsed = object.Parse() && fParsed;
         }
 
-        uint64_t nTime = timer.ElapsedMicroseconds();
-
-        //5000000 -> 5 times 1000000 for microseconds -> 5 for the number of values in this object register
-        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Parse::", ANSI_COLOR_RESET, 5000000.0 / nTime, " million values / second");
-    }
+        REQUIRE(fParsed);
+    });
 
 
 
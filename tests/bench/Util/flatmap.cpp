@@ -0,0 +1,83 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#include <bench/harness.h>
+
+#include <LLC/include/random.h>
+#include <LLC/types/uint1024.h>
+
+#include <Util/include/debug.h>
+#include <Util/templates/flatmap.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+
+/* Insert every key, look each up, then erase each, as the mempool does over a transaction's life. */
+template<typename MapType>
+static void run(const std::string& strName, const std::vector<uint512_t>& vKeys)
+{
+    const uint64_t nCount = vKeys.size();
+
+    bench::Run("Util/" + strName + "/Insert", nCount, [&]()
+    {
+        MapType map;
+        for(const auto& hash : vKeys)
+            map[hash] = 1;
+
+        REQUIRE(map.size() == nCount);
+    });
+
+    MapType map;
+    for(const auto& hash : vKeys)
+        map[hash] = 1;
+
+    bench::Run("Util/" + strName + "/Find", nCount, [&]()
+    {
+        uint64_t nFound = 0;
+        for(const auto& hash : vKeys)
+            nFound += map.count(hash);
+
+        REQUIRE(nFound == nCount);
+    });
+
+    bench::Run("Util/" + strName + "/Erase", nCount, [&]()
+    {
+        MapType mapErase = map;
+        for(const auto& hash : vKeys)
+            mapErase.erase(hash);
+
+        REQUIRE(mapErase.empty());
+    });
+}
+
+
+TEST_CASE( "Flat Map Benchmarks", "[flatmap]")
+{
+    debug::log(0, "===== Begin Flat Map Benchmarks =====");
+
+    /* About the size of a busy mempool. */
+    std::vector<uint512_t> vKeys;
+    for(uint32_t n = 0; n < 100000; ++n)
+        vKeys.push_back(LLC::GetRand512());
+
+    run<std::map<uint512_t, uint32_t>>("Map", vKeys);
+    run<std::unordered_map<uint512_t, uint32_t>>("UnorderedMap", vKeys);
+    run<FlatMap<uint512_t, uint32_t>>("FlatMap", vKeys);
+
+    debug::log(0, "===== End Flat Map Benchmarks =====\n");
+}
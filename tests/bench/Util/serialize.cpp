@@ -0,0 +1,114 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#include <bench/harness.h>
+
+#include <LLC/include/random.h>
+
+#include <LLP/include/version.h>
+
+#include <TAO/Operation/include/enum.h>
+#include <TAO/Register/include/enum.h>
+
+#include <TAO/Ledger/types/transaction.h>
+#include <TAO/Ledger/types/tritium.h>
+
+#include <Util/include/debug.h>
+#include <Util/templates/datastream.h>
+
+#include <unit/catch2/catch.hpp>
+
+TEST_CASE( "Serialization Benchmarks", "[serialize]")
+{
+    using namespace TAO::Operation;
+
+    debug::log(0, "===== Begin Serialization Benchmarks =====");
+
+    /* A transaction the size of a falcon signed sigchain transaction with two contracts. */
+    TAO::Ledger::Transaction tx;
+    tx.hashGenesis = LLC::GetRand256();
+    tx.nSequence   = 7;
+    tx.hashPrevTx  = LLC::GetRand512();
+    tx.vchPubKey   = std::vector<uint8_t>(897, 0x33);
+    tx.vchSig      = std::vector<uint8_t>(690, 0x44);
+    tx[0] << uint8_t(OP::CREATE) << LLC::GetRand256() << uint8_t(TAO::Register::REGISTER::READONLY) << std::vector<uint8_t>(32, 0xff);
+    tx[1] << uint8_t(OP::DEBIT) << LLC::GetRand256() << LLC::GetRand256() << uint64_t(1000) << uint64_t(0);
+
+    {
+        DataStream ssTx(SER_NETWORK, LLP::PROTOCOL_VERSION);
+        ssTx << tx;
+
+        const uint32_t nCount = 10000;
+        bench::Run("Util/Serialize/Transaction", nCount, [&]()
+        {
+            for(uint32_t n = 0; n < nCount; ++n)
+            {
+                DataStream ssWrite(SER_NETWORK, LLP::PROTOCOL_VERSION);
+                ssWrite << tx;
+
+                REQUIRE(ssWrite.size() == ssTx.size());
+            }
+        });
+
+        bench::Run("Util/Deserialize/Transaction", nCount, [&]()
+        {
+            for(uint32_t n = 0; n < nCount; ++n)
+            {
+                DataStream ssRead(ssTx.Bytes(), SER_NETWORK, LLP::PROTOCOL_VERSION);
+
+                TAO::Ledger::Transaction txRead;
+                ssRead >> txRead;
+            }
+        });
+    }
+
+    /* A block with a thousand transactions. */
+    TAO::Ledger::TritiumBlock block;
+    block.hashPrevBlock  = LLC::GetRand1024();
+    block.hashMerkleRoot = LLC::GetRand512();
+    block.vchBlockSig    = std::vector<uint8_t>(690, 0x55);
+    block.producer       = tx;
+    for(uint32_t n = 0; n < 1000; ++n)
+        block.vtx.push_back(std::make_pair(uint8_t(0), LLC::GetRand512()));
+
+    {
+        DataStream ssBlock(SER_NETWORK, LLP::PROTOCOL_VERSION);
+        ssBlock << block;
+
+        const uint32_t nCount = 200;
+        bench::Run("Util/Serialize/TritiumBlock", nCount, [&]()
+        {
+            for(uint32_t n = 0; n < nCount; ++n)
+            {
+                DataStream ssWrite(SER_NETWORK, LLP::PROTOCOL_VERSION);
+                ssWrite << block;
+
+                REQUIRE(ssWrite.size() == ssBlock.size());
+            }
+        });
+
+        bench::Run("Util/Deserialize/TritiumBlock", nCount, [&]()
+        {
+            for(uint32_t n = 0; n < nCount; ++n)
+            {
+                DataStream ssRead(ssBlock.Bytes(), SER_NETWORK, LLP::PROTOCOL_VERSION);
+
+                TAO::Ledger::TritiumBlock blockRead;
+                ssRead >> blockRead;
+            }
+        });
+    }
+
+    debug::log(0, "===== End Serialization Benchmarks =====\n");
+}
@@ -0,0 +1,198 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <bench/harness.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/json.h>
+#include <Util/include/mutex.h>
+#include <Util/include/runtime.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace bench
+{
+
+    /* The default number of samples. */
+    const uint32_t SAMPLES = 10;
+
+    /* The default number of warmup runs. */
+    const uint32_t WARMUP  = 2;
+
+
+    /* Mutex to protect the results. */
+    static std::mutex RESULTS_MUTEX;
+
+    /* The results of every benchmark run so far. */
+    static std::vector<Result> vResults;
+
+
+    /* Read a number from the environment. */
+    static uint32_t environment(const char* pName, const uint32_t nDefault)
+    {
+        const char* pValue = std::getenv(pName);
+        if(pValue == nullptr || *pValue == 0)
+            return nDefault;
+
+        return static_cast<uint32_t>(std::strtoul(pValue, nullptr, 10));
+    }
+
+
+    /* Write every result to the JSON file. Requires RESULTS_MUTEX. */
+    static void write()
+    {
+        const char* pPath = std::getenv("NEXUS_BENCH_JSON");
+        const std::string strPath = (pPath && *pPath) ? pPath : "bench.json";
+
+        json::json jsonResults = json::json::array();
+        for(const auto& result : vResults)
+        {
+            json::json jsonResult;
+            jsonResult["name"]           = result.strName;
+            jsonResult["ops"]            = result.nOps;
+            jsonResult["samples"]        = result.nSamples;
+            jsonResult["min_ns"]         = result.dMin;
+            jsonResult["median_ns"]      = result.dMedian;
+            jsonResult["mean_ns"]        = result.dMean;
+            jsonResult["stddev_ns"]      = result.dStdDev;
+            jsonResult["ci95_ns"]        = result.dConfidence;
+            jsonResult["max_ns"]         = result.dMax;
+            jsonResult["ops_per_second"] = result.OpsPerSecond();
+
+            jsonResults.push_back(jsonResult);
+        }
+
+        json::json jsonOut;
+        jsonOut["timestamp"]  = runtime::timestamp();
+        jsonOut["benchmarks"] = jsonResults;
+
+        std::ofstream stream(strPath, std::ios::out | std::ios::trunc);
+        if(!stream)
+        {
+            debug::error(FUNCTION, "failed to open ", strPath);
+            return;
+        }
+
+        stream << jsonOut.dump(4) << std::endl;
+    }
+
+
+    /* Run a benchmark, log it and add it to the JSON output. */
+    Result Run(const std::string& strName, const uint64_t nOps, const std::function<void()>& fnSample,
+               const uint32_t nSamples, const int32_t nWarmup)
+    {
+        const uint32_t nRuns   = std::max(1u, nSamples > 0 ? nSamples : environment("NEXUS_BENCH_SAMPLES", SAMPLES));
+        const uint32_t nWarmed = nWarmup >= 0 ? nWarmup : environment("NEXUS_BENCH_WARMUP", WARMUP);
+
+        /* Warm the caches and branch predictors without timing. */
+        for(uint32_t n = 0; n < nWarmed; ++n)
+            fnSample();
+
+        /* Time each sample in nanoseconds per operation. */
+        std::vector<double> vSamples;
+        vSamples.reserve(nRuns);
+        for(uint32_t n = 0; n < nRuns; ++n)
+        {
+            const auto tStart = std::chrono::steady_clock::now();
+            fnSample();
+            const auto tEnd   = std::chrono::steady_clock::now();
+
+            const double dElapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(tEnd - tStart).count();
+            vSamples.push_back(dElapsed / std::max(uint64_t(1), nOps));
+        }
+        std::sort(vSamples.begin(), vSamples.end());
+
+        /* Build the statistics. */
+        Result result;
+        result.strName  = strName;
+        result.nOps     = nOps;
+        result.nSamples = nRuns;
+        result.dMin     = vSamples.front();
+        result.dMax     = vSamples.back();
+        result.dMedian  = (nRuns % 2) ? vSamples[nRuns / 2] : (vSamples[nRuns / 2 - 1] + vSamples[nRuns / 2]) / 2;
+
+        double dSum = 0;
+        for(const auto& dSample : vSamples)
+            dSum += dSample;
+        result.dMean = dSum / nRuns;
+
+        double dSquares = 0;
+        for(const auto& dSample : vSamples)
+            dSquares += (dSample - result.dMean) * (dSample - result.dMean);
+        result.dStdDev     = nRuns > 1 ? std::sqrt(dSquares / (nRuns - 1)) : 0;
+        result.dConfidence = 1.96 * result.dStdDev / std::sqrt(double(nRuns));
+
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, strName, "::", ANSI_COLOR_RESET,
+            uint64_t(result.OpsPerSecond()), " ops / second (median ", result.dMedian, " ns +/- ",
+            result.dConfidence, " ns, ", nRuns, " samples)");
+
+        LOCK(RESULTS_MUTEX);
+        vResults.push_back(result);
+        write();
+
+        return result;
+    }
+
+
+    /* Connect a socket to a listener on the loopback interface and accept it. */
+    LLP::Socket Loopback(LLP::Socket& socketClient)
+    {
+        /* Listen on any free port. */
+        int32_t hListen = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if(hListen == SOCKET_ERROR)
+            return LLP::Socket();
+
+        struct sockaddr_in sockaddrListen;
+        std::memset(&sockaddrListen, 0, sizeof(sockaddrListen));
+        sockaddrListen.sin_family      = AF_INET;
+        sockaddrListen.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        sockaddrListen.sin_port        = 0;
+
+        socklen_t nLength = sizeof(sockaddrListen);
+        if(bind(hListen, (struct sockaddr*)&sockaddrListen, sizeof(sockaddrListen)) == SOCKET_ERROR
+        || listen(hListen, 1) == SOCKET_ERROR
+        || getsockname(hListen, (struct sockaddr*)&sockaddrListen, &nLength) == SOCKET_ERROR)
+        {
+            closesocket(hListen);
+            return LLP::Socket();
+        }
+
+        /* Connect and accept. */
+        struct sockaddr_in sockaddrPeer;
+        std::memset(&sockaddrPeer, 0, sizeof(sockaddrPeer));
+
+        int32_t hSocket = SOCKET_ERROR;
+        if(socketClient.Attempt(LLP::BaseAddress(sockaddrListen)))
+        {
+            socklen_t nPeer = sizeof(sockaddrPeer);
+            hSocket = accept(hListen, (struct sockaddr*)&sockaddrPeer, &nPeer);
+        }
+
+        closesocket(hListen);
+        if(hSocket == SOCKET_ERROR)
+            return LLP::Socket();
+
+        /* Don't let Nagle hold back small packets. */
+        int32_t nNoDelay = 1;
+        setsockopt(hSocket, IPPROTO_TCP, TCP_NODELAY, (const char*)&nNoDelay, sizeof(nNoDelay));
+        setsockopt(socketClient.fd, IPPROTO_TCP, TCP_NODELAY, (const char*)&nNoDelay, sizeof(nNoDelay));
+
+        return LLP::Socket(hSocket, LLP::BaseAddress(sockaddrPeer));
+    }
+}
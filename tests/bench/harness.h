@@ -0,0 +1,121 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_TESTS_BENCH_HARNESS_H
+#define NEXUS_TESTS_BENCH_HARNESS_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include <LLP/templates/socket.h>
+
+
+/** Bench
+ *
+ *  Harness for the benchmarks. Each benchmark runs a batch of operations a number of times after some warmup
+ *  runs, and the spread of the samples is reported alongside the median so two runs can be compared.
+ *
+ *  Results are logged and written as JSON to the file named by NEXUS_BENCH_JSON, bench.json by default.
+ *  NEXUS_BENCH_SAMPLES and NEXUS_BENCH_WARMUP override the number of runs.
+ *
+ **/
+namespace bench
+{
+
+    /** Result
+     *
+     *  The statistics of one benchmark, in nanoseconds per operation.
+     *
+     **/
+    struct Result
+    {
+        /** The name of the benchmark. **/
+        std::string strName;
+
+
+        /** The number of operations in each sample. **/
+        uint64_t nOps;
+
+
+        /** The number of samples taken, not counting warmup. **/
+        uint32_t nSamples;
+
+
+        /** The fastest sample. **/
+        double dMin;
+
+
+        /** The median sample. **/
+        double dMedian;
+
+
+        /** The mean of the samples. **/
+        double dMean;
+
+
+        /** The sample standard deviation. **/
+        double dStdDev;
+
+
+        /** Half the width of the 95% confidence interval of the mean. **/
+        double dConfidence;
+
+
+        /** The slowest sample. **/
+        double dMax;
+
+
+        /** OpsPerSecond
+         *
+         *  @return The throughput at the median.
+         *
+         **/
+        double OpsPerSecond() const
+        {
+            return dMedian > 0 ? 1000000000.0 / dMedian : 0;
+        }
+    };
+
+
+    /** Run
+     *
+     *  Run a benchmark, log it and add it to the JSON output.
+     *
+     *  @param[in] strName The name of the benchmark, such as LLC/SK256/1024.
+     *  @param[in] nOps The number of operations one call to the function does.
+     *  @param[in] fnSample The function to time, called once per sample.
+     *  @param[in] nSamples The number of samples, 0 for the default.
+     *  @param[in] nWarmup The number of untimed runs first, -1 for the default.
+     *
+     *  @return The statistics of the samples.
+     *
+     **/
+    Result Run(const std::string& strName, const uint64_t nOps, const std::function<void()>& fnSample,
+               const uint32_t nSamples = 0, const int32_t nWarmup = -1);
+
+
+    /** Loopback
+     *
+     *  Connect a socket to a listener on the loopback interface and accept it.
+     *
+     *  @param[out] socketClient The connecting side.
+     *
+     *  @return The accepted side, null if the connection failed.
+     *
+     **/
+    LLP::Socket Loopback(LLP::Socket& socketClient);
+}
+
+#endif
@@ -0,0 +1,346 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#include <LLC/types/uint1024.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    /* The 32-bit word loops base_uint used before its fast paths, kept as the reference the results must match. */
+    template<uint32_t WIDTH>
+    struct Reference
+    {
+        std::array<uint32_t, WIDTH> pn;
+
+
+        static Reference From(const base_uint<WIDTH * 32>& n)
+        {
+            Reference ret;
+            std::memcpy(ret.pn.data(), n.begin(), WIDTH * 4);
+
+            return ret;
+        }
+
+
+        base_uint<WIDTH * 32> Get() const
+        {
+            base_uint<WIDTH * 32> ret;
+            std::memcpy(ret.begin(), pn.data(), WIDTH * 4);
+
+            return ret;
+        }
+
+
+        int32_t Compare(const Reference& b) const
+        {
+            for(int32_t i = WIDTH - 1; i >= 0; --i)
+            {
+                if(pn[i] < b.pn[i])
+                    return -1;
+                else if(pn[i] > b.pn[i])
+                    return 1;
+            }
+
+            return 0;
+        }
+
+
+        void Add(const Reference& b)
+        {
+            uint64_t carry = 0;
+            for(uint32_t i = 0; i < WIDTH; ++i)
+            {
+                uint64_t n = carry + pn[i] + b.pn[i];
+                pn[i] = n & 0xffffffff;
+                carry = n >> 32;
+            }
+        }
+
+
+        void Subtract(const Reference& b)
+        {
+            Reference neg;
+            for(uint32_t i = 0; i < WIDTH; ++i)
+                neg.pn[i] = ~b.pn[i];
+
+            uint32_t i = 0;
+            while(++neg.pn[i] == 0 && i < WIDTH - 1)
+                ++i;
+
+            Add(neg);
+        }
+
+
+        void Multiply(const Reference& b)
+        {
+            Reference a;
+            a.pn.fill(0);
+
+            for(uint32_t j = 0; j < WIDTH; j++)
+            {
+                uint64_t carry = 0;
+                for(uint32_t i = 0; i + j < WIDTH; i++)
+                {
+                    uint64_t n = carry + a.pn[i + j] + (uint64_t)pn[j] * b.pn[i];
+                    a.pn[i + j] = n & 0xffffffff;
+                    carry = n >> 32;
+                }
+            }
+            *this = a;
+        }
+
+
+        void ShiftLeft(uint32_t shift)
+        {
+            Reference a = *this;
+            pn.fill(0);
+
+            int32_t k = shift / 32;
+            shift = shift % 32;
+            for(int32_t i = 0; i < int32_t(WIDTH); ++i)
+            {
+                if(i+k+1 < int32_t(WIDTH) && shift != 0)
+                    pn[i+k+1] |= (a.pn[i] >> (32-shift));
+                if(i+k < int32_t(WIDTH))
+                    pn[i+k] |= (a.pn[i] << shift);
+            }
+        }
+
+
+        void ShiftRight(uint32_t shift)
+        {
+            Reference a = *this;
+            pn.fill(0);
+
+            int32_t k = shift / 32;
+            shift = shift % 32;
+            for(int32_t i = 0; i < int32_t(WIDTH); ++i)
+            {
+                if(i-k-1 >= 0 && shift != 0)
+                    pn[i-k-1] |= (a.pn[i] << (32-shift));
+                if(i-k >= 0)
+                    pn[i-k] |= (a.pn[i] >> shift);
+            }
+        }
+
+
+        uint32_t Bits() const
+        {
+            for(int32_t pos = WIDTH - 1; pos >= 0; --pos)
+            {
+                if(pn[pos])
+                {
+                    for(int32_t nbits = 31; nbits > 0; --nbits)
+                    {
+                        if(pn[pos] & 1U << nbits)
+                            return 32 * pos + nbits + 1;
+                    }
+                    return 32 * pos + 1;
+                }
+            }
+
+            return 0;
+        }
+
+
+        void Divide(const Reference& b)
+        {
+            Reference div = b;
+            Reference num = *this;
+            pn.fill(0);
+
+            int num_bits = num.Bits();
+            int div_bits = div.Bits();
+            if(div_bits > num_bits)
+                return;
+
+            int shift = num_bits - div_bits;
+
+            div.ShiftLeft(shift);
+            while(shift >= 0)
+            {
+                if(num.Compare(div) >= 0)
+                {
+                    num.Subtract(div);
+                    pn[shift >> 5] |= (1 << (shift & 31));
+                }
+
+                div.ShiftRight(1);
+                --shift;
+            }
+        }
+    };
+
+
+    /* Deterministic generator so failures can be reproduced. */
+    uint64_t next(uint64_t& nState)
+    {
+        nState ^= nState << 13;
+        nState ^= nState >> 7;
+        nState ^= nState << 17;
+
+        return nState;
+    }
+
+
+    /* Get a number with a random number of significant bits and runs of set and clear words. */
+    template<uint32_t BITS>
+    base_uint<BITS> random(uint64_t& nState)
+    {
+        base_uint<BITS> ret;
+
+        uint32_t* pWords = reinterpret_cast<uint32_t*>(ret.begin());
+        for(uint32_t i = 0; i < BITS / 32; ++i)
+        {
+            const uint64_t nRand = next(nState);
+            switch(nRand % 8)
+            {
+                case 0: pWords[i] = 0;           break;
+                case 1: pWords[i] = 0xffffffff;  break;
+                case 2: pWords[i] = 0x80000000;  break;
+                default: pWords[i] = static_cast<uint32_t>(nRand >> 32);
+            }
+        }
+
+        ret >>= next(nState) % BITS;
+
+        return ret;
+    }
+
+
+    template<uint32_t BITS>
+    void check(const uint32_t nRounds)
+    {
+        typedef Reference<BITS / 32> Ref;
+
+        uint64_t nState = 0x9e3779b97f4a7c15 ^ BITS;
+        for(uint32_t n = 0; n < nRounds; ++n)
+        {
+            const base_uint<BITS> a = random<BITS>(nState);
+            const base_uint<BITS> b = (n % 16 == 0) ? a : random<BITS>(nState);
+
+            const Ref refA = Ref::From(a);
+            const Ref refB = Ref::From(b);
+
+            /* Compare. */
+            const int32_t nCompare = refA.Compare(refB);
+            REQUIRE((a <  b) == (nCompare <  0));
+            REQUIRE((a <= b) == (nCompare <= 0));
+            REQUIRE((a >  b) == (nCompare >  0));
+            REQUIRE((a >= b) == (nCompare >= 0));
+            REQUIRE((a == b) == (nCompare == 0));
+            REQUIRE((a != b) == (nCompare != 0));
+
+            /* Add and subtract, including wrapping around. */
+            Ref refSum = refA;
+            refSum.Add(refB);
+            REQUIRE((a + b) == refSum.Get());
+
+            Ref refDifference = refA;
+            refDifference.Subtract(refB);
+            REQUIRE((a - b) == refDifference.Get());
+
+            /* Add and subtract 64-bit. */
+            const uint64_t n64 = (n % 4 == 0) ? ~uint64_t(0) : next(nState) >> (next(nState) % 64);
+            const Ref ref64 = Ref::From(base_uint<BITS>(n64));
+
+            refSum = refA;
+            refSum.Add(ref64);
+            REQUIRE((a + n64) == refSum.Get());
+
+            refDifference = refA;
+            refDifference.Subtract(ref64);
+            REQUIRE((a - n64) == refDifference.Get());
+
+            /* Multiply. */
+            Ref refProduct = refA;
+            refProduct.Multiply(refB);
+            REQUIRE((a * b) == refProduct.Get());
+
+            refProduct = refA;
+            refProduct.Multiply(ref64);
+            REQUIRE((a * n64) == refProduct.Get());
+
+            /* Shift, including past the width. */
+            const uint32_t nShift = next(nState) % (BITS + 64);
+
+            Ref refShift = refA;
+            refShift.ShiftLeft(nShift);
+            REQUIRE((a << nShift) == refShift.Get());
+
+            refShift = refA;
+            refShift.ShiftRight(nShift);
+            REQUIRE((a >> nShift) == refShift.Get());
+
+            /* Divide. */
+            if(b != 0)
+            {
+                Ref refQuotient = refA;
+                refQuotient.Divide(refB);
+                REQUIRE((a / b) == refQuotient.Get());
+            }
+
+            if(n64 != 0)
+            {
+                Ref refQuotient = refA;
+                refQuotient.Divide(ref64);
+                REQUIRE((a / n64) == refQuotient.Get());
+            }
+
+            /* Bits. */
+            REQUIRE(a.bits() == refA.Bits());
+        }
+    }
+}
+
+
+TEST_CASE("Base Uint Fast Path Tests", "[LLC]")
+{
+    check<256>(20000);
+    check<512>(10000);
+    check<1024>(5000);
+    check<1056>(5000);
+}
+
+
+TEST_CASE("Base Uint Edge Tests", "[LLC]")
+{
+    const uint1056_t nMax = ~uint1056_t(0);
+
+    /* Carries and borrows run the whole width, including the odd top word. */
+    REQUIRE(nMax + 1 == 0);
+    REQUIRE(uint1056_t(0) - 1 == nMax);
+    REQUIRE(nMax + nMax == nMax - 1);
+    REQUIRE(nMax * nMax == 1);
+    REQUIRE(nMax * ~uint64_t(0) == uint1056_t(0) - ~uint64_t(0));
+
+    /* Dividing by the top word alone and by the whole width. */
+    REQUIRE(nMax / nMax == 1);
+    REQUIRE(nMax / (nMax >> 1) == 2);
+    REQUIRE(nMax - (nMax / uint64_t(0xffffffff)) * uint64_t(0xffffffff) < uint64_t(0xffffffff));
+
+    REQUIRE_THROWS_AS(nMax / uint1056_t(0), std::domain_error);
+    REQUIRE_THROWS_AS(nMax / uint64_t(0), std::domain_error);
+
+    /* Shifting by the width or more clears the number. */
+    REQUIRE((nMax << 1056) == 0);
+    REQUIRE((nMax >> 1056) == 0);
+    REQUIRE((nMax >> 1055) == 1);
+    REQUIRE(uint1056_t(1) << 1055 > nMax >> 1);
+}
@@ -0,0 +1,125 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK/KeccakHash.h>
+#include <LLC/hash/SK/KeccakTimes4.h>
+#include <LLC/include/random.h>
+
+#include <Util/include/hex.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <algorithm>
+
+
+TEST_CASE( "Keccak Permutation Tests", "[LLC]")
+{
+    for(uint32_t n = 0; n < 1000; ++n)
+    {
+        uint64_t compact[25], opt[25];
+        for(uint32_t i = 0; i < 25; ++i)
+            compact[i] = opt[i] = LLC::GetRand();
+
+        KeccakF1600_StatePermuteCompact(compact);
+        KeccakF1600_StatePermuteOpt64(opt);
+
+        REQUIRE(std::equal(compact, compact + 25, opt));
+    }
+}
+
+
+TEST_CASE( "Keccak Permutation Times4 Tests", "[LLC]")
+{
+    for(uint32_t n = 0; n < 100; ++n)
+    {
+        uint64_t states[100], single[4][25];
+        for(uint32_t i = 0; i < 25; ++i)
+        {
+            for(uint32_t j = 0; j < 4; ++j)
+                states[i * 4 + j] = single[j][i] = LLC::GetRand();
+        }
+
+        KeccakF1600_StatePermuteTimes4(states);
+        for(uint32_t j = 0; j < 4; ++j)
+        {
+            KeccakF1600_StatePermuteCompact(single[j]);
+            for(uint32_t i = 0; i < 25; ++i)
+            {
+                REQUIRE(states[i * 4 + j] == single[j][i]);
+            }
+        }
+    }
+}
+
+
+TEST_CASE( "Keccak SHA3 Vector Tests", "[LLC]")
+{
+    std::vector<uint8_t> vHash(64, 0);
+
+    Keccak_HashInstance ctx;
+    Keccak_HashInitialize_SHA3_512(&ctx);
+    Keccak_HashUpdate(&ctx, (uint8_t*)"", 0);
+    Keccak_HashFinal(&ctx, &vHash[0]);
+
+    REQUIRE(HexStr(vHash.begin(), vHash.end()) ==
+        "a69f73cca23a9ac5c8b567dc185a756e97c982164fe25859e0d1dcc1475c80a6"
+        "15b2123af1f5f94c11e3e9402c3ac558f500199d95b6d3e301758586281dcd26");
+}
+
+
+TEST_CASE( "Keccak Hash Times4 Tests", "[LLC]")
+{
+    /* The Keccak instances used by the SK hash family. */
+    const uint32_t nParams[][4] =
+    {
+        {1344,  256,   32, 0x06},
+        {1344,  256,   64, 0x06},
+        {1088,  512,  256, 0x06},
+        { 576, 1024,  512, 0x06},
+        {1024,  576,  576, 0x06},
+        { 576, 1024, 1024, 0x05}
+    };
+
+    for(const auto& params : nParams)
+    {
+        for(const uint32_t nLength : {0u, 1u, 32u, 64u, 71u, 72u, 128u, 300u})
+        {
+            std::vector<uint8_t> vData[4], vOut[4];
+            const uint8_t* pData[4];
+            uint8_t* pOut[4];
+            for(uint32_t j = 0; j < 4; ++j)
+            {
+                vData[j] = LLC::GetRand256().GetBytes();
+                vData[j].resize(nLength + 1, static_cast<uint8_t>(j));
+                vOut[j].resize(params[2] / 8);
+
+                pData[j] = &vData[j][0];
+                pOut[j]  = &vOut[j][0];
+            }
+
+            REQUIRE(Keccak_HashTimes4(params[0], params[1], params[2], params[3], pData, nLength, pOut) == 0);
+
+            for(uint32_t j = 0; j < 4; ++j)
+            {
+                std::vector<uint8_t> vHash(params[2] / 8);
+
+                Keccak_HashInstance ctx;
+                Keccak_HashInitialize(&ctx, params[0], params[1], params[2], params[3]);
+                Keccak_HashUpdate(&ctx, &vData[j][0], nLength * 8);
+                Keccak_HashFinal(&ctx, &vHash[0]);
+
+                REQUIRE(vHash == vOut[j]);
+            }
+        }
+    }
+}
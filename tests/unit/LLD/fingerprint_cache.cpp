@@ -0,0 +1,93 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLD/cache/fingerprint_cache.h>
+
+#include <LLC/hash/SK.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <thread>
+
+
+TEST_CASE( "Fingerprint Cache Tests", "[LLD]")
+{
+    LLD::FingerprintCache<uint64_t> cache(100);
+    REQUIRE(cache.Slots() == 128);
+
+    std::vector<uint8_t> vKey = {1, 2, 3, 4, 5};
+
+    uint64_t nValue = 0;
+    REQUIRE_FALSE(cache.Get(&vKey[0], vKey.size(), nValue));
+
+    cache.Put(&vKey[0], vKey.size(), 555);
+    REQUIRE(cache.Get(&vKey[0], vKey.size(), nValue));
+    REQUIRE(nValue == 555);
+
+    /* A prefix of the key is a different key. */
+    REQUIRE_FALSE(cache.Get(&vKey[0], vKey.size() - 1, nValue));
+
+    /* Keys over the size limit are never cached. */
+    std::vector<uint8_t> vLarge(65, 7);
+    cache.Put(&vLarge[0], vLarge.size(), 777);
+    REQUIRE_FALSE(cache.Get(&vLarge[0], vLarge.size(), nValue));
+
+    REQUIRE(cache.Hits() == 1);
+    REQUIRE(cache.Misses() == 2);
+}
+
+
+TEST_CASE( "Fingerprint Cache Thread Tests", "[LLD]")
+{
+    LLD::FingerprintCache<uint64_t> cache(16);
+
+    /* Hammer a small cache from several threads, values must always match their key. */
+    std::vector<std::thread> vThreads;
+    std::atomic<uint32_t> nErrors(0);
+    for(uint32_t t = 0; t < 4; ++t)
+    {
+        vThreads.push_back(std::thread([&cache, &nErrors, t]()
+        {
+            for(uint64_t n = 0; n < 100000; ++n)
+            {
+                const uint64_t nKey = (n * 7 + t) % 64;
+
+                uint64_t nValue = 0;
+                if(cache.Get((uint8_t*)&nKey, sizeof(nKey), nValue) && nValue != nKey * 3)
+                    ++nErrors;
+
+                cache.Put((uint8_t*)&nKey, sizeof(nKey), nKey * 3);
+            }
+        }));
+    }
+
+    for(auto& thread : vThreads)
+        thread.join();
+
+    REQUIRE(nErrors.load() == 0);
+    REQUIRE(cache.Hits() > 0);
+}
+
+
+TEST_CASE( "SK64 Cache Tests", "[LLD]")
+{
+    std::vector<uint8_t> vData = {0xde, 0xad, 0xbe, 0xef};
+
+    /* Cached and uncached lookups give the same hash. */
+    const uint64_t hash1 = LLC::SK64(vData);
+    const uint64_t hash2 = LLC::SK64(vData.begin(), vData.end());
+    REQUIRE(hash1 == hash2);
+
+    vData.push_back(0);
+    REQUIRE(LLC::SK64(vData) != hash1);
+}
@@ -0,0 +1,105 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/eckey.h>
+#include <LLC/include/random.h>
+
+#include <Legacy/include/enum.h>
+#include <Legacy/include/evaluate.h>
+#include <Legacy/include/signature.h>
+
+#include <Legacy/types/script.h>
+#include <Legacy/types/transaction.h>
+
+#include <unit/catch2/catch.hpp>
+
+TEST_CASE( "Legacy Signature Context Tests", "[legacy]" )
+{
+    /* Build a transaction with a few inputs and outputs. */
+    Legacy::Transaction tx;
+    tx.nVersion  = 1;
+    tx.nTime     = 1500000000;
+    tx.nLockTime = 0;
+
+    for(uint32_t n = 0; n < 5; ++n)
+    {
+        Legacy::TxIn txin;
+        txin.prevout.hash = LLC::GetRand512();
+        txin.prevout.n    = n;
+        txin.scriptSig << std::vector<uint8_t>(72, uint8_t(n));
+        txin.nSequence    = 0xffffffff - n;
+
+        tx.vin.push_back(txin);
+    }
+
+    for(uint32_t n = 0; n < 3; ++n)
+    {
+        Legacy::TxOut txout;
+        txout.nValue = 1000 * (n + 1);
+        txout.scriptPubKey << std::vector<uint8_t>(33, uint8_t(n)) << Legacy::OP_CHECKSIG;
+
+        tx.vout.push_back(txout);
+    }
+
+    /* Check the context matches the full serialization for every input and hash type. */
+    Legacy::Script scriptCode;
+    scriptCode << std::vector<uint8_t>(33, 0xaa) << Legacy::OP_CHECKSIG;
+
+    Legacy::Script scriptSeparator;
+    scriptSeparator << Legacy::OP_CODESEPARATOR << std::vector<uint8_t>(33, 0xbb) << Legacy::OP_CHECKSIG;
+
+    const Legacy::SignatureContext context(tx);
+    for(uint32_t n = 0; n < tx.vin.size(); ++n)
+    {
+        for(const int32_t nHashType : { int32_t(Legacy::SIGHASH_ALL), int32_t(Legacy::SIGHASH_NONE),
+                                        int32_t(Legacy::SIGHASH_SINGLE), int32_t(Legacy::SIGHASH_ALL | Legacy::SIGHASH_ANYONECANPAY) })
+        {
+            /* SIGHASH_SINGLE has no output past the last one. */
+            if((nHashType & 0x1f) == Legacy::SIGHASH_SINGLE && n >= tx.vout.size())
+                continue;
+
+            REQUIRE(context.SignatureHash(scriptCode, n, nHashType) == Legacy::SignatureHash(scriptCode, tx, n, nHashType));
+            REQUIRE(context.SignatureHash(scriptSeparator, n, nHashType) == Legacy::SignatureHash(scriptSeparator, tx, n, nHashType));
+        }
+    }
+
+    /* Sign an input and check it verifies with and without the context. */
+    LLC::ECKey key;
+    key.MakeNewKey(true);
+
+    Legacy::Script scriptPubKey;
+    scriptPubKey << key.GetPubKey() << Legacy::OP_CHECKSIG;
+
+    std::vector<uint8_t> vchSig;
+    REQUIRE(key.Sign(Legacy::SignatureHash(scriptPubKey, tx, 2, Legacy::SIGHASH_ALL), vchSig, 256));
+    vchSig.push_back(uint8_t(Legacy::SIGHASH_ALL));
+
+    tx.vin[2].scriptSig = Legacy::Script();
+    tx.vin[2].scriptSig << vchSig;
+
+    const Legacy::SignatureContext contextSigned(tx);
+    REQUIRE(Legacy::VerifyScript(tx.vin[2].scriptSig, scriptPubKey, tx, 2, 0));
+    REQUIRE(Legacy::VerifyScript(tx.vin[2].scriptSig, scriptPubKey, contextSigned, 2, 0));
+
+    /* Verify twice, the second from the script cache. */
+    REQUIRE(Legacy::VerifyInput(contextSigned, 2, scriptPubKey));
+    REQUIRE(Legacy::VerifyInput(contextSigned, 2, scriptPubKey));
+
+    /* A different output script isn't found in the cache. */
+    Legacy::Script scriptOther;
+    scriptOther << std::vector<uint8_t>(33, 0xcc) << Legacy::OP_CHECKSIG;
+    REQUIRE_FALSE(Legacy::VerifyInput(contextSigned, 2, scriptOther));
+
+    /* The other inputs aren't signed. */
+    REQUIRE_FALSE(Legacy::VerifyInput(contextSigned, 1, scriptPubKey));
+}
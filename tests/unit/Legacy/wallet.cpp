@@ -0,0 +1,64 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+#include <LLD/include/global.h>
+
+#include <Legacy/types/transaction.h>
+#include <Legacy/types/wallettx.h>
+#include <Legacy/wallet/wallet.h>
+#include <Legacy/wallet/walletdb.h>
+
+#include <Util/include/runtime.h>
+
+#include <unit/catch2/catch.hpp>
+
+TEST_CASE("Wallet rescan load Tests", "[legacy]")
+{
+    Legacy::WalletDB walletdb(Legacy::WalletDB::DEFAULT_WALLET_DB);
+
+    //get a key of the wallet file
+    std::vector<uint8_t> vKey;
+    REQUIRE(Legacy::Wallet::GetInstance().GetKeyPool().GetKeyFromPool(vKey, false));
+
+    //unconfirmed payment to the wallet, not on chain
+    Legacy::Transaction tx;
+    tx.nTime = runtime::unifiedtimestamp();
+    tx.vin.push_back(Legacy::TxIn(Legacy::OutPoint(LLC::GetRand512(), 0)));
+    tx.vout.resize(1);
+    tx.vout[0].nValue = 500000;
+    tx.vout[0].scriptPubKey.SetNexusAddress(vKey);
+
+    const uint512_t hashTx = tx.GetHash();
+    REQUIRE(walletdb.WriteTx(hashTx, Legacy::WalletTx(&Legacy::Wallet::GetInstance(), tx)));
+
+    //record stored under the hash of another transaction on disk, which loading removes and asks for a rescan
+    Legacy::Transaction txDisk = tx;
+    txDisk.vout[0].nValue = 100;
+
+    const uint512_t hashDisk = txDisk.GetHash();
+    REQUIRE(LLD::Legacy->WriteTx(hashDisk, txDisk));
+    REQUIRE(walletdb.WriteTx(hashDisk, Legacy::WalletTx(&Legacy::Wallet::GetInstance(), tx)));
+
+    //load the file into a new wallet
+    Legacy::Wallet wallet;
+    REQUIRE(walletdb.LoadWallet(wallet) == Legacy::DB_NEEDS_RESCAN);
+    REQUIRE(wallet.mapWallet.count(hashTx));
+    REQUIRE_FALSE(wallet.mapWallet.count(hashDisk));
+
+    //the unconfirmed transaction counts before any rescan finds it on chain
+    REQUIRE(wallet.GetUnconfirmedBalance() >= 500000);
+
+    //clean up the wallet file for the other tests
+    REQUIRE(walletdb.EraseTx(hashTx));
+}
@@ -0,0 +1,142 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <TAO/API/types/sessions.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE( "Sessions Tests", "[API/sessions]")
+{
+    TAO::API::Sessions sessions;
+
+    /* Unknown sessions. */
+    uint256_t nSession1 = LLC::GetRand256();
+    REQUIRE_FALSE(sessions.Has(nSession1));
+    REQUIRE(sessions.Get(nSession1)->IsNull());
+
+    /* Add a session. */
+    memory::encrypted_ptr<TAO::Ledger::SignatureChain> user1 = new TAO::Ledger::SignatureChain("sessions1", "password");
+    uint256_t hashGenesis1 = user1->Genesis();
+    REQUIRE(sessions.Add(nSession1, hashGenesis1, user1));
+
+    REQUIRE(sessions.Has(nSession1));
+    REQUIRE((*sessions.Get(nSession1))->Genesis() == hashGenesis1);
+    REQUIRE(sessions.Size() == 1);
+
+    uint256_t hashGenesis = 0;
+    REQUIRE(sessions.Genesis(nSession1, hashGenesis));
+    REQUIRE(hashGenesis == hashGenesis1);
+
+    uint256_t nSession = 0;
+    REQUIRE(sessions.Find(hashGenesis1, nSession));
+    REQUIRE(nSession == nSession1);
+
+    /* The same user can't log in twice. */
+    uint256_t nSession2 = LLC::GetRand256();
+    memory::encrypted_ptr<TAO::Ledger::SignatureChain> user2 = new TAO::Ledger::SignatureChain("sessions1", "password");
+    REQUIRE_FALSE(sessions.Add(nSession2, hashGenesis1, user2));
+    user2.free();
+
+    /* A session ID can't be used twice. */
+    memory::encrypted_ptr<TAO::Ledger::SignatureChain> user3 = new TAO::Ledger::SignatureChain("sessions2", "password");
+    uint256_t hashGenesis3 = user3->Genesis();
+    REQUIRE_FALSE(sessions.Add(nSession1, hashGenesis3, user3));
+    REQUIRE_FALSE(sessions.Find(hashGenesis3, nSession));
+
+    /* Another user in another session. */
+    REQUIRE(sessions.Add(nSession2, hashGenesis3, user3));
+    REQUIRE(sessions.Size() == 2);
+    REQUIRE(sessions.Find(hashGenesis3, nSession));
+    REQUIRE(nSession == nSession2);
+
+    /* Remove the first session. */
+    REQUIRE(sessions.Remove(nSession1));
+    REQUIRE_FALSE(sessions.Remove(nSession1));
+    REQUIRE_FALSE(sessions.Has(nSession1));
+    REQUIRE_FALSE(sessions.Find(hashGenesis1, nSession));
+    REQUIRE(sessions.Size() == 1);
+
+    /* Clear the rest. */
+    sessions.Clear();
+    REQUIRE(sessions.Size() == 0);
+    REQUIRE_FALSE(sessions.Find(hashGenesis3, nSession));
+}
+
+
+TEST_CASE( "Sessions concurrent logout Tests", "[API/sessions]")
+{
+    TAO::API::Sessions sessions;
+
+    const uint256_t nSession = LLC::GetRand256();
+
+    /* The key every login of this user derives. */
+    uint512_t hashKey = 0;
+    {
+        TAO::Ledger::SignatureChain user("sessions3", "password");
+        hashKey = user.Generate(0, "1234");
+    }
+
+    /* Keys are derived while the user logs in and out, so sessions are removed under callers still using them. */
+    std::atomic<bool> fDone(false);
+    std::atomic<uint32_t> nKeys(0);
+    std::atomic<uint32_t> nWrong(0);
+
+    std::vector<std::thread> vThreads;
+    for(uint32_t n = 0; n < 4; ++n)
+    {
+        vThreads.emplace_back([&]()
+        {
+            while(!fDone.load())
+            {
+                const std::shared_ptr<memory::encrypted_ptr<TAO::Ledger::SignatureChain>> pUser = sessions.Get(nSession);
+                if(pUser->IsNull())
+                    continue;
+
+                if((*pUser)->Generate(0, "1234") != hashKey)
+                    ++nWrong;
+
+                ++nKeys;
+            }
+        });
+    }
+
+    for(uint32_t nLogin = 0; nLogin < 5; ++nLogin)
+    {
+        memory::encrypted_ptr<TAO::Ledger::SignatureChain> user = new TAO::Ledger::SignatureChain("sessions3", "password");
+
+        /* Read the genesis before adding, so the chain isn't moved while decrypted. */
+        const uint256_t hashGenesis = user->Genesis();
+        REQUIRE(sessions.Add(nSession, hashGenesis, user));
+
+        /* Let a caller pick up the session before logging out. */
+        const uint32_t nTarget = nKeys.load() + 1;
+        while(nKeys.load() < nTarget)
+            std::this_thread::yield();
+
+        REQUIRE(sessions.Remove(nSession));
+    }
+
+    fDone = true;
+    for(auto& thread : vThreads)
+        thread.join();
+
+    REQUIRE(nWrong.load() == 0);
+    REQUIRE(nKeys.load() >= 5);
+    REQUIRE(sessions.Size() == 0);
+}
@@ -15,6 +15,10 @@ ________________________________________________________________________________
 #include <TAO/Ledger/types/tritium.h>
 #include <TAO/Ledger/types/state.h>
 
+#include <LLC/hash/SK.h>
+#include <LLC/hash/macro.h>
+#include <LLC/include/random.h>
+
 #include <unit/catch2/catch.hpp>
 
 TEST_CASE( "Block primitive values", "[ledger]")
@@ -117,3 +121,79 @@ TEST_CASE( "Block primitive values", "[ledger]")
 
 
 }
+
+
+TEST_CASE( "Block merkle tree", "[ledger]")
+{
+    TAO::Ledger::Block block;
+
+    /* Empty trees have a null root. */
+    std::vector<uint512_t> vHashes;
+    REQUIRE(block.BuildMerkleTree(vHashes) == 0);
+
+    for(uint32_t nSize = 1; nSize < 70; ++nSize)
+    {
+        vHashes.push_back(LLC::GetRand512());
+
+        /* Reference tree hashing one node at a time. */
+        std::vector<uint512_t> vMerkleTree = vHashes;
+        uint32_t j = 0;
+        for(uint32_t nLevel = nSize; nLevel > 1; nLevel = (nLevel + 1) >> 1)
+        {
+            for(uint32_t i = 0; i < nLevel; i += 2)
+            {
+                const uint512_t hashLeft  = vMerkleTree[j + i];
+                const uint512_t hashRight = vMerkleTree[j + std::min(i + 1, nLevel - 1)];
+
+                vMerkleTree.push_back(LLC::SK512(BEGIN(hashLeft), END(hashLeft), BEGIN(hashRight), END(hashRight)));
+            }
+            j += nLevel;
+        }
+
+        REQUIRE(block.BuildMerkleTree(vHashes) == vMerkleTree.back());
+    }
+}
+
+
+TEST_CASE( "Block merkle branch", "[ledger]")
+{
+    TAO::Ledger::Block block;
+
+    std::vector<uint512_t> vHashes;
+    for(uint32_t nSize = 0; nSize < 70; ++nSize)
+    {
+        /* The branch of the last leaf must give the same root as the full tree for any leaf. */
+        const std::vector<uint512_t> vBranch = block.BuildMerkleBranch(vHashes);
+        for(uint32_t n = 0; n < 3; ++n)
+        {
+            const uint512_t hashLeaf = LLC::GetRand512();
+
+            std::vector<uint512_t> vLeaves = vHashes;
+            vLeaves.push_back(hashLeaf);
+
+            REQUIRE(block.BuildMerkleRoot(hashLeaf, vBranch, nSize) == block.BuildMerkleTree(vLeaves));
+        }
+
+        vHashes.push_back(LLC::GetRand512());
+    }
+}
+
+
+TEST_CASE( "Block stake hash midstate", "[ledger]")
+{
+    TAO::Ledger::TritiumBlock block;
+    block.nVersion             = 7;
+    block.hashPrevBlock        = LLC::GetRand1024();
+    block.nChannel             = 0;
+    block.nHeight              = 2500000;
+    block.nBits                = 0x7b0fffff;
+    block.producer.hashGenesis = LLC::GetRand256();
+
+    /* Hashing from the prefix state must match the full stake hash for any nonce. */
+    const LLC::SK1024Midstate midstate(block.StakePrefix());
+    for(const uint64_t nNonce : { uint64_t(0), uint64_t(1), uint64_t(255), uint64_t(1) << 40, ~uint64_t(0) })
+    {
+        block.nNonce = nNonce;
+        REQUIRE(midstate.Hash(nNonce) == block.StakeHash());
+    }
+}
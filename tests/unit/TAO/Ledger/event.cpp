@@ -0,0 +1,116 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/Ledger/types/event.h>
+#include <TAO/Ledger/types/transaction.h>
+
+#include <TAO/Operation/include/enum.h>
+
+#include <TAO/Register/include/constants.h>
+
+#include <LLC/include/random.h>
+
+#include <Util/templates/datastream.h>
+
+#include <unit/catch2/catch.hpp>
+
+TEST_CASE( "Event index parsing", "[ledger]")
+{
+    using namespace TAO::Operation;
+
+    const uint256_t hashGenesis  = LLC::GetRand256();
+    const uint256_t hashOther    = LLC::GetRand256();
+    const uint256_t hashFrom     = LLC::GetRand256();
+    const uint256_t hashTo       = LLC::GetRand256();
+    const uint256_t hashRegister = LLC::GetRand256();
+
+    TAO::Ledger::Transaction tx;
+    tx.nTimestamp = 1000;
+
+    tx[0] << uint8_t(OP::DEBIT)    << hashFrom << hashTo << uint64_t(500) << uint64_t(0);
+    tx[1] << uint8_t(OP::DEBIT)    << hashFrom << TAO::Register::WILDCARD_ADDRESS << uint64_t(10) << uint64_t(0);
+    tx[2] << uint8_t(OP::TRANSFER) << hashRegister << hashGenesis << uint8_t(TRANSFER::CLAIM);
+    tx[3] << uint8_t(OP::TRANSFER) << hashRegister << hashGenesis << uint8_t(TRANSFER::FORCE);
+    tx[4] << uint8_t(OP::TRANSFER) << hashRegister << hashOther   << uint8_t(TRANSFER::CLAIM);
+    tx[5] << uint8_t(OP::COINBASE) << hashGenesis  << uint64_t(77) << uint64_t(0);
+    tx[6] << uint8_t(OP::COINBASE) << hashOther    << uint64_t(77) << uint64_t(0);
+    tx[7] << uint8_t(OP::WRITE)    << hashRegister << std::vector<uint8_t>(1, 0);
+
+    const uint512_t hashTx = LLC::GetRand512();
+
+    //only the contracts that could be for the address are kept
+    std::vector<TAO::Ledger::Event> vEvents;
+    TAO::Ledger::Event::Parse(tx, hashTx, hashGenesis, 5, vEvents);
+    REQUIRE(vEvents.size() == 3);
+
+    REQUIRE(vEvents[0].nOP        == OP::DEBIT);
+    REQUIRE(vEvents[0].nContract  == 0);
+    REQUIRE(vEvents[0].hashProof  == hashFrom);
+    REQUIRE(vEvents[0].hashTarget == hashTo);
+    REQUIRE(vEvents[0].nAmount    == 500);
+    REQUIRE(vEvents[0].nSequence  == 5);
+    REQUIRE(vEvents[0].nTimestamp == 1000);
+    REQUIRE(vEvents[0].hashTx     == hashTx);
+
+    REQUIRE(vEvents[1].nOP        == OP::TRANSFER);
+    REQUIRE(vEvents[1].nContract  == 2);
+    REQUIRE(vEvents[1].hashProof  == hashGenesis);
+    REQUIRE(vEvents[1].hashTarget == hashRegister);
+
+    REQUIRE(vEvents[2].nOP        == OP::COINBASE);
+    REQUIRE(vEvents[2].nContract  == 5);
+    REQUIRE(vEvents[2].nAmount    == 77);
+
+    //sequences with one event keep it in their slot, others are marked for a transaction read
+    TAO::Ledger::EventChunk chunk;
+    REQUIRE(chunk.Empty());
+
+    DataStream ssEmpty(SER_LLD, 1);
+    ssEmpty << chunk;
+
+    chunk.Set(16, std::vector<TAO::Ledger::Event>(1, vEvents[1]));
+    chunk.Set(17, std::vector<TAO::Ledger::Event>());
+    chunk.Set(18, vEvents);
+    REQUIRE(!chunk.Empty());
+
+    //chunks serialize round trip
+    DataStream ssChunk(SER_LLD, 1);
+    ssChunk << chunk;
+
+    TAO::Ledger::EventChunk chunkRead;
+    ssChunk >> chunkRead;
+
+    std::vector<TAO::Ledger::Event> vRead;
+    REQUIRE(chunkRead.Get(16, vRead));
+    REQUIRE(vRead.size() == 1);
+    REQUIRE(vRead[0].nOP        == OP::TRANSFER);
+    REQUIRE(vRead[0].hashTarget == hashRegister);
+
+    vRead.clear();
+    REQUIRE(chunkRead.Get(17, vRead));
+    REQUIRE(vRead.empty());
+
+    REQUIRE(!chunkRead.Get(18, vRead));
+    REQUIRE(!chunkRead.Get(19, vRead));
+
+    //a chunk is the same size whatever it holds, so its sector is never outgrown
+    REQUIRE(ssChunk.size() == ssEmpty.size());
+
+    //cleared slots need their transaction read again
+    chunkRead.Clear(16);
+    REQUIRE(!chunkRead.Get(16, vRead));
+
+    chunkRead.Clear(17);
+    chunkRead.Clear(18);
+    REQUIRE(chunkRead.Empty());
+}
@@ -1676,3 +1676,104 @@ TEST_CASE( "Mempool and memory sequencing tests", "[mempool]")
         TAO::Ledger::mempool.Check();
     }
 }
+
+
+TEST_CASE( "Mempool cross sigchain dependency tests", "[mempool]")
+{
+    using namespace TAO::Register;
+    using namespace TAO::Operation;
+
+    /* Clear the memory pool so only the transactions of this test are listed. */
+    std::vector<uint512_t> vExistingHashes;
+    TAO::Ledger::mempool.List(vExistingHashes);
+    for(auto& hash : vExistingHashes)
+    {
+        REQUIRE(TAO::Ledger::mempool.Remove(hash));
+    }
+
+    uint256_t hashGenesisA = TAO::Ledger::SignatureChain::Genesis("mempooldebit");
+    uint256_t hashGenesisB = TAO::Ledger::SignatureChain::Genesis("mempoolcredit");
+
+    TAO::Register::Address hashToken   = TAO::Register::Address(TAO::Register::Address::TOKEN);
+    TAO::Register::Address hashAccount = TAO::Register::Address(TAO::Register::Address::ACCOUNT);
+    TAO::Register::Address hashFees    = TAO::Register::Address(TAO::Register::Address::ACCOUNT);
+
+    //token owned by A, an account for it owned by B, and a funded NXS account for B's fees
+    {
+        Object token = CreateToken(hashToken, 1000, 100);
+        token.hashOwner = hashGenesisA;
+        token.SetChecksum();
+        REQUIRE(LLD::Register->WriteState(hashToken, token));
+
+        Object account = CreateAccount(hashToken);
+        account.hashOwner = hashGenesisB;
+        account.SetChecksum();
+        REQUIRE(LLD::Register->WriteState(hashAccount, account));
+
+        Object fees = CreateAccount(0);
+        fees.hashOwner = hashGenesisB;
+        REQUIRE(fees.Parse());
+        REQUIRE(fees.Write("balance", uint64_t(1000000)));
+        fees.SetChecksum();
+        REQUIRE(LLD::Register->WriteState(hashFees, fees));
+    }
+
+    //debit on sigchain A without fees
+    uint512_t hashDebit = 0;
+    {
+        TAO::Ledger::Transaction tx;
+        tx.hashGenesis = hashGenesisA;
+        tx.nSequence   = 0;
+        tx.nTimestamp  = runtime::timestamp();
+        tx.nKeyType    = TAO::Ledger::SIGNATURE::BRAINPOOL;
+        tx.nNextType   = TAO::Ledger::SIGNATURE::BRAINPOOL;
+        tx.NextHash(LLC::GetRand512(), TAO::Ledger::SIGNATURE::BRAINPOOL);
+
+        //payload
+        tx[0] << uint8_t(OP::DEBIT) << hashToken << hashAccount << uint64_t(100) << uint64_t(0);
+
+        REQUIRE(tx.Build());
+        tx.Sign(LLC::GetRand512());
+
+        REQUIRE(TAO::Ledger::mempool.Accept(tx));
+
+        hashDebit = tx.GetHash();
+    }
+
+    //credit on sigchain B paying a fee, so its sigchain is listed first by fees
+    uint512_t hashCredit = 0;
+    {
+        TAO::Ledger::Transaction tx;
+        tx.hashGenesis = hashGenesisB;
+        tx.nSequence   = 0;
+        tx.nTimestamp  = runtime::timestamp();
+        tx.nKeyType    = TAO::Ledger::SIGNATURE::BRAINPOOL;
+        tx.nNextType   = TAO::Ledger::SIGNATURE::BRAINPOOL;
+        tx.NextHash(LLC::GetRand512(), TAO::Ledger::SIGNATURE::BRAINPOOL);
+
+        //payload
+        tx[0] << uint8_t(OP::CREDIT) << hashDebit << uint32_t(0) << hashAccount << hashToken << uint64_t(100);
+        tx[1] << uint8_t(OP::FEE) << hashFees << uint64_t(1000);
+
+        REQUIRE(tx.Build());
+        tx.Sign(LLC::GetRand512());
+
+        REQUIRE(TAO::Ledger::mempool.Accept(tx));
+        REQUIRE(tx.Fees() > 0);
+
+        hashCredit = tx.GetHash();
+    }
+
+    //the credit is listed after the debit it spends
+    {
+        std::vector<uint512_t> vHashes;
+        REQUIRE(TAO::Ledger::mempool.List(vHashes));
+        REQUIRE(vHashes.size() == 2);
+        REQUIRE(vHashes[0] == hashDebit);
+        REQUIRE(vHashes[1] == hashCredit);
+    }
+
+    //clean up the memory pool for the other tests
+    REQUIRE(TAO::Ledger::mempool.Remove(hashCredit));
+    REQUIRE(TAO::Ledger::mempool.Remove(hashDebit));
+}
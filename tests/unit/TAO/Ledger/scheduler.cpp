@@ -0,0 +1,74 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/Ledger/include/scheduler.h>
+
+#include <LLC/include/random.h>
+
+#include <Util/include/parallel.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <atomic>
+
+TEST_CASE( "Connect scheduler waves", "[ledger]")
+{
+    TAO::Ledger::ConnectScheduler scheduler;
+    REQUIRE(scheduler.Empty());
+
+    const uint256_t hashGenesis1 = LLC::GetRand256();
+    const uint256_t hashGenesis2 = LLC::GetRand256();
+    const uint256_t hashAccount  = LLC::GetRand256();
+
+    const uint512_t hashTx1 = LLC::GetRand512();
+    const uint512_t hashTx2 = LLC::GetRand512();
+    const uint512_t hashTx3 = LLC::GetRand512();
+    const uint512_t hashTx4 = LLC::GetRand512();
+
+    //independent sigchains connect in the same wave
+    REQUIRE(scheduler.Schedule(0, {hashGenesis1}, {hashTx1}) == 0);
+    REQUIRE(scheduler.Schedule(1, {hashGenesis2, hashAccount}, {hashTx2}) == 0);
+
+    //a shared register is connected after the last transaction using it
+    REQUIRE(scheduler.Schedule(2, {hashGenesis1, hashAccount}, {hashTx3}) == 1);
+
+    //a dependant is connected after the transaction it depends on
+    REQUIRE(scheduler.Schedule(3, {LLC::GetRand256()}, {hashTx4, hashTx3}) == 2);
+
+    REQUIRE(scheduler.Waves().size() == 3);
+    REQUIRE(scheduler.Waves()[0] == std::vector<uint32_t>({0, 1}));
+    REQUIRE(scheduler.Waves()[1] == std::vector<uint32_t>({2}));
+    REQUIRE(scheduler.Waves()[2] == std::vector<uint32_t>({3}));
+
+    scheduler.Clear();
+    REQUIRE(scheduler.Empty());
+    REQUIRE(scheduler.Schedule(0, {hashGenesis1}, {hashTx3}) == 0);
+}
+
+
+TEST_CASE( "Parallel for", "[ledger]")
+{
+    std::vector<std::atomic<uint32_t>> vCount(1000);
+    for(auto& nCount : vCount)
+        nCount.store(0);
+
+    ParallelFor(vCount.size(), 8, [&](const uint32_t n)
+    {
+        ++vCount[n];
+    });
+
+    for(const auto& nCount : vCount)
+    {
+        REQUIRE(nCount.load() == 1);
+    }
+}
@@ -41,6 +41,48 @@ TEST_CASE( "Signature Chain Generation", "[ledger]")
 }
 
 
+TEST_CASE( "Signature Chain Key Cache", "[sigchain]")
+{
+    /* Keep argon2 cheap for the test. */
+    config::mapArgs["-argon2"]        = "1";
+    config::mapArgs["-argon2_memory"] = "4";
+
+    TAO::Ledger::SignatureChain user = TAO::Ledger::SignatureChain("cacheuser", "password");
+
+    /* Cached keys must match the keys derived without the cache. */
+    uint512_t hashKey = user.Generate(0, "1234");
+    REQUIRE(hashKey == user.Generate(0, "password", "1234"));
+    REQUIRE(hashKey == user.Generate(0, "1234"));
+    REQUIRE(hashKey == user.Generate(0, "1234", false));
+
+    /* A different pin or key ID must not hit the cache. */
+    REQUIRE(user.Generate(0, "4321") == user.Generate(0, "password", "4321"));
+    REQUIRE(user.Generate(0, "4321") != hashKey);
+    REQUIRE(user.Generate(1, "1234") != hashKey);
+
+    /* Typed keys are cached by their type. */
+    uint512_t hashAuth = user.Generate("auth", 0, "1234");
+    REQUIRE(hashAuth != hashKey);
+    REQUIRE(hashAuth == user.Generate("auth", 0, "1234"));
+    REQUIRE(hashAuth != user.Generate("sign", 0, "1234"));
+
+    /* Keys evicted from the cache are derived again. */
+    for(uint32_t n = 2; n < 40; ++n)
+        user.Generate(n, "1234");
+
+    REQUIRE(hashKey == user.Generate(0, "1234"));
+
+    /* Key hashes derived together match the ones derived one at a time. */
+    std::vector<uint256_t> vKeys = user.KeyHashes({"auth", "network"}, 0, "1234", TAO::Ledger::SIGNATURE::FALCON);
+    REQUIRE(vKeys.size() == 2);
+    REQUIRE(vKeys[0] == user.KeyHash("auth", 0, "1234", TAO::Ledger::SIGNATURE::FALCON));
+    REQUIRE(vKeys[1] == user.KeyHash("network", 0, "1234", TAO::Ledger::SIGNATURE::FALCON));
+
+    config::mapArgs.erase("-argon2");
+    config::mapArgs.erase("-argon2_memory");
+}
+
+
 TEST_CASE( "Signature Chain Genesis Transaction checks", "[sigchain]")
 {
     using namespace TAO::Register;
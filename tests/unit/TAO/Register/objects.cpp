@@ -20,6 +20,8 @@ ________________________________________________________________________________
 
 #include <unit/catch2/catch.hpp>
 
+#include <thread>
+
 TEST_CASE( "Object Register Tests", "[register]")
 {
     using namespace TAO::Register;
@@ -262,3 +264,83 @@ TEST_CASE( "Object Register Tests", "[register]")
         REQUIRE(vRead == vBytes);
     }
 }
+
+
+TEST_CASE( "Object Register Layout Tests", "[register]" )
+{
+    using namespace TAO::Register;
+
+    //two accounts of the same shape share one layout
+    Object account1;
+    account1 << std::string("balance") << uint8_t(TYPES::MUTABLE) << uint8_t(TYPES::UINT64_T) << uint64_t(55)
+             << std::string("token") << uint8_t(TYPES::UINT256_T) << uint256_t(0);
+
+    Object account2;
+    account2 << std::string("balance") << uint8_t(TYPES::MUTABLE) << uint8_t(TYPES::UINT64_T) << uint64_t(77)
+             << std::string("token") << uint8_t(TYPES::UINT256_T) << LLC::GetRand256();
+
+    REQUIRE(account1.Parse());
+    REQUIRE(account2.Parse());
+    REQUIRE(account1.pLayout == account2.pLayout);
+
+    REQUIRE(account1.Standard() == OBJECTS::ACCOUNT);
+    REQUIRE(account1.get<uint64_t>("balance") == 55);
+    REQUIRE(account2.get<uint64_t>("balance") == 77);
+    REQUIRE(account1.Mutable("balance"));
+    REQUIRE(!account1.Mutable("token"));
+
+    //other threads find the same interned layout
+    Object account4;
+    account4 << std::string("balance") << uint8_t(TYPES::MUTABLE) << uint8_t(TYPES::UINT64_T) << uint64_t(11)
+             << std::string("token") << uint8_t(TYPES::UINT256_T) << uint256_t(0);
+
+    bool fParsed = false;
+    std::thread thread([&]()
+    {
+        fParsed = account4.Parse();
+    });
+    thread.join();
+
+    REQUIRE(fParsed);
+    REQUIRE(account4.pLayout == account1.pLayout);
+    REQUIRE(account4.get<uint64_t>("balance") == 11);
+
+    //writes only touch their own object
+    REQUIRE(account1.Write("balance", uint64_t(99)));
+    REQUIRE(account1.get<uint64_t>("balance") == 99);
+    REQUIRE(account2.get<uint64_t>("balance") == 77);
+
+    //same field names with a different mutability is a different shape
+    Object account3;
+    account3 << std::string("balance") << uint8_t(TYPES::UINT64_T) << uint64_t(55)
+             << std::string("token") << uint8_t(TYPES::UINT256_T) << uint256_t(0);
+
+    REQUIRE(account3.Parse());
+    REQUIRE(account3.pLayout != account1.pLayout);
+    REQUIRE(account3.Standard() == OBJECTS::NONSTANDARD);
+
+    //variable size fields get their own layout with the right positions
+    Object name1;
+    name1 << std::string("namespace") << uint8_t(TYPES::STRING) << std::string("")
+          << std::string("name") << uint8_t(TYPES::STRING) << std::string("short")
+          << std::string("address") << uint8_t(TYPES::UINT256_T) << uint256_t(5);
+
+    Object name2;
+    name2 << std::string("namespace") << uint8_t(TYPES::STRING) << std::string("")
+          << std::string("name") << uint8_t(TYPES::STRING) << std::string("a much longer name")
+          << std::string("address") << uint8_t(TYPES::UINT256_T) << uint256_t(7);
+
+    REQUIRE(name1.Parse());
+    REQUIRE(name2.Parse());
+    REQUIRE(name1.pLayout != name2.pLayout);
+    REQUIRE(name1.Standard() == OBJECTS::NAME);
+    REQUIRE(name1.get<uint256_t>("address") == 5);
+    REQUIRE(name2.get<uint256_t>("address") == 7);
+
+    //duplicates are rejected
+    Object duplicate;
+    duplicate << std::string("balance") << uint8_t(TYPES::UINT64_T) << uint64_t(55)
+              << std::string("balance") << uint8_t(TYPES::UINT64_T) << uint64_t(55);
+
+    REQUIRE(!duplicate.Parse());
+}
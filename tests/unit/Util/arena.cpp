@@ -0,0 +1,125 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#include <Util/include/arena.h>
+#include <unit/catch2/catch.hpp>
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Util arena tests", "[arena]")
+{
+    /* Allocations are aligned and don't overlap. */
+    Arena arena;
+    uint8_t* pFirst  = static_cast<uint8_t*>(arena.Allocate(3, 1));
+    uint8_t* pSecond = static_cast<uint8_t*>(arena.Allocate(8, 8));
+    REQUIRE(reinterpret_cast<uintptr_t>(pSecond) % 8 == 0);
+    REQUIRE(pSecond >= pFirst + 3);
+    REQUIRE(arena.Used() == 11);
+    REQUIRE(arena.Reserved() == Arena::CHUNK_SIZE);
+
+    /* Filling a chunk moves to another. */
+    for(uint32_t n = 0; n < 64; ++n)
+        arena.Allocate(4096);
+
+    REQUIRE(arena.Reserved() > Arena::CHUNK_SIZE);
+
+    /* Large allocations don't take chunks. */
+    const uint64_t nReserved = arena.Reserved();
+    arena.Allocate(Arena::CHUNK_SIZE * 4);
+    REQUIRE(arena.Reserved() == nReserved);
+
+    /* Reset reuses the chunks from the start. */
+    arena.Reset();
+    REQUIRE(arena.Used() == 0);
+    REQUIRE(arena.Reserved() == nReserved);
+    REQUIRE(static_cast<uint8_t*>(arena.Allocate(3, 1)) == pFirst);
+
+    /* Reset keeps a bounded number of chunks. */
+    for(uint32_t n = 0; n < Arena::RETAIN_CHUNKS * 8; ++n)
+        arena.Allocate(Arena::LARGE_SIZE);
+
+    REQUIRE(arena.Reserved() > Arena::RETAIN_CHUNKS * Arena::CHUNK_SIZE);
+    arena.Reset();
+    REQUIRE(arena.Reserved() == Arena::RETAIN_CHUNKS * Arena::CHUNK_SIZE);
+
+    /* No arena is current outside of a scope. */
+    REQUIRE(Arena::Current() == nullptr);
+
+    typedef std::map<uint32_t, std::string, std::less<uint32_t>,
+                     ArenaAllocator<std::pair<const uint32_t, std::string>>> ArenaMap;
+
+    /* Containers outside of a scope use the heap. */
+    {
+        ArenaMap mapHeap;
+        for(uint32_t n = 0; n < 100; ++n)
+            mapHeap[n] = std::to_string(n);
+
+        REQUIRE(mapHeap.size() == 100);
+        REQUIRE(mapHeap[42] == "42");
+    }
+
+    /* Containers in a scope use the thread's arena, and only the outermost scope resets it. */
+    {
+        ArenaScope scope;
+
+        Arena* pArena = Arena::Current();
+        REQUIRE(pArena != nullptr);
+
+        {
+            ArenaScope scopeNested;
+            REQUIRE(Arena::Current() == pArena);
+
+            ArenaMap mapArena;
+            for(uint32_t n = 0; n < 100; ++n)
+                mapArena[n] = std::to_string(n);
+
+            REQUIRE(mapArena[99] == "99");
+            mapArena.erase(50);
+            REQUIRE(mapArena.size() == 99);
+        }
+
+        REQUIRE(Arena::Current() == pArena);
+        REQUIRE(pArena->Used() > 0);
+
+        std::vector<uint64_t, ArenaAllocator<uint64_t>> vArena;
+        for(uint64_t n = 0; n < 10000; ++n)
+            vArena.push_back(n);
+
+        REQUIRE(vArena[9999] == 9999);
+    }
+
+    REQUIRE(Arena::Current() == nullptr);
+
+    /* Each thread has an arena of its own. */
+    Arena* pMain = nullptr;
+    Arena* pOther = nullptr;
+    {
+        ArenaScope scope;
+        pMain = Arena::Current();
+
+        std::thread thread([&]()
+        {
+            ArenaScope scopeThread;
+            pOther = Arena::Current();
+        });
+        thread.join();
+    }
+
+    REQUIRE(pMain != nullptr);
+    REQUIRE(pOther != nullptr);
+    REQUIRE(pMain != pOther);
+}
@@ -0,0 +1,57 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Util/templates/bloomfilter.h>
+#include <unit/catch2/catch.hpp>
+
+TEST_CASE("Util bloom filter tests", "[bloom]")
+{
+    BloomFilter filter(1000);
+
+    /* Insert some elements. */
+    for(uint32_t n = 0; n < 1000; ++n)
+    {
+        std::vector<uint8_t> vData(32, 0);
+        vData[0] = uint8_t(n);
+        vData[1] = uint8_t(n >> 8);
+
+        filter.Insert(vData);
+    }
+
+    /* Everything inserted must be found. */
+    for(uint32_t n = 0; n < 1000; ++n)
+    {
+        std::vector<uint8_t> vData(32, 0);
+        vData[0] = uint8_t(n);
+        vData[1] = uint8_t(n >> 8);
+
+        REQUIRE(filter.Contains(vData));
+    }
+
+    /* Most things not inserted must not be found. */
+    uint32_t nFalse = 0;
+    for(uint32_t n = 0; n < 10000; ++n)
+    {
+        std::vector<uint8_t> vData(32, 0xff);
+        vData[0] = uint8_t(n);
+        vData[1] = uint8_t(n >> 8);
+
+        if(filter.Contains(vData))
+            ++nFalse;
+    }
+
+    REQUIRE(nFalse < 50);
+
+    /* Different lengths are different elements. */
+    REQUIRE(!filter.Contains(std::vector<uint8_t>(31, 0)));
+}
@@ -0,0 +1,159 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+
+#include <LLC/types/uint1024.h>
+
+#include <Util/templates/flatmap.h>
+#include <unit/catch2/catch.hpp>
+
+#include <map>
+#include <memory>
+#include <stdexcept>
+
+TEST_CASE("Util flat map tests", "[flatmap]")
+{
+    FlatMap<uint512_t, uint32_t> mapFlat;
+    std::map<uint512_t, uint32_t> mapOrdered;
+
+    REQUIRE(mapFlat.empty());
+    REQUIRE(mapFlat.find(0) == mapFlat.end());
+    REQUIRE(mapFlat.erase(uint512_t(0)) == 0);
+    REQUIRE_THROWS_AS(mapFlat.at(0), std::out_of_range);
+
+    /* Random inserts, overwrites and erases on a small key space, so every path is hit many times. */
+    uint64_t nState = 0x2545f4914f6cdd1d;
+    for(uint32_t n = 0; n < 200000; ++n)
+    {
+        nState ^= nState << 13;
+        nState ^= nState >> 7;
+        nState ^= nState << 17;
+
+        /* Keys share their low bits in runs, to make long probe sequences. */
+        uint512_t hashKey = (nState >> 8) % 4096;
+        hashKey |= uint512_t(hashKey % 7) << 300;
+
+        switch(nState % 5)
+        {
+            case 0:
+            case 1:
+            {
+                mapFlat[hashKey]    = n;
+                mapOrdered[hashKey] = n;
+                break;
+            }
+
+            case 2:
+            {
+                const bool fAdded = mapFlat.insert(std::make_pair(hashKey, n)).second;
+                REQUIRE(fAdded == mapOrdered.insert(std::make_pair(hashKey, n)).second);
+                break;
+            }
+
+            case 3:
+            {
+                REQUIRE(mapFlat.erase(hashKey) == mapOrdered.erase(hashKey));
+                break;
+            }
+
+            default:
+            {
+                const auto it = mapFlat.find(hashKey);
+                REQUIRE(mapFlat.count(hashKey) == mapOrdered.count(hashKey));
+                if(it != mapFlat.end())
+                {
+                    REQUIRE(it->first == hashKey);
+                    REQUIRE(it->second == mapOrdered.at(hashKey));
+                }
+            }
+        }
+
+        REQUIRE(mapFlat.size() == mapOrdered.size());
+    }
+
+    /* Every entry is found with its value, and iterating visits each once. */
+    for(const auto& entry : mapOrdered)
+    {
+        REQUIRE(mapFlat.at(entry.first) == entry.second);
+    }
+
+    uint32_t nVisited = 0;
+    for(const auto& entry : mapFlat)
+    {
+        REQUIRE(mapOrdered.at(entry.first) == entry.second);
+        ++nVisited;
+    }
+    REQUIRE(nVisited == mapOrdered.size());
+
+    /* Erasing while iterating visits every entry once. */
+    nVisited = 0;
+    for(auto it = mapFlat.begin(); it != mapFlat.end(); )
+    {
+        REQUIRE(mapOrdered.count(it->first) == 1);
+        ++nVisited;
+
+        if(it->second % 2 == 0)
+        {
+            mapOrdered.erase(it->first);
+            it = mapFlat.erase(it);
+        }
+        else
+            ++it;
+    }
+    REQUIRE(nVisited > 0);
+    REQUIRE(mapFlat.size() == mapOrdered.size());
+
+    for(const auto& entry : mapOrdered)
+    {
+        REQUIRE(mapFlat.at(entry.first) == entry.second);
+    }
+
+    /* Clearing keeps the map usable. */
+    mapFlat.clear();
+    REQUIRE(mapFlat.empty());
+    REQUIRE(mapFlat.count(mapOrdered.begin()->first) == 0);
+
+    mapFlat[7] = 7;
+    REQUIRE(mapFlat.at(7) == 7);
+}
+
+
+TEST_CASE("Util flat map move only values", "[flatmap]")
+{
+    FlatMap<uint256_t, std::unique_ptr<uint32_t>> mapFlat;
+    mapFlat.reserve(1000);
+
+    for(uint32_t n = 0; n < 1000; ++n)
+    {
+        REQUIRE(mapFlat.insert(std::make_pair(uint256_t(n), std::unique_ptr<uint32_t>(new uint32_t(n)))).second);
+    }
+
+    /* Erasing moves the last value into the gap. */
+    for(uint32_t n = 0; n < 1000; n += 3)
+    {
+        REQUIRE(mapFlat.erase(uint256_t(n)) == 1);
+    }
+
+    for(uint32_t n = 0; n < 1000; ++n)
+    {
+        if(n % 3 == 0)
+        {
+            REQUIRE(mapFlat.count(n) == 0);
+        }
+        else
+        {
+            REQUIRE(*mapFlat.at(n) == n);
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Util/include/metrics.h>
+#include <unit/catch2/catch.hpp>
+
+#include <thread>
+#include <vector>
+
+TEST_CASE("Util metrics tests", "[metrics]")
+{
+    /* The same name and labels give the same counter. */
+    metrics::Counter& counter = metrics::GetCounter("test_events_total", "Test events.", "kind=\"a\"");
+    REQUIRE(&counter == &metrics::GetCounter("test_events_total", "Test events.", "kind=\"a\""));
+    REQUIRE(&counter != &metrics::GetCounter("test_events_total", "Test events.", "kind=\"b\""));
+
+    /* Counts from many threads add up. */
+    std::vector<std::thread> vThreads;
+    for(uint32_t n = 0; n < 8; ++n)
+    {
+        vThreads.emplace_back([&counter]()
+        {
+            for(uint32_t i = 0; i < 10000; ++i)
+                counter.Add();
+        });
+    }
+
+    for(auto& thread : vThreads)
+        thread.join();
+
+    REQUIRE(counter.Value() == 80000);
+
+    /* Observations land in the right buckets. */
+    metrics::Histogram& histogram = metrics::GetHistogram("test_latency_seconds", "Test latency.");
+    histogram.Observe(5);
+    histogram.Observe(10);
+    histogram.Observe(600);
+    histogram.Observe(100000000);
+
+    std::array<uint64_t, metrics::BUCKET_COUNT> vCounts;
+    uint64_t nSum = 0;
+    histogram.Buckets(vCounts, nSum);
+
+    REQUIRE(vCounts[0] == 2);
+    REQUIRE(vCounts[4] == 1);
+    REQUIRE(vCounts[metrics::BUCKET_COUNT - 1] == 1);
+    REQUIRE(nSum == 100000615);
+    REQUIRE(histogram.Count() == 4);
+
+    /* Codes get their own counters and large codes share one. */
+    metrics::CounterIndex index("test_messages_total", "Test messages.", "direction=\"in\"", "message");
+    index.Get(0x10).Add(3);
+    index.Get(0x1000).Add(2);
+    index.Get(0x2000).Add(1);
+
+    REQUIRE(&index.Get(0x10) == &metrics::GetCounter("test_messages_total", "", "direction=\"in\",message=\"0x10\""));
+    REQUIRE(&index.Get(0x1000) == &index.Get(0x2000));
+
+    metrics::AddGauge("test_value", "Test value.", "", []{ return 42.5; });
+
+    /* Check the exposition format. */
+    const std::string strOut = metrics::Prometheus();
+    REQUIRE(strOut.find("# TYPE test_events_total counter\n") != std::string::npos);
+    REQUIRE(strOut.find("test_events_total{kind=\"a\"} 80000\n") != std::string::npos);
+    REQUIRE(strOut.find("test_events_total{kind=\"b\"} 0\n") != std::string::npos);
+    REQUIRE(strOut.find("# TYPE test_latency_seconds histogram\n") != std::string::npos);
+    REQUIRE(strOut.find("test_latency_seconds_bucket{le=\"1e-05\"} 2\n") != std::string::npos);
+    REQUIRE(strOut.find("test_latency_seconds_bucket{le=\"0.001\"} 3\n") != std::string::npos);
+    REQUIRE(strOut.find("test_latency_seconds_bucket{le=\"+Inf\"} 4\n") != std::string::npos);
+    REQUIRE(strOut.find("test_latency_seconds_count 4\n") != std::string::npos);
+    REQUIRE(strOut.find("test_messages_total{direction=\"in\",message=\"0x10\"} 3\n") != std::string::npos);
+    REQUIRE(strOut.find("test_messages_total{direction=\"in\",message=\"other\"} 3\n") != std::string::npos);
+    REQUIRE(strOut.find("# TYPE test_value gauge\n") != std::string::npos);
+    REQUIRE(strOut.find("test_value 42.5\n") != std::string::npos);
+}
@@ -0,0 +1,57 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+
+
+#include <Util/include/parallel.h>
+#include <unit/catch2/catch.hpp>
+
+#include <atomic>
+#include <vector>
+
+TEST_CASE("Util parallel for tests", "[parallel]")
+{
+    /* Every index runs exactly once, over many calls that reuse the pooled workers. */
+    for(uint32_t nCall = 0; nCall < 200; ++nCall)
+    {
+        const uint32_t nTotal = nCall % 37;
+        std::vector<std::atomic<uint32_t>> vCount(nTotal);
+        for(auto& nCount : vCount)
+            nCount = 0;
+
+        ParallelFor(nTotal, 1 + nCall % 8, [&vCount](const uint32_t n)
+        {
+            ++vCount[n];
+        });
+
+        for(const auto& nCount : vCount)
+        {
+            REQUIRE(nCount.load() == 1);
+        }
+    }
+
+    /* Nested calls from pooled workers finish rather than waiting on a busy pool. */
+    std::atomic<uint32_t> nInner(0);
+    ParallelFor(16, 4, [&nInner](const uint32_t)
+    {
+        ParallelFor(64, 4, [&nInner](const uint32_t)
+        {
+            ++nInner;
+        });
+    });
+    REQUIRE(nInner.load() == 16 * 64);
+
+    REQUIRE(ParallelThreads(3) == 3);
+    REQUIRE(ParallelThreads(0) >= 1);
+}
@@ -0,0 +1,91 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Util/templates/ringbuffer.h>
+#include <unit/catch2/catch.hpp>
+
+#include <string>
+#include <thread>
+
+TEST_CASE("Util ring buffer tests", "[ringbuffer]")
+{
+    /* Capacity is rounded up to a power of two. */
+    RingBuffer<std::string> ring(5);
+    REQUIRE(ring.Capacity() == 8);
+    REQUIRE(ring.Size() == 0);
+
+    /* Pop from an empty buffer fails. */
+    std::string strValue;
+    REQUIRE_FALSE(ring.Pop(strValue));
+
+    /* Fill the buffer. */
+    for(uint32_t n = 0; n < 8; ++n)
+    {
+        std::string strPush = std::to_string(n);
+        REQUIRE(ring.Push(std::move(strPush)));
+    }
+
+    REQUIRE(ring.Size() == 8);
+
+    /* A full buffer rejects the push and leaves the value alone. */
+    std::string strFull = "full";
+    REQUIRE_FALSE(ring.Push(std::move(strFull)));
+    REQUIRE(strFull == "full");
+
+    /* Elements come out in order. */
+    for(uint32_t n = 0; n < 8; ++n)
+    {
+        REQUIRE(ring.Pop(strValue));
+        REQUIRE(strValue == std::to_string(n));
+    }
+
+    REQUIRE(ring.Size() == 0);
+    REQUIRE_FALSE(ring.Pop(strValue));
+
+    /* One producer and one consumer across threads, wrapping many times. */
+    RingBuffer<uint64_t> queue(64);
+
+    const uint64_t nTotal = 200000;
+    std::thread producer([&]()
+    {
+        for(uint64_t n = 0; n < nTotal; )
+        {
+            uint64_t nPush = n;
+            if(queue.Push(std::move(nPush)))
+                ++n;
+            else
+                std::this_thread::yield();
+        }
+    });
+
+    bool fOrdered = true;
+    for(uint64_t n = 0; n < nTotal; )
+    {
+        uint64_t nPop = 0;
+        if(!queue.Pop(nPop))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        if(nPop != n)
+            fOrdered = false;
+
+        ++n;
+    }
+
+    producer.join();
+
+    REQUIRE(fOrdered);
+    REQUIRE(queue.Size() == 0);
+}
@@ -0,0 +1,83 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Util/include/trace.h>
+#include <Util/include/json.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <thread>
+
+/* Find a trace event by name. */
+static json::json find_event(const json::json& jsonTrace, const std::string& strName)
+{
+    for(const auto& jsonEvent : jsonTrace["traceEvents"])
+    {
+        if(jsonEvent["name"].get<std::string>() == strName)
+            return jsonEvent;
+    }
+
+    return json::json();
+}
+
+
+TEST_CASE("Util trace tests", "[trace]")
+{
+    /* Spans aren't recorded while disabled. */
+    trace::Enable(false);
+    {
+        trace::Span span("TestDisabled");
+    }
+
+    REQUIRE(find_event(json::json::parse(trace::Dump(60)), "TestDisabled").is_null());
+
+    /* Record nested spans. */
+    trace::Enable(true);
+    {
+        trace::Span outer("TestOuter");
+
+        const std::string strDetail = "get/info";
+        trace::Span inner("TestInner", strDetail);
+    }
+
+    /* A span on another thread has no parent. */
+    std::thread([]()
+    {
+        trace::Span span("TestThread");
+    }).join();
+
+    trace::Enable(false);
+
+    const json::json jsonTrace = json::json::parse(trace::Dump(60));
+
+    const json::json jsonOuter  = find_event(jsonTrace, "TestOuter");
+    const json::json jsonInner  = find_event(jsonTrace, "TestInner get/info");
+    const json::json jsonThread = find_event(jsonTrace, "TestThread");
+
+    REQUIRE_FALSE(jsonOuter.is_null());
+    REQUIRE_FALSE(jsonInner.is_null());
+    REQUIRE_FALSE(jsonThread.is_null());
+
+    /* Complete events with parent linkage. */
+    REQUIRE(jsonOuter["ph"].get<std::string>() == "X");
+    REQUIRE(jsonInner["args"]["parent"].get<uint64_t>() == jsonOuter["args"]["id"].get<uint64_t>());
+    REQUIRE(jsonOuter["args"]["parent"].get<uint64_t>() == 0);
+    REQUIRE(jsonThread["args"]["parent"].get<uint64_t>() == 0);
+
+    /* The inner span is within the outer span, and the thread has its own tid. */
+    REQUIRE(jsonInner["ts"].get<uint64_t>() >= jsonOuter["ts"].get<uint64_t>());
+    REQUIRE(jsonInner["ts"].get<uint64_t>() + jsonInner["dur"].get<uint64_t>()
+         <= jsonOuter["ts"].get<uint64_t>() + jsonOuter["dur"].get<uint64_t>());
+    REQUIRE(jsonInner["tid"].get<uint32_t>() == jsonOuter["tid"].get<uint32_t>());
+    REQUIRE(jsonThread["tid"].get<uint32_t>() != jsonOuter["tid"].get<uint32_t>());
+}
@@ -0,0 +1,69 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+
+#include <LLC/types/uint1024.h>
+
+#include <Util/templates/datastream.h>
+#include <Util/templates/viewstream.h>
+#include <unit/catch2/catch.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("Util view stream tests", "[viewstream]")
+{
+    /* Serialize some values. */
+    DataStream ssData(SER_LLD, 1);
+    ssData << std::string("hello") << uint32_t(42) << uint256_t(7) << std::vector<uint8_t>(3, 0xff);
+
+    /* The view reads the same values without copying the bytes. */
+    const std::vector<uint8_t>& vData = ssData.Bytes();
+    const ViewStream ssView(vData, SER_LLD, 1);
+    REQUIRE(ssView.begin() == vData.data());
+    REQUIRE(ssView.size() == vData.size());
+
+    std::string strValue;
+    uint32_t nValue = 0;
+    uint256_t hashValue = 0;
+    std::vector<uint8_t> vValue;
+    ssView >> strValue >> nValue >> hashValue >> vValue;
+
+    REQUIRE(strValue == "hello");
+    REQUIRE(nValue == 42);
+    REQUIRE(hashValue == uint256_t(7));
+    REQUIRE(vValue == std::vector<uint8_t>(3, 0xff));
+    REQUIRE(ssView.End());
+
+    /* Reading past the end throws and leaves the position alone. */
+    const uint64_t nPos = ssView.GetPos();
+    uint8_t nByte = 0;
+    REQUIRE_THROWS_AS(ssView >> nByte, std::runtime_error);
+    REQUIRE(ssView.GetPos() == nPos);
+
+    /* Positions can be set and reset. */
+    ssView.Reset();
+    ssView >> strValue;
+    REQUIRE(strValue == "hello");
+
+    ssView.SetPos(ssView.size());
+    REQUIRE(ssView.End());
+    REQUIRE_THROWS_AS(ssView.SetPos(ssView.size() + 1), std::runtime_error);
+
+    /* An empty view is at its end. */
+    const std::vector<uint8_t> vEmpty;
+    const ViewStream ssEmpty(vEmpty, SER_LLD, 1);
+    REQUIRE(ssEmpty.End());
+    REQUIRE_THROWS_AS(ssEmpty >> nByte, std::runtime_error);
+}